@@ -158,7 +158,7 @@ Meshgen2Gmsh::Meshgen2Gmsh(int argc, char** argv): AtlasTool(argc, argv) {
     add_option(new SimpleOption<std::string>(
         "generator", "Mesh generator [structured,regular,delaunay,cubedsphere] (default = structured)"));
     add_option(new SimpleOption<std::string>("partitioner",
-                                             "Mesh partitioner [equal_regions,checkerboard,equal_bands,regular_bands"));
+                                             "Mesh partitioner [equal_regions,checkerboard,equal_bands,regular_bands,hilbert"));
 
     add_option(new Separator("Options for `--generator=structured`"));
     add_option(new SimpleOption<bool>("include-pole", "Include pole point"));
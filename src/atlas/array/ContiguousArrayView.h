@@ -0,0 +1,298 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/// @file ContiguousArrayView.h
+/// This file contains the ContiguousArrayView class, a view with the same access API as ArrayView
+/// for data that is known to be contiguous in memory.
+/// The fastest (last) index has a unit stride that is known at compile time, and optionally the
+/// extent of the fastest index can be fixed at compile time as well, e.g. for (x,y,z) coordinates.
+/// This allows compilers to vectorise inner loops which they cannot prove unit-strided with ArrayView.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <type_traits>
+
+#include "atlas/array/Array.h"
+#include "atlas/array/ArrayUtil.h"
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/library/config.h"
+#include "atlas/runtime/Exception.h"
+
+//------------------------------------------------------------------------------------------------------
+
+namespace atlas {
+namespace array {
+
+/// @brief Extent value meaning that the extent is only known at run time
+constexpr idx_t dynamic_extent = -1;
+
+/// @brief Multi-dimensional access to contiguous data, with compile-time unit stride in the fastest dimension
+///
+/// A ContiguousArrayView has the same element access API as ArrayView, but can only be created for
+/// contiguous data. It is created with the make_contiguous_view helper functions, which throw when
+/// the array (or view) is not contiguous, e.g. because it is a slice or padded.
+///
+/// ### Example 1:
+///
+/// @code{.cpp}
+///    auto view = make_contiguous_view<double,2>( field );
+///    for( idx_t n=0; n<view.shape(0); ++n ) {
+///       for( idx_t k=0; k<view.shape(1); ++k ) {  // unit stride, vectorisable
+///           view(n,k) *= 2.;
+///       }
+///    }
+/// @endcode
+///
+/// ### Example 2: compile-time extent of the fastest dimension
+///
+/// @code{.cpp}
+///    auto xyz = make_contiguous_view<double,2,3>( mesh.nodes().field("xyz") );
+/// @endcode
+template <typename Value, int Rank, idx_t InnerExtent = dynamic_extent>
+class ContiguousArrayView {
+    template <typename T>
+    using is_non_const_value_type = typename std::is_same<T, typename std::remove_const<Value>::type>;
+
+#define ENABLE_IF_NON_CONST                                                                             \
+    template <bool EnableBool                                                                   = true, \
+              typename std::enable_if<(!std::is_const<Value>::value && EnableBool), int>::type* = nullptr>
+
+#define ENABLE_IF_CONST_WITH_NON_CONST(T)                                                                             \
+    template <typename T, typename std::enable_if<(std::is_const<Value>::value && is_non_const_value_type<T>::value), \
+                                                  int>::type* = nullptr>
+
+    static_assert(InnerExtent == dynamic_extent || InnerExtent > 0, "InnerExtent must be positive or dynamic_extent");
+
+public:
+    // -- Type definitions
+    using value_type                   = Value;
+    using non_const_value_type         = typename std::remove_const<Value>::type;
+    static constexpr bool is_const     = std::is_const<Value>::value;
+    static constexpr bool is_non_const = !std::is_const<Value>::value;
+    static constexpr int RANK{Rank};
+    static constexpr idx_t INNER_EXTENT{InnerExtent};
+
+public:
+    // -- Constructors
+
+    /// @brief Wrap contiguous data with given shape; strides are inferred from the shape
+    ContiguousArrayView(value_type* data, const idx_t shape[]): data_(data) {
+        size_ = 1;
+        for (int j = Rank - 1; j >= 0; --j) {
+            shape_[j]   = shape[j];
+            strides_[j] = idx_t(size_);
+            size_ *= size_t(shape_[j]);
+        }
+        check_inner_extent();
+    }
+
+    /// @brief Wrap contiguous data with given shape; strides are inferred from the shape
+    ContiguousArrayView(value_type* data, const ArrayShape& shape): ContiguousArrayView(data, shape.data()) {}
+
+    /// @brief Create from an ArrayView, which must be contiguous
+    template <typename OtherValue,
+              typename = typename std::enable_if<std::is_same<OtherValue, value_type>::value ||
+                                                 std::is_same<const OtherValue, value_type>::value>::type>
+    explicit ContiguousArrayView(const ArrayView<OtherValue, Rank>& view):
+        ContiguousArrayView(const_cast<value_type*>(view.data()), view.shape()) {
+        if (not view.contiguous() || view.stride(Rank - 1) != 1) {
+            throw_Exception("ContiguousArrayView: ArrayView is not contiguous", Here());
+        }
+    }
+
+    ContiguousArrayView(const ContiguousArrayView& other) = default;
+
+    ENABLE_IF_CONST_WITH_NON_CONST(value_type)
+    ContiguousArrayView(const ContiguousArrayView<value_type, Rank, InnerExtent>& other):
+        ContiguousArrayView(other.data(), other.shape()) {}
+
+    // -- Access methods
+
+    /// @brief Multidimensional index operator: view(i,j,k,...)
+    template <typename... Idx>
+    value_type& operator()(Idx... idx) {
+        check_bounds(idx...);
+        return data_[index(idx...)];
+    }
+
+    /// @brief Multidimensional index operator: view(i,j,k,...)
+    template <typename... Idx>
+    const value_type& operator()(Idx... idx) const {
+        check_bounds(idx...);
+        return data_[index(idx...)];
+    }
+
+    /// @brief Access to data using square bracket [idx] operator (only for Rank == 1)
+    template <typename Int, bool EnableBool = true>
+    typename std::enable_if<(Rank == 1 && EnableBool), const value_type&>::type operator[](Int idx) const {
+        check_bounds(idx);
+        return data_[idx];
+    }
+
+    /// @brief Access to data using square bracket [idx] operator (only for Rank == 1)
+    template <typename Int, bool EnableBool = true>
+    typename std::enable_if<(Rank == 1 && EnableBool), value_type&>::type operator[](Int idx) {
+        check_bounds(idx);
+        return data_[idx];
+    }
+
+    /// @brief Return number of values in dimension **Dim** (template argument)
+    template <unsigned int Dim>
+    idx_t shape() const {
+        return (int(Dim) == Rank - 1 && InnerExtent != dynamic_extent) ? InnerExtent : shape_[Dim];
+    }
+
+    /// @brief Return stride for values in dimension **Dim** (template argument)
+    template <unsigned int Dim>
+    idx_t stride() const {
+        return stride_part<Dim>();
+    }
+
+    /// @brief Return number of values in dimension idx
+    template <typename Int>
+    idx_t shape(Int idx) const {
+        return shape_[idx];
+    }
+
+    /// @brief Return stride for values in dimension idx
+    template <typename Int>
+    idx_t stride(Int idx) const {
+        return strides_[idx];
+    }
+
+    const idx_t* shape() const { return shape_.data(); }
+
+    const idx_t* strides() const { return strides_.data(); }
+
+    /// @brief Return total number of values (accumulated over all dimensions)
+    size_t size() const { return size_; }
+
+    /// @brief Return the number of dimensions
+    static constexpr idx_t rank() { return Rank; }
+
+    /// @brief Always true for this view
+    static constexpr bool contiguous() { return true; }
+
+    bool valid() const { return true; }
+
+    /// @brief Access to internal data. @m_class{m-label m-danger} **dangerous**
+    value_type const* data() const { return data_; }
+
+    /// @brief Access to internal data. @m_class{m-label m-danger} **dangerous**
+    value_type* data() { return data_; }
+
+    ENABLE_IF_NON_CONST
+    void assign(const value_type& value) {
+        for (size_t j = 0; j < size_; ++j) {
+            data_[j] = value;
+        }
+    }
+
+private:
+    // -- Private methods
+
+    template <int Dim>
+    constexpr idx_t stride_part() const {
+        return (Dim == Rank - 1) ? 1
+                                 : ((Dim == Rank - 2 && InnerExtent != dynamic_extent) ? InnerExtent : strides_[Dim]);
+    }
+
+    template <int Dim, typename Int, typename... Ints>
+    constexpr idx_t index_part(Int idx, Ints... next_idx) const {
+        return idx * stride_part<Dim>() + index_part<Dim + 1>(next_idx...);
+    }
+
+    template <int Dim, typename Int>
+    constexpr idx_t index_part(Int last_idx) const {
+        static_assert(Dim == Rank - 1, "Expected number of indices is different from rank of array");
+        return last_idx;
+    }
+
+    template <typename... Ints>
+    constexpr idx_t index(Ints... idx) const {
+        return index_part<0>(idx...);
+    }
+
+    void check_inner_extent() const {
+        if (InnerExtent != dynamic_extent && shape_[Rank - 1] != InnerExtent) {
+            std::stringstream err;
+            err << "ContiguousArrayView: extent of fastest dimension is " << shape_[Rank - 1] << ", expected "
+                << InnerExtent;
+            throw_Exception(err.str(), Here());
+        }
+    }
+
+#if ATLAS_ARRAYVIEW_BOUNDS_CHECKING
+    template <typename... Ints>
+    void check_bounds(Ints... idx) const {
+        static_assert(sizeof...(idx) == Rank, "Expected number of indices is different from rank of array");
+        return check_bounds_part<0>(idx...);
+    }
+#else
+    template <typename... Ints>
+    void check_bounds(Ints... idx) const {
+        static_assert(sizeof...(idx) == Rank, "Expected number of indices is different from rank of array");
+    }
+#endif
+
+    template <int Dim, typename Int, typename... Ints>
+    void check_bounds_part(Int idx, Ints... next_idx) const {
+        if (idx_t(idx) >= shape_[Dim]) {
+            throw_OutOfRange("ContiguousArrayView", array_dim<Dim>(), idx, shape_[Dim]);
+        }
+        check_bounds_part<Dim + 1>(next_idx...);
+    }
+
+    template <int Dim, typename Int>
+    void check_bounds_part(Int last_idx) const {
+        if (idx_t(last_idx) >= shape_[Dim]) {
+            throw_OutOfRange("ContiguousArrayView", array_dim<Dim>(), last_idx, shape_[Dim]);
+        }
+    }
+
+    // -- Private data
+
+    value_type* data_;
+    size_t size_;
+    std::array<idx_t, Rank> shape_;
+    std::array<idx_t, Rank> strides_;
+
+#undef ENABLE_IF_NON_CONST
+#undef ENABLE_IF_CONST_WITH_NON_CONST
+};
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Create a ContiguousArrayView from an ArrayView; throws if the view is not contiguous
+template <idx_t InnerExtent = dynamic_extent, typename Value, int Rank>
+ContiguousArrayView<Value, Rank, InnerExtent> make_contiguous_view(const ArrayView<Value, Rank>& view) {
+    return ContiguousArrayView<Value, Rank, InnerExtent>(view);
+}
+
+/// @brief Create a ContiguousArrayView from an Array (or Field); throws if the array is not contiguous
+template <typename Value, int Rank, idx_t InnerExtent = dynamic_extent>
+ContiguousArrayView<Value, Rank, InnerExtent> make_contiguous_view(Array& array) {
+    return ContiguousArrayView<Value, Rank, InnerExtent>(make_view<Value, Rank>(array));
+}
+
+/// @brief Create a ContiguousArrayView from an Array (or Field); throws if the array is not contiguous
+template <typename Value, int Rank, idx_t InnerExtent = dynamic_extent>
+ContiguousArrayView<const Value, Rank, InnerExtent> make_contiguous_view(const Array& array) {
+    return ContiguousArrayView<const Value, Rank, InnerExtent>(make_view<Value, Rank>(array));
+}
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace array
+}  // namespace atlas
@@ -8,10 +8,12 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <sstream>
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/runtime/Exception.h"
 
@@ -55,8 +57,28 @@ Field& FieldSetImpl::field(const std::string& name) const {
 }
 
 void FieldSetImpl::haloExchange(bool on_device) const {
+    // Dirty fields are grouped per function space, so that each function space can exchange
+    // the halos of all its fields together rather than one message per field
+    std::vector<const functionspace::FunctionSpaceImpl*> functionspaces;
+    std::vector<FieldSet> groups;
     for (idx_t i = 0; i < size(); ++i) {
-        field(i).haloExchange(on_device);
+        const Field& f = field(i);
+        if (!f.dirty()) {
+            continue;
+        }
+        ATLAS_ASSERT(f.functionspace());
+        const auto* fs = f.functionspace().get();
+        auto it        = std::find(functionspaces.begin(), functionspaces.end(), fs);
+        if (it == functionspaces.end()) {
+            functionspaces.push_back(fs);
+            groups.emplace_back();
+            it = functionspaces.end() - 1;
+        }
+        groups[it - functionspaces.begin()].add(f);
+    }
+    for (auto& group : groups) {
+        group[0].functionspace().haloExchange(group, on_device);
+        group.set_dirty(false);
     }
 }
 
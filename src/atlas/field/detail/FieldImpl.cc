@@ -101,11 +101,11 @@ size_t FieldImpl::footprint() const {
 }
 
 bool FieldImpl::dirty() const {
-    return metadata().getBool("dirty", true);
+    return dirty_;
 }
 
 void FieldImpl::set_dirty(bool value) const {
-    const_cast<FieldImpl&>(*this).metadata().set("dirty", value);
+    dirty_ = value;
 }
 
 void FieldImpl::dump(std::ostream& os) const {
@@ -209,6 +209,7 @@ private:  // members
     util::Metadata metadata_;
     array::Array* array_;
     FunctionSpace* functionspace_;
+    mutable bool dirty_{true};  // halo needs updating
     std::vector<std::function<void()>> callback_on_destruction_;
 };
 
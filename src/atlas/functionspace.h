@@ -15,6 +15,7 @@
 #include "atlas/functionspace/CellColumns.h"
 #include "atlas/functionspace/CubedSphereColumns.h"
 #include "atlas/functionspace/EdgeColumns.h"
+#include "atlas/functionspace/FieldStatistics.h"
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/functionspace/PointCloud.h"
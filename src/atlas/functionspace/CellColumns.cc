@@ -163,9 +163,9 @@ private:
 
     static value_type* create(const Mesh& mesh) {
         value_type* value = new value_type();
-        util::ObjectHandle<parallel::GatherScatter> gather(
-            CellColumnsGatherScatterCache::instance().get_or_create(mesh));
-        value->setup(gather);
+        value->setup(array::make_view<int, 1>(mesh.cells().partition()).data(),
+                     array::make_view<idx_t, 1>(mesh.cells().remote_index()).data(), REMOTE_IDX_BASE,
+                     array::make_view<gidx_t, 1>(mesh.cells().global_index()).data(), mesh.cells().size());
         return value;
     }
 };
@@ -337,7 +337,12 @@ void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exch
         halo_exchange.template execute<float, RANK>(field.array(), on_device);
     }
     else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        if (field.metadata().getString("wire_type", "native") == "float") {
+            halo_exchange.template execute_as<float, double, RANK>(field.array(), on_device);
+        }
+        else {
+            halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        }
     }
     else {
         throw_Exception("datatype not supported", Here());
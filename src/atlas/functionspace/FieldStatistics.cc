@@ -0,0 +1,338 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/FieldStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "atlas/array.h"
+#include "atlas/array/ContiguousArrayView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace functionspace {
+
+namespace {
+
+template <typename T>
+array::LocalView<const T, 3> make_leveled_view(const Field& field) {
+    using namespace array;
+    if (field.levels()) {
+        if (field.variables()) {
+            return make_view<const T, 3>(field).slice(Range::all(), Range::all(), Range::all());
+        }
+        else {
+            return make_view<const T, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+        }
+    }
+    else {
+        if (field.variables()) {
+            return make_view<const T, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+        }
+        else {
+            return make_view<const T, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
+        }
+    }
+}
+
+// Statistics accumulated over a subset of points
+struct Partial {
+    double count{0};
+    double sum{0};
+    double mean{0};  // running mean, only updated when the variance is requested
+    double m2{0};    // sum of squared deviations from the running mean
+    double min{std::numeric_limits<double>::infinity()};
+    double max{-std::numeric_limits<double>::infinity()};
+    gidx_t min_point{-1};  // local index of the point, or its global index once partials of tasks are combined
+    idx_t min_level{-1};
+    gidx_t max_point{-1};
+    idx_t max_level{-1};
+};
+
+// Serialisation of a Partial for the exchange between tasks
+constexpr size_t record_size = 10;
+
+void pack(const Partial& p, std::vector<double>& record) {
+    record.insert(record.end(), {p.count, p.sum, p.mean, p.m2, p.min, p.max, double(p.min_point), double(p.min_level),
+                                 double(p.max_point), double(p.max_level)});
+}
+
+Partial unpack(const double* record) {
+    Partial p;
+    p.count     = record[0];
+    p.sum       = record[1];
+    p.mean      = record[2];
+    p.m2        = record[3];
+    p.min       = record[4];
+    p.max       = record[5];
+    p.min_point = static_cast<gidx_t>(record[6]);
+    p.min_level = static_cast<idx_t>(record[7]);
+    p.max_point = static_cast<gidx_t>(record[8]);
+    p.max_level = static_cast<idx_t>(record[9]);
+    return p;
+}
+
+// Merge partial b, which covers points following those of a, into a.
+// Means and squared deviations are combined with the pairwise update of Chan et al.
+void merge(Partial& a, const Partial& b) {
+    if (b.count == 0) {
+        return;
+    }
+    if (a.count == 0) {
+        a = b;
+        return;
+    }
+    const double count = a.count + b.count;
+    const double delta = b.mean - a.mean;
+    a.mean += delta * (b.count / count);
+    a.m2 += b.m2 + delta * delta * (a.count * b.count / count);
+    a.count = count;
+    a.sum += b.sum;
+    if (b.min < a.min) {
+        a.min       = b.min;
+        a.min_point = b.min_point;
+        a.min_level = b.min_level;
+    }
+    if (b.max > a.max) {
+        a.max       = b.max;
+        a.max_point = b.max_point;
+        a.max_level = b.max_level;
+    }
+}
+
+template <typename View>
+void accumulate(const View& arr, const array::ArrayView<const int, 1>& ghost, idx_t begin, idx_t end, bool per_level,
+                bool variance, std::vector<Partial>& partial) {
+    const idx_t nlev = arr.shape(1);
+    const idx_t nvar = arr.shape(2);
+    for (idx_t n = begin; n < end; ++n) {
+        if (ghost(n)) {
+            continue;
+        }
+        for (idx_t l = 0; l < nlev; ++l) {
+            Partial* p = partial.data() + (per_level ? l * nvar : 0);
+            for (idx_t j = 0; j < nvar; ++j, ++p) {
+                const double x = static_cast<double>(arr(n, l, j));
+                p->count += 1.;
+                p->sum += x;
+                if (variance) {
+                    const double delta = x - p->mean;
+                    p->mean += delta / p->count;
+                    p->m2 += delta * (x - p->mean);
+                }
+                if (x < p->min) {
+                    p->min       = x;
+                    p->min_point = n;
+                    p->min_level = l;
+                }
+                if (x > p->max) {
+                    p->max       = x;
+                    p->max_point = n;
+                    p->max_level = l;
+                }
+            }
+        }
+    }
+}
+
+template <typename View>
+std::vector<Partial> local_statistics_impl(const FunctionSpace& fs, const View& arr, bool per_level, bool variance) {
+    const auto ghost = array::make_view<int, 1>(fs.ghost());
+    const idx_t npts = std::min<idx_t>(arr.shape(0), ghost.shape(0));
+    const idx_t nb_slots = per_level ? arr.shape(1) * arr.shape(2) : arr.shape(2);
+
+    const int nb_threads = atlas_omp_get_max_threads();
+    std::vector<std::vector<Partial>> partials(nb_threads, std::vector<Partial>(nb_slots));
+    atlas_omp_parallel {
+        // Contiguous blocks of points per thread, so that merging thread partials in thread order
+        // retains the point order, which makes locations of extrema independent of the thread count
+        const int thread  = atlas_omp_get_thread_num();
+        const int threads = atlas_omp_get_num_threads();
+        const idx_t begin = static_cast<idx_t>((size_t(npts) * size_t(thread)) / size_t(threads));
+        const idx_t end   = static_cast<idx_t>((size_t(npts) * size_t(thread + 1)) / size_t(threads));
+        accumulate(arr, ghost, begin, end, per_level, variance, partials[thread]);
+    }
+
+    // Pairwise tree merge of thread partials
+    for (int stride = 1; stride < nb_threads; stride *= 2) {
+        atlas_omp_parallel_for(int t = 0; t < nb_threads - stride; t += 2 * stride) {
+            for (idx_t s = 0; s < nb_slots; ++s) {
+                merge(partials[t][s], partials[t + stride][s]);
+            }
+        }
+    }
+    return std::move(partials[0]);
+}
+
+template <typename T>
+std::vector<Partial> local_statistics(const FunctionSpace& fs, const Field& field, bool per_level, bool variance) {
+    const auto arr = make_leveled_view<T>(field);
+    if (field.array().contiguous() && field.stride(field.rank() - 1) == 1) {
+        // Unit stride of the variables, and levels * variables stride of the points, known to the compiler
+        const idx_t shape[] = {arr.shape(0), arr.shape(1), arr.shape(2)};
+        const array::ContiguousArrayView<const T, 3> contiguous_arr(arr.data(), shape);
+        return local_statistics_impl(fs, contiguous_arr, per_level, variance);
+    }
+    return local_statistics_impl(fs, arr, per_level, variance);
+}
+
+std::vector<Partial> local_statistics(const FunctionSpace& fs, const Field& field, bool per_level, bool variance) {
+    switch (field.datatype().kind()) {
+        case array::DataType::KIND_INT32:
+            return local_statistics<int>(fs, field, per_level, variance);
+        case array::DataType::KIND_INT64:
+            return local_statistics<long>(fs, field, per_level, variance);
+        case array::DataType::KIND_REAL32:
+            return local_statistics<float>(fs, field, per_level, variance);
+        case array::DataType::KIND_REAL64:
+            return local_statistics<double>(fs, field, per_level, variance);
+        default:
+            throw_Exception("datatype not supported", Here());
+    }
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------
+
+FieldStatistics::FieldStatistics(const FunctionSpace& functionspace, unsigned statistics, bool per_level):
+    functionspace_(functionspace), statistics_(statistics), per_level_(per_level) {
+    ATLAS_ASSERT(functionspace_);
+}
+
+FieldStatistics::Values FieldStatistics::compute(const Field& field) const {
+    FieldSet fieldset;
+    fieldset.add(field);
+    return compute(fieldset)[0];
+}
+
+std::vector<FieldStatistics::Values> FieldStatistics::compute(const FieldSet& fieldset) const {
+    ATLAS_TRACE("FieldStatistics::compute");
+
+    const bool want_min      = statistics_ & MINIMUM;
+    const bool want_max      = statistics_ & MAXIMUM;
+    const bool want_location = (statistics_ & LOCATION) && (want_min || want_max);
+    const bool want_variance = statistics_ & (VARIANCE | STDDEV);
+
+    // Single sweep over each field
+    std::vector<std::vector<Partial>> partials;
+    std::vector<Values> values(fieldset.size());
+    partials.reserve(fieldset.size());
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        const Field& field = fieldset[f];
+        partials.emplace_back(local_statistics(functionspace_, field, per_level_, want_variance));
+        values[f].levels    = per_level_ ? std::max<idx_t>(field.levels(), 1) : 1;
+        values[f].variables = std::max<idx_t>(field.variables(), 1);
+    }
+
+    // Combine the partials of all tasks with a single collective: every task gathers the partials of all tasks
+    // and merges them in rank order, like the thread partials, so that all tasks obtain identical results.
+    // The gathered buffer holds one record per statistics slot and task.
+    const auto glb_idx = array::make_view<gidx_t, 1>(functionspace_.global_index());
+    std::vector<double> send;
+    for (auto& partial : partials) {
+        for (auto& p : partial) {
+            if (p.min_point >= 0) {
+                p.min_point = glb_idx(static_cast<idx_t>(p.min_point));
+            }
+            if (p.max_point >= 0) {
+                p.max_point = glb_idx(static_cast<idx_t>(p.max_point));
+            }
+            pack(p, send);
+        }
+    }
+    const auto& comm      = mpi::comm();
+    const int nb_tasks    = static_cast<int>(comm.size());
+    const size_t nb_total = send.size() / record_size;
+    std::vector<double> recv(send.size() * nb_tasks);
+    std::vector<int> recvcounts(nb_tasks, static_cast<int>(send.size()));
+    std::vector<int> displs(nb_tasks);
+    for (int task = 0; task < nb_tasks; ++task) {
+        displs[task] = task * static_cast<int>(send.size());
+    }
+    ATLAS_TRACE_MPI(ALLGATHER) {
+        comm.allGatherv(send.begin(), send.end(), recv.begin(), recvcounts.data(), displs.data());
+    }
+    std::vector<Partial> global(nb_total);
+    for (int task = 0; task < nb_tasks; ++task) {
+        for (size_t s = 0; s < nb_total; ++s) {
+            merge(global[s], unpack(recv.data() + (task * nb_total + s) * record_size));
+        }
+    }
+
+    size_t s = 0;
+    for (size_t f = 0; f < partials.size(); ++f) {
+        Values& v              = values[f];
+        const size_t nb_slots  = partials[f].size();
+        auto resize_if         = [nb_slots](bool requested, auto& vector) {
+            if (requested) {
+                vector.resize(nb_slots);
+            }
+        };
+        resize_if(want_min, v.minimum);
+        resize_if(want_max, v.maximum);
+        resize_if(statistics_ & SUM, v.sum);
+        resize_if(statistics_ & MEAN, v.mean);
+        resize_if(statistics_ & VARIANCE, v.variance);
+        resize_if(statistics_ & STDDEV, v.stddev);
+        resize_if(want_location && want_min, v.minimum_glb_idx);
+        resize_if(want_location && want_min, v.minimum_level);
+        resize_if(want_location && want_max, v.maximum_glb_idx);
+        resize_if(want_location && want_max, v.maximum_level);
+
+        for (size_t slot = 0; slot < nb_slots; ++slot, ++s) {
+            const Partial& g   = global[s];
+            const double count = g.count;
+            const double mean  = count > 0 ? g.sum / count : 0.;
+
+            v.N = static_cast<gidx_t>(count);
+            if (want_min) {
+                v.minimum[slot] = g.min;
+            }
+            if (want_max) {
+                v.maximum[slot] = g.max;
+            }
+            if (statistics_ & SUM) {
+                v.sum[slot] = g.sum;
+            }
+            if (statistics_ & MEAN) {
+                v.mean[slot] = mean;
+            }
+            if (statistics_ & VARIANCE) {
+                v.variance[slot] = count > 0 ? g.m2 / count : 0.;
+            }
+            if (statistics_ & STDDEV) {
+                v.stddev[slot] = count > 0 ? std::sqrt(g.m2 / count) : 0.;
+            }
+            if (want_location && want_min) {
+                v.minimum_glb_idx[slot] = g.min_point;
+                v.minimum_level[slot]   = g.min_level;
+            }
+            if (want_location && want_max) {
+                v.maximum_glb_idx[slot] = g.max_point;
+                v.maximum_level[slot]   = g.max_level;
+            }
+        }
+    }
+    return values;
+}
+
+// -------------------------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
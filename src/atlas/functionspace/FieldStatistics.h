@@ -0,0 +1,108 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/library/config.h"
+
+namespace atlas {
+class Field;
+class FieldSet;
+}  // namespace atlas
+
+namespace atlas {
+namespace functionspace {
+
+// -------------------------------------------------------------------------------------
+
+/// @brief Compute a set of statistics of fields in a single pass
+///
+/// All requested statistics of a field are computed in one sweep over the field data, instead of
+/// one sweep per statistic. Thread partials are merged pairwise in a tree. The partials of all MPI
+/// tasks are then exchanged with a single allGatherv, regardless of the number of statistics or the
+/// number of fields in a FieldSet, and every task merges them in rank order, so that all tasks obtain
+/// identical results. Means and variances are merged with the pairwise update of Chan et al.
+/// The gathered buffer holds 10 values per task and per statistics slot (variable, or level and
+/// variable with per_level), on every task.
+///
+/// Only owned points (ghost == 0) of the function space contribute, so this works for any function
+/// space that provides ghost() and global_index(), such as NodeColumns and StructuredColumns.
+///
+/// Statistics are computed in double precision for any field datatype. Without the per_level option,
+/// values are reduced over points and levels, separately for each field variable.
+/// With the per_level option, values are only reduced over points.
+///
+/// Example:
+/// @code{.cpp}
+///     functionspace::FieldStatistics statistics(fs, FieldStatistics::MINIMUM | FieldStatistics::MAXIMUM |
+///                                                   FieldStatistics::MEAN | FieldStatistics::STDDEV);
+///     auto result = statistics.compute(fieldset);
+///     Log::info() << result[0].mean[0] << std::endl;
+/// @endcode
+class FieldStatistics {
+public:
+    enum Statistic : unsigned
+    {
+        MINIMUM  = (1 << 0),
+        MAXIMUM  = (1 << 1),
+        SUM      = (1 << 2),
+        MEAN     = (1 << 3),
+        VARIANCE = (1 << 4),
+        STDDEV   = (1 << 5),
+        LOCATION = (1 << 6),  ///< Also compute global index and level of minimum and/or maximum
+        ALL      = MINIMUM | MAXIMUM | SUM | MEAN | VARIANCE | STDDEV | LOCATION
+    };
+
+    /// @brief Statistics of one field
+    ///
+    /// Each vector has one entry per variable, or, with the per_level option, one entry per
+    /// level and variable, accessible with index(level, variable).
+    /// Vectors of statistics that were not requested are empty.
+    struct Values {
+        idx_t levels{1};  ///< number of levels in the output (1 unless per_level)
+        idx_t variables{1};
+        gidx_t N{0};  ///< number of values that contribute to each entry
+
+        std::vector<double> minimum;
+        std::vector<double> maximum;
+        std::vector<double> sum;
+        std::vector<double> mean;
+        std::vector<double> variance;
+        std::vector<double> stddev;
+
+        std::vector<gidx_t> minimum_glb_idx;
+        std::vector<idx_t> minimum_level;
+        std::vector<gidx_t> maximum_glb_idx;
+        std::vector<idx_t> maximum_level;
+
+        idx_t index(idx_t level, idx_t variable = 0) const { return level * variables + variable; }
+    };
+
+public:
+    FieldStatistics(const FunctionSpace&, unsigned statistics = ALL, bool per_level = false);
+
+    Values compute(const Field&) const;
+
+    /// @brief Compute statistics for all fields at once, with a single MPI collective
+    std::vector<Values> compute(const FieldSet&) const;
+
+private:
+    FunctionSpace functionspace_;
+    unsigned statistics_;
+    bool per_level_;
+};
+
+// -------------------------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
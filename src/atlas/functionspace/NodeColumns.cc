@@ -11,12 +11,16 @@
 //#include <cstdarg>
 //#include <functional>
 
+#include <algorithm>
+#include <vector>
+
 #include "eckit/utils/MD5.h"
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/detail/AggregatedHaloExchange.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -188,9 +192,15 @@ private:
 
     static value_type* create(const Mesh& mesh) {
         value_type* value = new value_type();
-        util::ObjectHandle<parallel::GatherScatter> gather(
-            NodeColumnsGatherScatterCache::instance().get_or_create(mesh));
-        value->setup(gather);
+
+        mesh::IsGhostNode is_ghost(mesh.nodes());
+        std::vector<int> mask(mesh.nodes().size());
+        const idx_t npts = mask.size();
+        atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) { mask[n] = is_ghost(n) ? 1 : 0; }
+
+        value->setup(array::make_view<int, 1>(mesh.nodes().partition()).data(),
+                     array::make_view<idx_t, 1>(mesh.nodes().remote_index()).data(), REMOTE_IDX_BASE,
+                     array::make_view<gidx_t, 1>(mesh.nodes().global_index()).data(), mask.data(), mesh.nodes().size());
         return value;
     }
 };
@@ -350,7 +360,12 @@ void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exch
         halo_exchange.template execute<float, RANK>(field.array(), on_device);
     }
     else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        if (field.metadata().getString("wire_type", "native") == "float") {
+            halo_exchange.template execute_as<float, double, RANK>(field.array(), on_device);
+        }
+        else {
+            halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        }
     }
     else {
         throw_Exception("datatype not supported", Here());
@@ -381,8 +396,15 @@ void dispatch_adjointHaloExchange(Field& field, const parallel::HaloExchange& ha
 }  // namespace
 
 void NodeColumns::haloExchange(const FieldSet& fieldset, bool on_device) const {
+    std::vector<Field> fields;
+    fields.reserve(fieldset.size());
     for (idx_t f = 0; f < fieldset.size(); ++f) {
-        Field& field = const_cast<FieldSet&>(fieldset)[f];
+        fields.emplace_back(fieldset[f]);
+    }
+    if (!on_device) {
+        aggregated_haloExchange(fields, halo_exchange());
+    }
+    for (auto& field : fields) {
         switch (field.rank()) {
             case 1:
                 dispatch_haloExchange<1>(field, halo_exchange(), on_device);
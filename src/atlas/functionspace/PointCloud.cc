@@ -242,7 +242,12 @@ void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exch
         halo_exchange.template execute<float, RANK>(field.array(), on_device);
     }
     else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        if (field.metadata().getString("wire_type", "native") == "float") {
+            halo_exchange.template execute_as<float, double, RANK>(field.array(), on_device);
+        }
+        else {
+            halo_exchange.template execute<double, RANK>(field.array(), on_device);
+        }
     }
     else {
         throw_Exception("datatype not supported", Here());
@@ -10,9 +10,42 @@
 
 #include "atlas/functionspace/StructuredColumns.h"
 
+#include <string>
+
+#include "atlas/grid/Distribution.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/SharedObjects.h"
+
 namespace atlas {
 namespace functionspace {
 
+namespace {
+class SharedStructuredColumns : public util::SharedObjects::Cache<detail::StructuredColumns> {
+    SharedStructuredColumns(): Cache("SharedStructuredColumns") {}
+
+public:
+    static SharedStructuredColumns& instance() {
+        static SharedStructuredColumns inst;
+        return inst;
+    }
+};
+
+// Function space shared with equal earlier requests when util::SharedObjects are enabled
+template <typename Key, typename Create>
+const detail::StructuredColumns* create_shared(const Key& key, const Create& create) {
+    if (not util::SharedObjects::enabled()) {
+        return create();
+    }
+    return SharedStructuredColumns::instance().get_or_create(key(), create).get();
+}
+
+std::string shared_key(const Grid& grid, const std::string& distribution, const eckit::Configuration& config) {
+    return "grid=" + grid.uid() + ";distribution=" + distribution + ";config=" + util::Config(config).json() +
+           ";mpi_comm=" + mpi::comm().name() + ";mpi_size=" + std::to_string(mpi::size());
+}
+}  // namespace
+
 // ----------------------------------------------------------------------------
 
 StructuredColumns::StructuredColumns(): FunctionSpace(), functionspace_(nullptr) {}
@@ -21,17 +54,28 @@ StructuredColumns::StructuredColumns(const FunctionSpace& functionspace):
     FunctionSpace(functionspace), functionspace_(dynamic_cast<const detail::StructuredColumns*>(get())) {}
 
 StructuredColumns::StructuredColumns(const Grid& grid, const eckit::Configuration& config):
-    FunctionSpace(new detail::StructuredColumns(grid, config)),
+    FunctionSpace(create_shared([&]() { return shared_key(grid, "default", config); },
+                                [&]() { return new detail::StructuredColumns(grid, config); })),
     functionspace_(dynamic_cast<const detail::StructuredColumns*>(get())) {}
 
 StructuredColumns::StructuredColumns(const Grid& grid, const grid::Partitioner& partitioner,
                                      const eckit::Configuration& config):
-    FunctionSpace(new detail::StructuredColumns(grid, partitioner, config)),
+    FunctionSpace([&]() -> const detail::StructuredColumns* {
+        if (not partitioner || not util::SharedObjects::enabled()) {
+            return create_shared([&]() { return shared_key(grid, "default", config); },
+                                 [&]() { return new detail::StructuredColumns(grid, partitioner, config); });
+        }
+        // A partitioner is only identified by the distribution it creates
+        grid::Distribution distribution(grid, partitioner);
+        return create_shared([&]() { return shared_key(grid, distribution.hash(), config); },
+                             [&]() { return new detail::StructuredColumns(grid, distribution, config); });
+    }()),
     functionspace_(dynamic_cast<const detail::StructuredColumns*>(get())) {}
 
 StructuredColumns::StructuredColumns(const Grid& grid, const grid::Distribution& distribution,
                                      const eckit::Configuration& config):
-    FunctionSpace(new detail::StructuredColumns(grid, distribution, config)),
+    FunctionSpace(create_shared([&]() { return shared_key(grid, distribution.hash(), config); },
+                                [&]() { return new detail::StructuredColumns(grid, distribution, config); })),
     functionspace_(dynamic_cast<const detail::StructuredColumns*>(get())) {}
 
 StructuredColumns::StructuredColumns(const Grid& grid, const Vertical& vertical, const eckit::Configuration& config):
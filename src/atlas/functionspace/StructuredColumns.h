@@ -53,6 +53,8 @@ public:
     std::string checksum(const FieldSet&) const;
     std::string checksum(const Field&) const;
 
+    const parallel::HaloExchange& halo_exchange() const { return functionspace_->halo_exchange(); }
+
     idx_t index(idx_t i, idx_t j) const { return functionspace_->index(i, j); }
 
     idx_t i_begin(idx_t j) const { return functionspace_->i_begin(j); }
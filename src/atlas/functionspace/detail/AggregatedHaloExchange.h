@@ -0,0 +1,67 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "atlas/array/Array.h"
+#include "atlas/array/DataType.h"
+#include "atlas/field/Field.h"
+#include "atlas/parallel/HaloExchange.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+// Exchange halos of host fields with the same datatype together, with one message per partition
+// instead of one per field. Exchanged fields are removed from the list.
+// Fields with a non-native wire type are left to be exchanged one by one, as are vector fields
+// when exclude_vectors is set, because their halos need fixing up after the exchange.
+template <typename DATATYPE>
+void aggregated_haloExchange(std::vector<Field>& fields, const parallel::HaloExchange& halo_exchange,
+                             bool exclude_vectors) {
+    std::vector<array::Array*> arrays;
+    for (auto& field : fields) {
+        if (field.datatype() == array::DataType::kind<DATATYPE>() && field.rank() <= 4 &&
+            field.metadata().getString("wire_type", "native") == "native" &&
+            !(exclude_vectors && field.metadata().getString("type", "scalar") == "vector")) {
+            arrays.push_back(&field.array());
+        }
+    }
+    if (arrays.size() < 2) {
+        return;
+    }
+    halo_exchange.template execute<DATATYPE>(arrays);
+
+    std::vector<Field> remaining;
+    for (auto& field : fields) {
+        if (std::find(arrays.begin(), arrays.end(), &field.array()) != arrays.end()) {
+            field.set_dirty(false);
+        }
+        else {
+            remaining.push_back(field);
+        }
+    }
+    fields.swap(remaining);
+}
+
+inline void aggregated_haloExchange(std::vector<Field>& fields, const parallel::HaloExchange& halo_exchange,
+                                    bool exclude_vectors = false) {
+    aggregated_haloExchange<int>(fields, halo_exchange, exclude_vectors);
+    aggregated_haloExchange<long>(fields, halo_exchange, exclude_vectors);
+    aggregated_haloExchange<float>(fields, halo_exchange, exclude_vectors);
+    aggregated_haloExchange<double>(fields, halo_exchange, exclude_vectors);
+}
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -13,6 +13,8 @@
 #include <cstdarg>
 #include <functional>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
@@ -24,6 +26,7 @@
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/ReproducibleSum.h"
 
 
 #undef atlas_omp_critical_ordered
@@ -300,42 +303,110 @@ void sum_per_level(const NodeColumns& fs, const Field& field, Field& sum, idx_t&
     }
 }
 
-template <typename DATATYPE>
-void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field, DATATYPE& result, idx_t& N) {
-    idx_t root   = 0;
-    Field global = fs.createField(field, option::global());
-    fs.gather(field, global);
-    result   = 0;
-    auto glb = array::make_view<DATATYPE, 1>(global);
-    for (idx_t jnode = 0; jnode < glb.size(); ++jnode) {
-        result += glb(jnode);
+// Order independent sums are computed without gathering the field: each task accumulates its owned values
+// exactly (util::ReproducibleSum for floating point values; integer addition is associative), and the
+// partial sums are combined with an allReduce. The result is therefore bitwise identical for any number
+// of MPI tasks and OpenMP threads.
+template <typename T, typename SumIndex>
+void reproducible_local_sum(const NodeColumns& fs, const array::LocalView<const T, 3>& arr, SumIndex sum_index,
+                            std::vector<util::ReproducibleSum>& sum) {
+    const mesh::IsGhostNode is_ghost(fs.nodes());
+    const idx_t npts = std::min<idx_t>(arr.shape(0), fs.nb_nodes());
+    const idx_t nlev = arr.shape(1);
+    const idx_t nvar = arr.shape(2);
+    atlas_omp_parallel {
+        std::vector<util::ReproducibleSum> thread_sum(sum.size());
+        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
+            if (!is_ghost(n)) {
+                for (idx_t l = 0; l < nlev; ++l) {
+                    for (idx_t j = 0; j < nvar; ++j) {
+                        thread_sum[sum_index(l, j)].add(arr(n, l, j));
+                    }
+                }
+            }
+        }
+        atlas_omp_critical {
+            for (size_t s = 0; s < sum.size(); ++s) {
+                sum[s] += thread_sum[s];
+            }
+        }
     }
-    ATLAS_TRACE_MPI(BROADCAST) { mpi::comm().broadcast(&result, 1, root); }
-    N = fs.nb_nodes_global();
 }
 
-template <typename T>
-void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
-    if (field.levels()) {
-        auto arr = make_leveled_scalar_view<const T>(field);
-
-        Field surface_field = fs.createField<T>(option::name("surface") | option::levels(false));
-        auto surface        = array::make_view<T, 1>(surface_field);
-
-        const idx_t N0 = std::min(surface.shape(0), arr.shape(0));
-        const idx_t N1 = arr.shape(1);
-        for (idx_t n = 0; n < N0; ++n) {
-            surface(n) = 0;
-            for (idx_t l = 0; l < N1; ++l) {
-                surface(n) += arr(n, l);
+template <typename T, typename SumIndex>
+void reproducible_local_sum(const NodeColumns& fs, const array::LocalView<const T, 3>& arr, SumIndex sum_index,
+                            std::vector<T>& sum) {
+    const mesh::IsGhostNode is_ghost(fs.nodes());
+    const idx_t npts = std::min<idx_t>(arr.shape(0), fs.nb_nodes());
+    const idx_t nlev = arr.shape(1);
+    const idx_t nvar = arr.shape(2);
+    atlas_omp_parallel {
+        std::vector<T> thread_sum(sum.size(), 0);
+        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
+            if (!is_ghost(n)) {
+                for (idx_t l = 0; l < nlev; ++l) {
+                    for (idx_t j = 0; j < nvar; ++j) {
+                        thread_sum[sum_index(l, j)] += arr(n, l, j);
+                    }
+                }
+            }
+        }
+        atlas_omp_critical {
+            for (size_t s = 0; s < sum.size(); ++s) {
+                sum[s] += thread_sum[s];
             }
         }
-        dispatch_order_independent_sum_2d(fs, surface_field, result, N);
-        N *= arr.shape(1);
     }
-    else {
-        dispatch_order_independent_sum_2d(fs, field, result, N);
+}
+
+template <typename T, typename SumIndex>
+std::vector<T> reproducible_sum(const NodeColumns& fs, const array::LocalView<const T, 3>& arr, size_t nb_sums,
+                                SumIndex sum_index, std::true_type /*floating point*/) {
+    std::vector<util::ReproducibleSum> sum(nb_sums);
+    reproducible_local_sum(fs, arr, sum_index, sum);
+
+    constexpr size_t nb_limbs = util::ReproducibleSum::size();
+    std::vector<util::ReproducibleSum::limb_t> limbs(nb_sums * nb_limbs);
+    std::vector<double> nonfinite(nb_sums);
+    for (size_t s = 0; s < nb_sums; ++s) {
+        sum[s].normalise();
+        std::copy(sum[s].data(), sum[s].data() + nb_limbs, limbs.data() + s * nb_limbs);
+        nonfinite[s] = sum[s].nonfinite();
     }
+    ATLAS_TRACE_MPI(ALLREDUCE) {
+        mpi::comm().allReduceInPlace(limbs.data(), limbs.size(), eckit::mpi::sum());
+        mpi::comm().allReduceInPlace(nonfinite.data(), nonfinite.size(), eckit::mpi::sum());
+    }
+
+    std::vector<T> result(nb_sums);
+    for (size_t s = 0; s < nb_sums; ++s) {
+        std::copy(limbs.data() + s * nb_limbs, limbs.data() + (s + 1) * nb_limbs, sum[s].data());
+        sum[s].nonfinite() = nonfinite[s];
+        result[s]          = static_cast<T>(sum[s].value());
+    }
+    return result;
+}
+
+template <typename T, typename SumIndex>
+std::vector<T> reproducible_sum(const NodeColumns& fs, const array::LocalView<const T, 3>& arr, size_t nb_sums,
+                                SumIndex sum_index, std::false_type /*integral*/) {
+    std::vector<T> sum(nb_sums, 0);
+    reproducible_local_sum(fs, arr, sum_index, sum);
+    ATLAS_TRACE_MPI(ALLREDUCE) { mpi::comm().allReduceInPlace(sum.data(), sum.size(), eckit::mpi::sum()); }
+    return sum;
+}
+
+template <typename T, typename SumIndex>
+std::vector<T> reproducible_sum(const NodeColumns& fs, const array::LocalView<const T, 3>& arr, size_t nb_sums,
+                                SumIndex sum_index) {
+    return reproducible_sum(fs, arr, nb_sums, sum_index, std::is_floating_point<T>());
+}
+
+template <typename T>
+void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
+    const auto arr = make_leveled_view<const T>(field);
+    result         = reproducible_sum(fs, arr, 1, [](idx_t, idx_t) { return 0; })[0];
+    N              = fs.nb_nodes_global() * arr.shape(1);
 }
 
 template <typename T>
@@ -375,61 +446,11 @@ void order_independent_sum(const NodeColumns& fs, const Field& field, T& result,
     }
 }
 
-template <typename DATATYPE>
-void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field, std::vector<DATATYPE>& result,
-                                       idx_t& N) {
-    idx_t nvar = field.variables();
-    result.resize(nvar);
-    for (idx_t j = 0; j < nvar; ++j) {
-        result[j] = 0.;
-    }
-    Field global = fs.createField(field, option::name("global") | option::global());
-    fs.gather(field, global);
-    if (mpi::rank() == 0) {
-        const auto glb = make_surface_view<DATATYPE>(global);
-        for (idx_t n = 0; n < fs.nb_nodes_global(); ++n) {
-            for (idx_t j = 0; j < nvar; ++j) {
-                result[j] += glb(n, j);
-            }
-        }
-    }
-    idx_t root = global.metadata().get<idx_t>("owner");
-    ATLAS_TRACE_MPI(BROADCAST) { mpi::comm().broadcast(result, root); }
-    N = fs.nb_nodes_global();
-}
-
 template <typename T>
 void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, std::vector<T>& result, idx_t& N) {
-    if (field.levels()) {
-        const auto arr   = make_leveled_view<const T>(field);
-        const idx_t npts = std::min(arr.shape(0), fs.nb_nodes());
-        const idx_t nlev = arr.shape(1);
-        const idx_t nvar = arr.shape(2);
-
-        Field surface_field =
-            fs.createField<T>(option::name("surface") | option::variables(nvar) | option::levels(false));
-        auto surface = make_surface_view<T>(surface_field);
-
-        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
-            for (idx_t j = 0; j < nvar; ++j) {
-                surface(n, j) = 0;
-            }
-        }
-
-        for (idx_t n = 0; n < npts; ++n) {
-            for (idx_t l = 0; l < nlev; ++l) {
-                for (idx_t j = 0; j < nvar; ++j) {
-                    surface(n, j) += arr(n, l, j);
-                }
-            }
-        }
-
-        dispatch_order_independent_sum_2d(fs, surface_field, result, N);
-        N *= arr.shape(1);
-    }
-    else {
-        dispatch_order_independent_sum_2d(fs, field, result, N);
-    }
+    const auto arr = make_leveled_view<const T>(field);
+    result         = reproducible_sum(fs, arr, arr.shape(2), [](idx_t, idx_t j) { return j; });
+    N              = fs.nb_nodes_global() * arr.shape(1);
 }
 
 template <typename T>
@@ -478,46 +499,15 @@ void dispatch_order_independent_sum_per_level(const NodeColumns& fs, const Field
     }
     sumfield.resize(shape);
 
+    const auto arr   = make_leveled_view<const T>(field);
+    const idx_t nvar = arr.shape(2);
+    auto result = reproducible_sum(fs, arr, arr.shape(1) * nvar, [nvar](idx_t l, idx_t j) { return l * nvar + j; });
+
     auto sum = make_per_level_view<T>(sumfield);
+    idx_t c(0);
     for (idx_t l = 0; l < sum.shape(0); ++l) {
         for (idx_t j = 0; j < sum.shape(1); ++j) {
-            sum(l, j) = 0.;
-        }
-    }
-
-    idx_t root   = 0;
-    Field global = fs.createField(field, option::name("global") | option::global());
-
-    fs.gather(field, global);
-    if (mpi::rank() == 0) {
-        const array::LocalView<T, 3> glb = make_leveled_view<T>(global);
-
-        for (idx_t n = 0; n < glb.shape(0); ++n) {
-            for (idx_t l = 0; l < glb.shape(1); ++l) {
-                for (idx_t j = 0; j < glb.shape(2); ++j) {
-                    sum(l, j) += glb(n, l, j);
-                }
-            }
-        }
-    }
-    ATLAS_TRACE_MPI(BROADCAST) {
-        std::vector<T> sum_array(sumfield.size());
-        if (mpi::rank() == root) {
-            idx_t c(0);
-            for (idx_t l = 0; l < sum.shape(0); ++l) {
-                for (idx_t j = 0; j < sum.shape(1); ++j) {
-                    sum_array[c++] = sum(l, j);
-                }
-            }
-        }
-        mpi::comm().broadcast(sum_array, root);
-        if (mpi::rank() != root) {
-            idx_t c(0);
-            for (idx_t l = 0; l < sum.shape(0); ++l) {
-                for (idx_t j = 0; j < sum.shape(1); ++j) {
-                    sum(l, j) = sum_array[c++];
-                }
-            }
+            sum(l, j) = result[c++];
         }
     }
     N = fs.nb_nodes_global();
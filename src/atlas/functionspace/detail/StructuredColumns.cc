@@ -10,11 +10,13 @@
 
 #include "atlas/functionspace/StructuredColumns.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "eckit/utils/MD5.h"
 
@@ -22,6 +24,7 @@
 #include "atlas/array/MakeView.h"
 #include "atlas/domain.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/detail/AggregatedHaloExchange.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/StructuredGrid.h"
@@ -38,6 +41,7 @@
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/Checksum.h"
 #include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/SharedObjects.h"
 #include "atlas/util/detail/Cache.h"
 
 #define REMOTE_IDX_BASE 0
@@ -112,6 +116,7 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
+            << ",halo_by_partition=" << funcspace.halo_by_partition_
             << ",distribution=" << funcspace.distribution() << "]";
         return key.str();
     }
@@ -160,6 +165,7 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
+            << ",halo_by_partition=" << funcspace.halo_by_partition_
             << ",distribution=" << funcspace.distribution() << "]";
         return key.str();
     }
@@ -208,6 +214,7 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
+            << ",halo_by_partition=" << funcspace.halo_by_partition_
             << ",distribution=" << funcspace.distribution() << "]";
         return key.str();
     }
@@ -224,9 +231,9 @@ private:
 
     static value_type* create(const detail::StructuredColumns* funcspace) {
         value_type* value = new value_type();
-        util::ObjectHandle<parallel::GatherScatter> gather(
-            StructuredColumnsGatherScatterCache::instance().get_or_create(*funcspace));
-        value->setup(gather);
+        value->setup(array::make_view<int, 1>(funcspace->partition()).data(),
+                     array::make_view<idx_t, 1>(funcspace->remote_index()).data(), REMOTE_IDX_BASE,
+                     array::make_view<gidx_t, 1>(funcspace->global_index()).data(), funcspace->sizeOwned());
         return value;
     }
     ~StructuredColumnsChecksumCache() override = default;
@@ -433,24 +440,36 @@ StructuredColumns::StructuredColumns(const Grid& grid, const Vertical& vertical,
     vertical_(vertical), nb_levels_(vertical_.size()), grid_(new StructuredGrid(grid)) {
     ATLAS_TRACE("StructuredColumns constructor");
 
-    grid::Partitioner partitioner(p);
-    if (not partitioner) {
+    grid::Distribution distribution;
+    if (not p && util::SharedObjects::enabled()) {
+        // Partitioner fully specified by configuration, so that the distribution can be shared
+        util::Config partitioner_config;
         if (config.has("partitioner")) {
-            partitioner = grid::Partitioner(config.getSubConfiguration("partitioner"));
+            partitioner_config = config.getSubConfiguration("partitioner");
         }
         else {
-            if (grid_->domain().global()) {
-                partitioner = grid::Partitioner("equal_regions");
+            partitioner_config.set("type", grid_->domain().global() ? "equal_regions" : "checkerboard");
+        }
+        ATLAS_TRACE_SCOPE("Partitioning grid") { distribution = grid::Distribution(grid, partitioner_config); }
+    }
+    else {
+        grid::Partitioner partitioner(p);
+        if (not partitioner) {
+            if (config.has("partitioner")) {
+                partitioner = grid::Partitioner(config.getSubConfiguration("partitioner"));
             }
             else {
-                partitioner = grid::Partitioner("checkerboard");
+                if (grid_->domain().global()) {
+                    partitioner = grid::Partitioner("equal_regions");
+                }
+                else {
+                    partitioner = grid::Partitioner("checkerboard");
+                }
             }
         }
+        ATLAS_TRACE_SCOPE("Partitioning grid") { distribution = grid::Distribution(grid, partitioner); }
     }
 
-    grid::Distribution distribution;
-    ATLAS_TRACE_SCOPE("Partitioning grid") { distribution = grid::Distribution(grid, partitioner); }
-
     setup(distribution, config);
 }
 
@@ -756,7 +775,12 @@ void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exch
         fixup_halos.template apply<float>(field);
     }
     else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), false);
+        if (field.metadata().getString("wire_type", "native") == "float") {
+            halo_exchange.template execute_as<float, double, RANK>(field.array(), false);
+        }
+        else {
+            halo_exchange.template execute<double, RANK>(field.array(), false);
+        }
         fixup_halos.template apply<double>(field);
     }
     else {
@@ -794,8 +818,13 @@ void dispatch_adjointHaloExchange(Field& field, const parallel::HaloExchange& ha
 }  // namespace
 
 void StructuredColumns::haloExchange(const FieldSet& fieldset, bool) const {
+    std::vector<Field> fields;
+    fields.reserve(fieldset.size());
     for (idx_t f = 0; f < fieldset.size(); ++f) {
-        Field& field = const_cast<FieldSet&>(fieldset)[f];
+        fields.emplace_back(fieldset[f]);
+    }
+    aggregated_haloExchange(fields, halo_exchange(), true);
+    for (auto& field : fields) {
         switch (field.rank()) {
             case 1:
                 dispatch_haloExchange<1>(field, halo_exchange(), *this);
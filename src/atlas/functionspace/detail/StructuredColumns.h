@@ -213,6 +213,7 @@ private:  // data
     friend class StructuredColumnsGatherScatterCache;
     friend class StructuredColumnsChecksumCache;
     bool periodic_points_{false};
+    bool halo_by_partition_{false};
 
     const StructuredGrid* grid_;
     mutable util::ObjectHandle<parallel::GatherScatter> gather_scatter_;
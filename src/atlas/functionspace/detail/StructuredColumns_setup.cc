@@ -10,11 +10,12 @@
 
 #include "atlas/functionspace/StructuredColumns.h"
 
-#include <functional>
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "atlas/array/MakeView.h"
 #include "atlas/field/FieldSet.h"
@@ -87,6 +88,7 @@ public:
 
 void StructuredColumns::setup(const grid::Distribution& distribution, const eckit::Configuration& config) {
     config.get("periodic_points", periodic_points_);
+    config.get("halo_by_partition", halo_by_partition_);
     if (not(*grid_)) {
         throw_Exception("Grid is not a grid::Structured type", Here());
     }
@@ -127,93 +129,34 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
             owned = grid_->size();
         }
         else {
-            size_t num_threads = atlas_omp_get_max_threads();
-            if (num_threads == 1) {
-                idx_t c(0);
-                for (idx_t j = 0; j < grid_->ny(); ++j) {
-                    for (idx_t i = 0; i < grid_->nx(j); ++i, ++c) {
+            // Rows are scanned independently, each writing only its own bounds
+            atlas_omp_parallel {
+                idx_t thread_j_begin = std::numeric_limits<idx_t>::max();
+                idx_t thread_j_end   = std::numeric_limits<idx_t>::min();
+                idx_t thread_owned   = 0;
+                atlas_omp_for(idx_t j = 0; j < grid_->ny(); ++j) {
+                    const idx_t nx  = grid_->nx(j);
+                    gidx_t c        = grid_->index(0, j);
+                    idx_t row_begin = std::numeric_limits<idx_t>::max();
+                    idx_t row_end   = std::numeric_limits<idx_t>::min();
+                    for (idx_t i = 0; i < nx; ++i, ++c) {
                         if (distribution.partition(c) == mpi_rank) {
-                            j_begin_    = std::min<idx_t>(j_begin_, j);
-                            j_end_      = std::max<idx_t>(j_end_, j + 1);
-                            i_begin_[j] = std::min<idx_t>(i_begin_[j], i);
-                            i_end_[j]   = std::max<idx_t>(i_end_[j], i + 1);
-                            ++owned;
+                            row_begin = std::min<idx_t>(row_begin, i);
+                            row_end   = std::max<idx_t>(row_end, i + 1);
+                            ++thread_owned;
                         }
                     }
-                }
-            }
-            else {
-                std::vector<idx_t> thread_reduce_j_begin(num_threads, std::numeric_limits<idx_t>::max());
-                std::vector<idx_t> thread_reduce_j_end(num_threads, std::numeric_limits<idx_t>::min());
-                std::vector<std::vector<idx_t>> thread_reduce_i_begin(
-                    grid_->ny(), std::vector<idx_t>(num_threads, std::numeric_limits<idx_t>::max()));
-                std::vector<std::vector<idx_t>> thread_reduce_i_end(
-                    grid_->ny(), std::vector<idx_t>(num_threads, std::numeric_limits<idx_t>::min()));
-                std::vector<idx_t> thread_reduce_owned(num_threads, 0);
-                atlas_omp_parallel {
-                    const idx_t thread_num = atlas_omp_get_thread_num();
-                    const idx_t begin =
-                        static_cast<int>(size_t(thread_num) * size_t(grid_->size()) / size_t(num_threads));
-                    const idx_t end =
-                        static_cast<int>(size_t(thread_num + 1) * size_t(grid_->size()) / size_t(num_threads));
-                    idx_t thread_j_begin = 0;
-                    std::vector<idx_t> thread_i_begin(grid_->ny());
-                    std::vector<idx_t> thread_i_end(grid_->ny());
-                    idx_t n = 0;
-                    for (idx_t j = 0; j < grid_->ny(); ++j) {
-                        if (n + grid_->nx(j) > begin) {
-                            thread_j_begin    = j;
-                            thread_i_begin[j] = begin - n;
-                            break;
-                        }
-                        n += grid_->nx(j);
-                    }
-                    idx_t thread_j_end{thread_j_begin};
-                    for (idx_t j = thread_j_begin; j < grid_->ny(); ++j) {
-                        idx_t i_end = end - n;
-                        if (j > thread_j_begin) {
-                            thread_i_begin[j] = 0;
-                        }
-                        if (i_end > grid_->nx(j)) {
-                            thread_i_end[j] = grid_->nx(j);
-                            n += grid_->nx(j);
-                        }
-                        else {
-                            thread_i_end[j] = i_end;
-                            thread_j_end    = j + 1;
-                            break;
-                        }
-                    }
-                    auto& __j_begin = thread_reduce_j_begin[thread_num];
-                    auto& __j_end   = thread_reduce_j_end[thread_num];
-                    auto& __owned   = thread_reduce_owned[thread_num];
-                    idx_t c         = begin;
-
-                    for (idx_t j = thread_j_begin; j < thread_j_end; ++j) {
-                        auto& __i_begin = thread_reduce_i_begin[j][thread_num];
-                        auto& __i_end   = thread_reduce_i_end[j][thread_num];
-                        bool j_in_partition{false};
-                        for (idx_t i = thread_i_begin[j]; i < thread_i_end[j]; ++i, ++c) {
-                            if (distribution.partition(c) == mpi_rank) {
-                                j_in_partition = true;
-                                __i_begin      = std::min<idx_t>(__i_begin, i);
-                                __i_end        = std::max<idx_t>(__i_end, i + 1);
-                                ++__owned;
-                            }
-                        }
-                        if (j_in_partition) {
-                            __j_begin = std::min<idx_t>(__j_begin, j);
-                            __j_end   = std::max<idx_t>(__j_end, j + 1);
-                        }
+                    if (row_end > row_begin) {
+                        i_begin_[j]    = row_begin;
+                        i_end_[j]      = row_end;
+                        thread_j_begin = std::min<idx_t>(thread_j_begin, j);
+                        thread_j_end   = std::max<idx_t>(thread_j_end, j + 1);
                     }
-                    ATLAS_ASSERT(c == end);
                 }
-                owned    = std::accumulate(thread_reduce_owned.begin(), thread_reduce_owned.end(), 0);
-                j_begin_ = *std::min_element(thread_reduce_j_begin.begin(), thread_reduce_j_begin.end());
-                j_end_   = *std::max_element(thread_reduce_j_end.begin(), thread_reduce_j_end.end());
-                atlas_omp_parallel_for(idx_t j = j_begin_; j < j_end_; ++j) {
-                    i_begin_[j] = *std::min_element(thread_reduce_i_begin[j].begin(), thread_reduce_i_begin[j].end());
-                    i_end_[j]   = *std::max_element(thread_reduce_i_end[j].begin(), thread_reduce_i_end[j].end());
+                atlas_omp_critical {
+                    j_begin_ = std::min<idx_t>(j_begin_, thread_j_begin);
+                    j_end_   = std::max<idx_t>(j_end_, thread_j_end);
+                    owned += thread_owned;
                 }
             }
         }
@@ -254,10 +197,12 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
         return i;
     };
 
-    std::function<idx_t(idx_t)> compute_j;
-    compute_j = [this, &compute_j, &periodic_y](idx_t j) -> idx_t {
+    const bool north_pole_row = grid_->y(0) == 90.;
+    const bool south_pole_row = grid_->y(grid_->ny() - 1) == -90.;
+
+    auto compute_j = [this, periodic_y, north_pole_row, south_pole_row](idx_t j) -> idx_t {
+        const idx_t ny = grid_->ny();
         if (periodic_y) {
-            const idx_t ny = grid_->ny();
             while (j < 0) {
                 j += ny;
             }
@@ -266,15 +211,15 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
             }
         }
         else {
-            if (j < 0) {
-                j = (grid_->y(0) == 90.) ? -j : -j - 1;
-            }
-            else if (j >= grid_->ny()) {
-                idx_t jlast = grid_->ny() - 1;
-                j           = (grid_->y(jlast) == -90.) ? jlast - 1 - (j - grid_->ny()) : jlast - (j - grid_->ny());
-            }
-            if (j < 0 or j >= grid_->ny()) {
-                j = compute_j(j);
+            // Reflect across the poles until inside the grid
+            const idx_t jlast = ny - 1;
+            while (j < 0 || j >= ny) {
+                if (j < 0) {
+                    j = north_pole_row ? -j : -j - 1;
+                }
+                else {
+                    j = south_pole_row ? jlast - 1 - (j - ny) : jlast - (j - ny);
+                }
             }
         }
         return j;
@@ -315,14 +260,7 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
         return y;
     };
 
-    std::vector<gidx_t> global_offsets(grid_->ny());
-    idx_t grid_idx = 0;
-    for (idx_t j = 0; j < grid_->ny(); ++j) {
-        global_offsets[j] = grid_idx;
-        grid_idx += grid_->nx(j);
-    }
-
-    auto compute_g = [this, &global_offsets, &compute_i, &compute_j, &periodic_y](idx_t i, idx_t j) -> gidx_t {
+    auto compute_g = [this, &compute_i, &compute_j, &periodic_y](idx_t i, idx_t j) -> gidx_t {
         idx_t ii, jj;
         gidx_t g;
         jj = compute_j(j);
@@ -335,7 +273,7 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
                                                  : ii;
             }
         }
-        g = global_offsets[jj] + ii + 1;
+        g = grid_->index(ii, jj) + 1;
         return g;
     };
 
@@ -352,39 +290,35 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
         idx_t jmax = -std::numeric_limits<idx_t>::max();
 
         ATLAS_TRACE_SCOPE("Compute bounds halo") {
-            for (idx_t j = j_begin_ - halo; j < j_end_ + halo; ++j) {
-                i_begin_halo_(j) = imin;
-                i_end_halo_(j)   = imax;
-            }
-
-            // Following cannot be multithreaded in current form due to race-conditions related to index jj
-            for (idx_t j = j_begin_; j < j_end_; ++j) {
-                for (idx_t i : {i_begin_[j], i_end_[j] - 1}) {
-                    // Following line only, increases periodic halo on the east side by 1
-                    if (periodic_points_ && i == grid_->nx(j) - 1) {
-                        ++i;
+            // Each row jj gathers the halo bounds from the owned rows j within halo distance, so that
+            // rows are computed independently from each other
+            atlas_omp_parallel_for(idx_t jj = j_begin_ - halo; jj < j_end_ + halo; ++jj) {
+                idx_t i_begin_jj   = std::numeric_limits<idx_t>::max();
+                idx_t i_end_jj     = -std::numeric_limits<idx_t>::max();
+                const idx_t jjj    = compute_j(jj);
+                const idx_t nx_jjj = grid_->nx(jjj);
+                const idx_t j_min  = std::max(jj - halo, j_begin_);
+                const idx_t j_max  = std::min(jj + halo, j_end_ - idx_t{1});
+                for (idx_t j = j_min; j <= j_max; ++j) {
+                    if (regional && (jj < 0 || jj > grid_->nx(j) - idx_t{1})) {
+                        continue;
                     }
+                    for (idx_t i : {i_begin_[j], i_end_[j] - 1}) {
+                        // Following line only, increases periodic halo on the east side by 1
+                        if (periodic_points_ && i == grid_->nx(j) - 1) {
+                            ++i;
+                        }
 
-                    double x = grid_->x(i, j);
+                        double x = grid_->x(i, j);
 
-                    double x_next = grid_->x(i + idx_t{1}, j);
-                    double x_prev = grid_->x(i - idx_t{1}, j);
-                    idx_t jj_min  = j - halo;
-                    idx_t jj_max  = j + halo;
-                    if (regional) {
-                        jj_min = std::max(jj_min, idx_t{0});
-                        jj_max = std::min(jj_max, grid_->nx(j) - idx_t{1});
-                    }
-                    for (idx_t jj = jj_min; jj <= jj_max; ++jj) {
-                        idx_t jjj    = compute_j(jj);
-                        idx_t nx_jjj = grid_->nx(jjj);
-                        idx_t last   = grid_->nx(jjj) - idx_t{1};
+                        double x_next = grid_->x(i + idx_t{1}, j);
+                        double x_prev = grid_->x(i - idx_t{1}, j);
+
+                        idx_t last = nx_jjj - idx_t{1};
                         if (i == grid_->nx(j)) {
                             ++last;
                         }
 
-                        jmin = std::min(jmin, jj);
-                        jmax = std::max(jmax, jj);
                         // Compute ii as index less-equal of x
                         //
                         //              x(i,j)
@@ -430,129 +364,98 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
                             i_plus_halo  = std::min(i_plus_halo, grid_->nx(jj) - idx_t{1});
                         }
 
-                        imin              = std::min(imin, i_minus_halo);
-                        imax              = std::max(imax, i_plus_halo);
-                        i_begin_halo_(jj) = std::min(i_begin_halo_(jj), i_minus_halo);
-                        i_end_halo_(jj)   = std::max(i_end_halo_(jj), i_plus_halo + idx_t{1});
+                        i_begin_jj = std::min(i_begin_jj, i_minus_halo);
+                        i_end_jj   = std::max(i_end_jj, i_plus_halo + idx_t{1});
                     }
                 }
+                i_begin_halo_(jj) = i_begin_jj;
+                i_end_halo_(jj)   = i_end_jj;
             }
-        }
 
-        int extra_halo{0};
-        for (idx_t j = j_begin_halo_; j < j_begin_; ++j) {
-            extra_halo += i_end_halo_(j) - i_begin_halo_(j);
-        }
-        for (idx_t j = j_begin_; j < j_end_; ++j) {
-            extra_halo += i_begin_[j] - i_begin_halo_(j);
-            extra_halo += i_end_halo_(j) - i_end_[j];
+            for (idx_t jj = j_begin_ - halo; jj < j_end_ + halo; ++jj) {
+                if (i_begin_halo_(jj) != std::numeric_limits<idx_t>::max()) {
+                    imin = std::min(imin, i_begin_halo_(jj));
+                    imax = std::max(imax, i_end_halo_(jj) - idx_t{1});
+                    jmin = std::min(jmin, jj);
+                    jmax = std::max(jmax, jj);
+                }
+            }
         }
-        for (idx_t j = j_end_; j < j_end_halo_; ++j) {
-            extra_halo += i_end_halo_(j) - i_begin_halo_(j);
+
+        // Offsets of each row into the owned and the halo gridpoints, so that rows can be assembled
+        // independently. Halo gridpoints are ordered by row, west before east of the owned points.
+        const idx_t nb_rows = j_end_halo_ - j_begin_halo_;
+        std::vector<idx_t> owned_offsets(nb_rows + 1, 0);
+        std::vector<idx_t> halo_offsets(nb_rows + 1, 0);
+        for (idx_t j = j_begin_halo_; j < j_end_halo_; ++j) {
+            const idx_t row = j - j_begin_halo_;
+            idx_t nb_owned{0};
+            idx_t nb_halo{0};
+            if (j >= j_begin_ && j < j_end_) {
+                nb_owned = i_end_[j] - i_begin_[j];
+                nb_halo  = (i_begin_[j] - i_begin_halo_(j)) + (i_end_halo_(j) - i_end_[j]);
+            }
+            else {
+                nb_halo = i_end_halo_(j) - i_begin_halo_(j);
+            }
+            owned_offsets[row + 1] = owned_offsets[row] + nb_owned;
+            halo_offsets[row + 1]  = halo_offsets[row] + nb_halo;
         }
+        const idx_t extra_halo = halo_offsets[nb_rows];
 
         ATLAS_TRACE_SCOPE("Assemble gridpoints") {
-            gridpoints.reserve(owned + extra_halo);
-            gridpoints.resize(owned);
+            ATLAS_ASSERT(owned_offsets[nb_rows] == owned);
+            gridpoints.resize(owned + extra_halo);
 
-            if (atlas_omp_get_max_threads() == 1) {
-                idx_t r = 0;
-                for (idx_t j = j_begin_; j < j_end_; ++j) {
+            atlas_omp_parallel_for(idx_t j = j_begin_halo_; j < j_end_halo_; ++j) {
+                const idx_t row = j - j_begin_halo_;
+                idx_t r         = owned_offsets[row];
+                idx_t h         = owned + halo_offsets[row];
+                if (j >= j_begin_ && j < j_end_) {
                     for (idx_t i = i_begin_[j]; i < i_end_[j]; ++i, ++r) {
                         gridpoints.set(i, j, r);
                     }
-                }
-                ATLAS_ASSERT(r == owned);
-            }
-            else {
-                atlas_omp_parallel {
-                    const size_t num_threads = atlas_omp_get_num_threads();
-                    const size_t thread_num  = atlas_omp_get_thread_num();
-
-                    auto chunksize = size_t(owned) / num_threads;
-                    size_t begin   = chunksize * thread_num;
-                    size_t end     = (thread_num == num_threads - 1) ? owned : begin + chunksize;
-
-                    idx_t thread_j_begin = 0;
-                    std::vector<idx_t> thread_i_begin(grid_->ny());
-                    std::vector<idx_t> thread_i_end(grid_->ny());
-                    size_t n = 0;
-                    for (idx_t j = j_begin_; j < j_end_; ++j) {
-                        size_t j_size = static_cast<size_t>(i_end_[j] - i_begin_[j]);
-                        if (n + j_size > begin) {
-                            thread_j_begin    = j;
-                            thread_i_begin[j] = i_begin_[j] + static_cast<idx_t>(begin - n);
-                            break;
-                        }
-                        n += j_size;
+                    for (idx_t i = i_begin_halo_(j); i < i_begin_[j]; ++i, ++h) {
+                        gridpoints.set(i, j, h);
                     }
-                    idx_t thread_j_end{thread_j_begin};
-                    for (idx_t j = thread_j_begin; j < j_end_; ++j) {
-                        if (j > thread_j_begin) {
-                            thread_i_begin[j] = i_begin_[j];
-                        }
-                        idx_t j_size = (i_end_[j] - i_begin_[j]);
-
-                        idx_t remaining = static_cast<idx_t>(end - n);
-                        if (j_size <= remaining) {
-                            thread_i_end[j] = i_end_[j];
-                            n += j_size;
-                            if (n == end) {
-                                goto stop;
-                            }
-                        }
-                        else {
-                            thread_i_end[j] = i_begin_[j] + remaining;
-                            goto stop;
-                        }
-
-                        continue;
-
-                    stop:
-                        thread_j_end = j + 1;
-                        break;
+                    for (idx_t i = i_end_[j]; i < i_end_halo_(j); ++i, ++h) {
+                        gridpoints.set(i, j, h);
                     }
-
-                    idx_t r = idx_t(begin);
-                    for (idx_t j = thread_j_begin; j < thread_j_end; ++j) {
-                        for (idx_t i = thread_i_begin[j]; i < thread_i_end[j]; ++i, ++r) {
-                            gridpoints.set(i, j, r);
-                        }
-                    }
-                    if (r != idx_t(end)) {
-                        ATLAS_DEBUG_VAR(thread_num);
-                        ATLAS_DEBUG_VAR(begin);
-                        ATLAS_DEBUG_VAR(end);
-                        ATLAS_DEBUG_VAR(r);
+                }
+                else {
+                    for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i, ++h) {
+                        gridpoints.set(i, j, h);
                     }
-                    ATLAS_ASSERT(r == idx_t(end));
                 }
             }
 
-            ATLAS_ASSERT(gridpoints.size() == owned);
+            ATLAS_ASSERT(gridpoints.size() == owned + extra_halo);
+        }
 
-            gridpoints.resize(owned + extra_halo);
-            idx_t r = owned;
-            for (idx_t j = j_begin_halo_; j < j_begin_; ++j) {
-                for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i, ++r) {
-                    gridpoints.set(i, j, r);
-                }
-            }
-            for (idx_t j = j_begin_; j < j_end_; ++j) {
-                for (idx_t i = i_begin_halo_(j); i < i_begin_[j]; ++i, ++r) {
-                    gridpoints.set(i, j, r);
+        if (halo_by_partition_) {
+            ATLAS_TRACE_SCOPE("Group halo by partition") {
+                // Halo points stored contiguously per owning partition, so that halo exchanges can receive
+                // directly into field storage. Points of one partition retain their (j,i) order.
+                std::vector<int> halo_part(extra_halo);
+                atlas_omp_parallel_for(idx_t h = 0; h < extra_halo; ++h) {
+                    const GridPoint& gp = gridpoints[owned + h];
+                    if (gp.j >= 0 && gp.j < grid_->ny() && gp.i >= 0 && gp.i < grid_->nx(gp.j)) {
+                        halo_part[h] = distribution.partition(grid_->index(gp.i, gp.j));
+                    }
+                    else {
+                        halo_part[h] = compute_p(gp.i, gp.j);
+                    }
                 }
-                for (idx_t i = i_end_[j]; i < i_end_halo_(j); ++i, ++r) {
-                    gridpoints.set(i, j, r);
+                std::vector<idx_t> order(extra_halo);
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(),
+                                 [&halo_part](idx_t a, idx_t b) { return halo_part[a] < halo_part[b]; });
+                std::vector<GridPoint> halo_points(gridpoints.gp_.begin() + owned, gridpoints.gp_.end());
+                atlas_omp_parallel_for(idx_t h = 0; h < extra_halo; ++h) {
+                    const GridPoint& gp = halo_points[order[h]];
+                    gridpoints.set(gp.i, gp.j, owned + h);
                 }
             }
-            for (idx_t j = j_end_; j < j_end_halo_; ++j) {
-                for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i, ++r) {
-                    gridpoints.set(i, j, r);
-                }
-            }
-
-            ATLAS_ASSERT(gridpoints.size() == owned + extra_halo);
         }
 
         ATLAS_TRACE_SCOPE("Fill in ij2gp ") {
@@ -596,7 +499,7 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
             if (gp.j >= 0 && gp.j < grid_->ny()) {
                 if (gp.i >= 0 && gp.i < grid_->nx(gp.j)) {
                     in_domain        = true;
-                    gidx_t k         = global_offsets[gp.j] + gp.i;
+                    gidx_t k         = grid_->index(gp.i, gp.j);
                     part(gp.r)       = distribution.partition(k);
                     global_idx(gp.r) = k + 1;
                 }
@@ -610,24 +513,19 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
             ghost(gp.r)   = 0;
         }
 
-        // Following short loops are not parallelized with
-
-        for (idx_t j = j_begin_halo_; j < j_begin_; ++j) {
-            for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i) {
-                ghost(index(i, j)) = 1;
-            }
-        }
-        atlas_omp_parallel_for(idx_t j = j_begin_; j < j_end_; ++j) {
-            for (idx_t i = i_begin_halo_(j); i < i_begin_[j]; ++i) {
-                ghost(index(i, j)) = 1;
-            }
-            for (idx_t i = i_end_[j]; i < i_end_halo_(j); ++i) {
-                ghost(index(i, j)) = 1;
+        atlas_omp_parallel_for(idx_t j = j_begin_halo_; j < j_end_halo_; ++j) {
+            if (j >= j_begin_ && j < j_end_) {
+                for (idx_t i = i_begin_halo_(j); i < i_begin_[j]; ++i) {
+                    ghost(index(i, j)) = 1;
+                }
+                for (idx_t i = i_end_[j]; i < i_end_halo_(j); ++i) {
+                    ghost(index(i, j)) = 1;
+                }
             }
-        }
-        for (idx_t j = j_end_; j < j_end_halo_; ++j) {
-            for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i) {
-                ghost(index(i, j)) = 1;
+            else {
+                for (idx_t i = i_begin_halo_(j); i < i_end_halo_(j); ++i) {
+                    ghost(index(i, j)) = 1;
+                }
             }
         }
     }
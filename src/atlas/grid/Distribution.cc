@@ -12,22 +12,58 @@
 
 #include "eckit/utils/MD5.h"
 
+#include "atlas/field/Field.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/detail/distribution/DistributionArray.h"
 #include "atlas/grid/detail/distribution/SerialDistribution.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/SharedObjects.h"
 
 namespace atlas {
 namespace grid {
 
 using namespace detail::distribution;
 
+namespace {
+class SharedDistributions : public util::SharedObjects::Cache<DistributionImpl> {
+    SharedDistributions(): Cache("SharedDistributions") {}
+
+public:
+    static SharedDistributions& instance() {
+        static SharedDistributions inst;
+        return inst;
+    }
+};
+
+// Distribution shared with equal earlier requests when util::SharedObjects are enabled
+Distribution partition(const Grid& grid, const Distribution::Config& config) {
+    if (not util::SharedObjects::enabled()) {
+        return Partitioner(config).partition(grid);
+    }
+    std::string key = "grid=" + grid.uid() + ";config=" + config.json() + ";mpi_comm=" + mpi::comm().name() +
+                      ";mpi_size=" + std::to_string(mpi::size());
+    auto create = [&]() {
+        Distribution distribution = Partitioner(config).partition(grid);
+        auto* impl                = const_cast<DistributionImpl*>(distribution.get());
+        impl->attach();
+        distribution = Distribution();
+        impl->detach();
+        return impl;
+    };
+    return Distribution(SharedDistributions::instance().get_or_create(key, create).get());
+}
+}  // namespace
+
 Distribution::Distribution(const Grid& grid): Handle(new SerialDistribution{grid}) {}
 
-Distribution::Distribution(const Grid& grid, const Config& config): Handle(Partitioner(config).partition(grid).get()) {}
+Distribution::Distribution(const Grid& grid, const Config& config): Handle(partition(grid, config).get()) {}
 
 Distribution::Distribution(const Grid& grid, const Partitioner& partitioner): Handle(partitioner.partition(grid)) {}
 
+Distribution::Distribution(const Grid& grid, const Partitioner& partitioner, const Field& weights):
+    Handle(partitioner.partition(grid, weights)) {}
+
 Distribution::Distribution(int nb_partitions, idx_t npts, int part[], int part0):
     Handle(new DistributionArray(nb_partitions, npts, part, part0)) {}
 
@@ -20,6 +20,7 @@
 
 namespace atlas {
 class Grid;
+class Field;
 namespace grid {
 class Partitioner;
 }  // namespace grid
@@ -47,6 +48,10 @@ public:
     /// @brief Create a distribution using a given partitioner
     Distribution(const Grid&, const Partitioner&);
 
+    /// @brief Create a distribution using a given partitioner, balancing given per-point weights
+    /// @see Partitioner::partition(const Grid&, const Field&)
+    Distribution(const Grid&, const Partitioner&, const Field& weights);
+
     /// @brief Create a distribution by given array, and make internal copy
     Distribution(int nb_partitions, idx_t npts, int partition[], int part0 = 0);
 
@@ -63,6 +68,10 @@ public:
         return get()->partition(begin, end, partitions.data());
     }
 
+    /// @brief Range [begin,end) of global indices that encloses all points of given partition
+    /// This allows visiting only the points of one partition, without evaluating the partition of all points.
+    std::pair<gidx_t, gidx_t> index_range(int partition) const { return get()->index_range(partition); }
+
     size_t footprint() const { return get()->footprint(); }
 
     ATLAS_ALWAYS_INLINE idx_t nb_partitions() const { return get()->nb_partitions(); }
@@ -9,6 +9,12 @@
  */
 
 #include "atlas/grid/Partitioner.h"
+
+#include <vector>
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
@@ -64,10 +70,73 @@ Distribution Partitioner::partition(const Grid& grid) const {
     return get()->partition(grid);
 }
 
+void Partitioner::partition(const Grid& grid, const double weights[], int part[]) const {
+    ATLAS_TRACE("Partitioner::partition [type=" + get()->type() + ",weighted]");
+    get()->partition(grid, weights, part);
+}
+
+Distribution Partitioner::partition(const Grid& grid, const double weights[]) const {
+    return get()->partition(grid, weights);
+}
+
+namespace {
+std::vector<double> global_weights(const Grid& grid, const Field& weights, const mpi::Comm& comm) {
+    ATLAS_TRACE("Partitioner::partition: global_weights");
+    FunctionSpace fs = weights.functionspace();
+    if (not fs) {
+        throw_Exception("weights Field for Partitioner must be defined on a FunctionSpace", Here());
+    }
+    if (weights.datatype() != array::DataType::kind<double>()) {
+        throw_Exception("weights Field for Partitioner must be of type double", Here());
+    }
+    if (weights.rank() > 2) {
+        throw_Exception("weights Field for Partitioner must be of rank 1 or 2", Here());
+    }
+
+    std::vector<double> w(grid.size(), 0.);
+
+    auto glb_idx = array::make_view<gidx_t, 1>(fs.global_index());
+    auto ghost   = array::make_view<int, 1>(fs.ghost());
+    const idx_t size = fs.size();
+    if (weights.rank() == 1) {
+        auto cost = array::make_view<double, 1>(weights);
+        for (idx_t n = 0; n < size; ++n) {
+            if (not ghost(n)) {
+                w[glb_idx(n) - 1] = cost(n);
+            }
+        }
+    }
+    else {
+        auto cost = array::make_view<double, 2>(weights);
+        for (idx_t n = 0; n < size; ++n) {
+            if (not ghost(n)) {
+                double column_cost = 0.;
+                for (idx_t jlev = 0; jlev < cost.shape(1); ++jlev) {
+                    column_cost += cost(n, jlev);
+                }
+                w[glb_idx(n) - 1] = column_cost;
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(w.data(), w.size(), eckit::mpi::sum()); }
+    return w;
+}
+}  // namespace
+
+Distribution Partitioner::partition(const Grid& grid, const Field& weights) const {
+    auto w = global_weights(grid, weights, mpi::comm(mpi_comm()));
+    return partition(grid, w.data());
+}
+
 idx_t Partitioner::nb_partitions() const {
     return get()->nb_partitions();
 }
 
+std::string Partitioner::mpi_comm() const {
+    return get()->mpi_comm();
+}
+
 std::string Partitioner::type() const {
     return get()->type();
 }
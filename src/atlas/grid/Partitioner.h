@@ -23,6 +23,7 @@ class Parametrisation;
 namespace atlas {
 class Grid;
 class Mesh;
+class Field;
 class FunctionSpace;
 namespace grid {
 class Distribution;
@@ -85,8 +86,26 @@ public:
 
     Distribution partition(const Grid& grid) const;
 
+    /// @brief Partition grid, balancing the sum of per-point weights instead of the number of points
+    /// @param weights  cost per grid point, with size grid.size(), indexed by (0-based) global index
+    void partition(const Grid& grid, const double weights[], int part[]) const;
+
+    Distribution partition(const Grid& grid, const double weights[]) const;
+
+    /// @brief Partition grid, balancing the sum of the given distributed cost field
+    /// @param weights  Field of type double defined on a FunctionSpace of the same grid.
+    ///                 Only owned points contribute. For multi-level fields the cost of a column
+    ///                 is the sum over its levels.
+    ///                 The weights are gathered to every task of the partitioner's communicator
+    ///                 into a buffer of size grid.size(), as the weighted cuts are computed from
+    ///                 the global cost on each task.
+    Distribution partition(const Grid& grid, const Field& weights) const;
+
     idx_t nb_partitions() const;
 
+    /// @brief Name of the MPI communicator ("mpi_comm" in the configuration, default the current communicator)
+    std::string mpi_comm() const;
+
     std::string type() const;
 };
 
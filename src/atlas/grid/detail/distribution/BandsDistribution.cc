@@ -40,6 +40,7 @@ BandsDistribution<Int>::BandsDistribution(const atlas::Grid& grid, atlas::idx_t
     }
 
     this->nb_pts_.reserve(nb_partitions_Int_);
+    range_begin_.reserve(nb_partitions_Int_);
 
     for (idx_t iproc = 0; iproc < nb_partitions; iproc++) {
         // Approximate values
@@ -74,6 +75,7 @@ BandsDistribution<Int>::BandsDistribution(const atlas::Grid& grid, atlas::idx_t
 
         imax = std::min(imax, (gidx_t)gridsize);
         this->nb_pts_.push_back(imax - imin);
+        range_begin_.push_back(imin);
     }
 
     this->max_pts_ = *std::max_element(this->nb_pts_.begin(), this->nb_pts_.end());
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "atlas/grid/detail/distribution/DistributionFunction.h"
 
@@ -34,7 +36,15 @@ public:
         return (iblock * nb_partitions_Int_) / nb_blocks_;
     }
 
+    /// Partitions are contiguous ranges of global indices
+    std::pair<gidx_t, gidx_t> index_range(int partition) const override {
+        return {range_begin_[partition], range_begin_[partition] + this->nb_pts_[partition]};
+    }
+
     static bool detectOverflow(size_t gridsize, size_t nb_partitions, size_t blocksize);
+
+private:
+    std::vector<gidx_t> range_begin_;
 };
 
 
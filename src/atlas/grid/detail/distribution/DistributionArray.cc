@@ -47,30 +47,16 @@ DistributionArray::DistributionArray(const Grid& grid, const Partitioner& partit
     part_.resize(grid.size());
     partitioner.partition(grid, part_.data());
     nb_partitions_ = partitioner.nb_partitions();
+    setup_nb_pts();
+    type_ = distribution_type(nb_partitions_, partitioner);
+}
 
-    size_t size     = part_.size();
-    int num_threads = atlas_omp_get_max_threads();
-
-    std::vector<std::vector<int> > nb_pts_per_thread(num_threads, std::vector<int>(nb_partitions_));
-    atlas_omp_parallel {
-        int thread   = atlas_omp_get_thread_num();
-        auto& nb_pts = nb_pts_per_thread[thread];
-        atlas_omp_for(size_t j = 0; j < size; ++j) {
-            int p = part_[j];
-            ++nb_pts[p];
-        }
-    }
-
-    nb_pts_.resize(nb_partitions_, 0);
-    for (int thread = 0; thread < num_threads; ++thread) {
-        for (int p = 0; p < nb_partitions_; ++p) {
-            nb_pts_[p] += nb_pts_per_thread[thread][p];
-        }
-    }
-
-    max_pts_ = *std::max_element(nb_pts_.begin(), nb_pts_.end());
-    min_pts_ = *std::min_element(nb_pts_.begin(), nb_pts_.end());
-    type_    = distribution_type(nb_partitions_, partitioner);
+DistributionArray::DistributionArray(const Grid& grid, const Partitioner& partitioner, const double weights[]) {
+    part_.resize(grid.size());
+    partitioner.partition(grid, weights, part_.data());
+    nb_partitions_ = partitioner.nb_partitions();
+    setup_nb_pts();
+    type_ = distribution_type(nb_partitions_, partitioner);
 }
 
 DistributionArray::DistributionArray(int nb_partitions, idx_t npts, int part[], int part0) {
@@ -82,38 +68,57 @@ DistributionArray::DistributionArray(int nb_partitions, idx_t npts, int part[],
     else {
         nb_partitions_ = nb_partitions;
     }
-    nb_pts_.resize(nb_partitions_, 0);
     for (idx_t j = 0, size = static_cast<idx_t>(part_.size()); j < size; ++j) {
         part_[j] -= part0;
-        ++nb_pts_[part_[j]];
     }
-    max_pts_ = *std::max_element(nb_pts_.begin(), nb_pts_.end());
-    min_pts_ = *std::min_element(nb_pts_.begin(), nb_pts_.end());
-    type_    = distribution_type(nb_partitions_);
+    setup_nb_pts();
+    type_ = distribution_type(nb_partitions_);
 }
 
 DistributionArray::DistributionArray(int nb_partitions, partition_t&& part):
-    nb_partitions_(nb_partitions), part_(std::move(part)), nb_pts_(nb_partitions_, 0) {
+    nb_partitions_(nb_partitions), part_(std::move(part)) {
+    setup_nb_pts();
+    type_ = distribution_type(nb_partitions_);
+}
+
+void DistributionArray::setup_nb_pts() {
     size_t size     = part_.size();
     int num_threads = atlas_omp_get_max_threads();
+
     std::vector<std::vector<int> > nb_pts_per_thread(num_threads, std::vector<int>(nb_partitions_));
+    std::vector<std::vector<gidx_t> > begin_per_thread(num_threads, std::vector<gidx_t>(nb_partitions_, size));
+    std::vector<std::vector<gidx_t> > end_per_thread(num_threads, std::vector<gidx_t>(nb_partitions_, 0));
     atlas_omp_parallel {
         int thread   = atlas_omp_get_thread_num();
         auto& nb_pts = nb_pts_per_thread[thread];
+        auto& begin  = begin_per_thread[thread];
+        auto& end    = end_per_thread[thread];
         atlas_omp_for(size_t j = 0; j < size; ++j) {
             int p = part_[j];
             ++nb_pts[p];
+            begin[p] = std::min<gidx_t>(begin[p], j);
+            end[p]   = std::max<gidx_t>(end[p], j + 1);
         }
     }
+
+    nb_pts_.assign(nb_partitions_, 0);
+    range_begin_.assign(nb_partitions_, size);
+    range_end_.assign(nb_partitions_, 0);
     for (int thread = 0; thread < num_threads; ++thread) {
         for (int p = 0; p < nb_partitions_; ++p) {
             nb_pts_[p] += nb_pts_per_thread[thread][p];
+            range_begin_[p] = std::min(range_begin_[p], begin_per_thread[thread][p]);
+            range_end_[p]   = std::max(range_end_[p], end_per_thread[thread][p]);
+        }
+    }
+    for (int p = 0; p < nb_partitions_; ++p) {
+        if (nb_pts_[p] == 0) {
+            range_begin_[p] = range_end_[p] = 0;
         }
     }
 
     max_pts_ = *std::max_element(nb_pts_.begin(), nb_pts_.end());
     min_pts_ = *std::min_element(nb_pts_.begin(), nb_pts_.end());
-    type_    = distribution_type(nb_partitions_);
 }
 
 DistributionArray::~DistributionArray() = default;
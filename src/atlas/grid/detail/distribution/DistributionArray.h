@@ -35,6 +35,9 @@ public:
 
     DistributionArray(const Grid&, const Partitioner&);
 
+    /// @brief Create distribution with partitioner that balances given per-point weights
+    DistributionArray(const Grid&, const Partitioner&, const double weights[]);
+
     DistributionArray(int nb_partitions, idx_t npts, int partition[], int part0 = 0);
 
     DistributionArray(int nb_partitions, partition_t&& partition);
@@ -60,7 +63,10 @@ public:
 
     void print(std::ostream&) const override;
 
-    size_t footprint() const override { return nb_pts_.size() * sizeof(nb_pts_[0]) + part_.size() * sizeof(part_[0]); }
+    size_t footprint() const override {
+        return nb_pts_.size() * sizeof(nb_pts_[0]) + 2 * range_begin_.size() * sizeof(range_begin_[0]) +
+               part_.size() * sizeof(part_[0]);
+    }
 
     bool functional() const override { return false; }
 
@@ -75,11 +81,20 @@ public:
         }
     }
 
+    std::pair<gidx_t, gidx_t> index_range(int partition) const override {
+        return {range_begin_[partition], range_end_[partition]};
+    }
+
+private:
+    void setup_nb_pts();
+
 protected:
     idx_t nb_partitions_ = 0;
 
     partition_t part_;
     std::vector<idx_t> nb_pts_;
+    std::vector<gidx_t> range_begin_;
+    std::vector<gidx_t> range_end_;
     idx_t max_pts_;
     idx_t min_pts_;
     std::string type_;
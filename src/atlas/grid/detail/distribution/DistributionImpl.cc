@@ -21,6 +21,44 @@
 namespace atlas {
 namespace grid {
 
+std::pair<gidx_t, gidx_t> DistributionImpl::index_range(int part) const {
+    // Scan from both ends in chunks, so that memory does not scale with the number of points
+    constexpr gidx_t chunk = 4096;
+    std::vector<int> partitions(chunk);
+    const gidx_t npts = size();
+
+    gidx_t begin = npts;
+    for (gidx_t chunk_begin = 0; chunk_begin < npts && begin == npts; chunk_begin += chunk) {
+        const gidx_t chunk_end = std::min(chunk_begin + chunk, npts);
+        partition(chunk_begin, chunk_end, partitions.data());
+        for (gidx_t n = chunk_begin; n < chunk_end; ++n) {
+            if (partitions[n - chunk_begin] == part) {
+                begin = n;
+                break;
+            }
+        }
+    }
+    if (begin == npts) {
+        return {0, 0};
+    }
+
+    gidx_t end = begin + 1;
+    for (gidx_t chunk_end = npts; chunk_end > begin && end == begin + 1; chunk_end -= chunk) {
+        const gidx_t chunk_begin = std::max(chunk_end - chunk, begin);
+        partition(chunk_begin, chunk_end, partitions.data());
+        for (gidx_t n = chunk_end - 1; n >= chunk_begin; --n) {
+            if (partitions[n - chunk_begin] == part) {
+                end = n + 1;
+                break;
+            }
+        }
+        if (chunk_begin == begin) {
+            break;
+        }
+    }
+    return {begin, end};
+}
+
 DistributionImpl* atlas__GridDistribution__new(idx_t size, int part[], int part0) {
     return new detail::distribution::DistributionArray(0, size, part, part0);
 }
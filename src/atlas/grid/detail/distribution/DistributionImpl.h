@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atlas/library/config.h"
@@ -64,6 +65,11 @@ public:
     virtual void hash(eckit::Hash&) const = 0;
 
     virtual void partition(gidx_t begin, gidx_t end, int partitions[]) const = 0;
+
+    /// @brief Range [begin,end) of global indices that encloses all points of given partition
+    /// Points of other partitions may lie within this range. The range is empty (begin == end) if the
+    /// partition has no points. The default implementation scans the distribution in fixed-size chunks.
+    virtual std::pair<gidx_t, gidx_t> index_range(int partition) const;
 };
 
 
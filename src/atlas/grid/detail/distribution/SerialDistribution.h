@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "atlas/grid/detail/distribution/DistributionFunction.h"
 
 namespace atlas {
@@ -23,6 +25,10 @@ public:
 
     ATLAS_ALWAYS_INLINE int function(gidx_t gidx) const { return rank_; }
 
+    std::pair<gidx_t, gidx_t> index_range(int partition) const override {
+        return partition == rank_ ? std::make_pair(gidx_t(0), size_) : std::make_pair(gidx_t(0), gidx_t(0));
+    }
+
 private:
     int rank_{0};
 };
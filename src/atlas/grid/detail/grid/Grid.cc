@@ -10,6 +10,7 @@
 
 #include "Grid.h"
 
+#include <functional>
 #include <vector>
 
 #include "eckit/utils/MD5.h"
@@ -23,6 +24,7 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/util/SharedObjects.h"
 
 namespace atlas {
 namespace grid {
@@ -37,6 +39,26 @@ static void checkSizeOfPoint() {
     ATLAS_ASSERT(sizeof(PointXY) == 2 * sizeof(double));
 }
 
+namespace {
+class SharedGrids : public util::SharedObjects::Cache<Grid> {
+    SharedGrids(): Cache("SharedGrids") {}
+
+public:
+    static SharedGrids& instance() {
+        static SharedGrids inst;
+        return inst;
+    }
+};
+
+// Grid shared with equal earlier requests when util::SharedObjects are enabled
+const Grid* create_shared(const std::string& key, const std::function<const Grid*()>& create) {
+    if (not util::SharedObjects::enabled()) {
+        return create();
+    }
+    return SharedGrids::instance().get_or_create(key, [&create]() { return const_cast<Grid*>(create()); }).get();
+}
+}  // namespace
+
 const Grid* Grid::create(const Config& config) {
     std::string name;
     if (config.get("name", name)) {
@@ -48,7 +70,7 @@ const Grid* Grid::create(const Config& config) {
         const GridBuilder::Registry& registry = GridBuilder::typeRegistry();
         if (registry.find(type) != registry.end()) {
             const GridBuilder& gc = *registry.at(type);
-            return gc.create(config);
+            return create_shared("config=" + config.json(), [&]() { return gc.create(config); });
         }
     }
 
@@ -72,11 +94,17 @@ const Grid* Grid::create(const std::string& name) {
 
 const Grid* Grid::create(const std::string& name, const Grid::Config& config) {
     const GridBuilder::Registry& registry = GridBuilder::nameRegistry();
-    for (GridBuilder::Registry::const_iterator it = registry.begin(); it != registry.end(); ++it) {
-        const Grid* grid = it->second->create(name, config);
-        if (grid) {
-            return grid;
+    const Grid* created = create_shared("name=" + name + ";config=" + config.json(), [&]() -> const Grid* {
+        for (GridBuilder::Registry::const_iterator it = registry.begin(); it != registry.end(); ++it) {
+            const Grid* grid = it->second->create(name, config);
+            if (grid) {
+                return grid;
+            }
         }
+        return nullptr;
+    });
+    if (created) {
+        return created;
     }
 
     // Throw exception
@@ -667,6 +667,17 @@ Grid::Config Structured::partitioner() const {
     return config;
 }
 
+size_t Structured::footprint() const {
+    size_t size = sizeof(*this);
+    size += y_.capacity() * sizeof(double);
+    size += nx_.capacity() * sizeof(idx_t);
+    size += xmin_.capacity() * sizeof(double);
+    size += xmax_.capacity() * sizeof(double);
+    size += dx_.capacity() * sizeof(double);
+    size += jglooff_.capacity() * sizeof(gidx_t);
+    return size;
+}
+
 void Structured::hash(eckit::Hash& h) const {
     double multiplier      = projection().units() == "meters" ? 1e2 : 1e8;
     auto add_double        = [&](const double& x) { h.add(std::round(x * multiplier)); };
@@ -378,6 +378,8 @@ protected:  // methods
 
     virtual void hash(eckit::Hash&) const override;
 
+    virtual size_t footprint() const override;
+
     virtual RectangularLonLatDomain lonlatBoundingBox() const override;
 
     void computeTruePeriodicity();
@@ -35,7 +35,8 @@ CheckerboardPartitioner::CheckerboardPartitioner(): Partitioner() {}
 
 CheckerboardPartitioner::CheckerboardPartitioner(int N): Partitioner(N) {}
 
-CheckerboardPartitioner::CheckerboardPartitioner(int N, const eckit::Parametrisation& config): Partitioner(N) {
+CheckerboardPartitioner::CheckerboardPartitioner(int N, const eckit::Parametrisation& config):
+    Partitioner(N, config) {
     config.get("bands", nbands_);
     config.get("regular", regular_);
 }
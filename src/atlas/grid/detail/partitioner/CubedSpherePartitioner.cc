@@ -80,7 +80,7 @@ CubedSpherePartitioner::CubedSpherePartitioner(): Partitioner() {}
 CubedSpherePartitioner::CubedSpherePartitioner(int N): Partitioner(N), regular_{true} {}
 
 CubedSpherePartitioner::CubedSpherePartitioner(int N, const eckit::Parametrisation& config):
-    Partitioner(N), regular_{isConfigSufficient(config)} {
+    Partitioner(N, config), regular_{isConfigSufficient(config)} {
     if (config.has("starting rank on tile") && config.has("final rank on tile") && config.has("nprocx") &&
         config.has("nprocy")) {
         config.get("starting rank on tile", globalProcStartPE_);
@@ -458,7 +458,8 @@ EqualRegionsPartitioner::EqualRegionsPartitioner(int N): Partitioner(N), N_(N) {
 }
 
 EqualRegionsPartitioner::EqualRegionsPartitioner(int N, const eckit::Parametrisation& config):
-    EqualRegionsPartitioner(N) {
+    Partitioner(N, config), N_(N) {
+    init();
     std::string crds;
     if (config.get("coordinates", crds)) {
         if (crds == "lonlat") {
@@ -596,6 +597,118 @@ void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], int part[
     // ((double)CLOCKS_PER_SEC) << "s)" << std::endl;
 }
 
+void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], const double weights[], int part[]) const {
+    ATLAS_TRACE("EqualRegionsPartitioner::partition [weighted]");
+
+    // cumulative weight, following the order of nodes[]
+    std::vector<double> cumul(nb_nodes + 1);
+    auto accumulate = [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            cumul[i + 1] = cumul[i] + weights[nodes[i].n];
+        }
+    };
+    cumul[0] = 0.;
+    accumulate(0, nb_nodes);
+    const double total = cumul[nb_nodes];
+    ATLAS_ASSERT(total > 0., "Sum of weights must be positive");
+
+    // Index in [begin,end] where the cumulative weight is closest to target
+    auto cut = [&](double target, int begin, int end) -> int {
+        int i = std::distance(cumul.begin(),
+                              std::lower_bound(cumul.begin() + begin, cumul.begin() + end + 1, target));
+        if (i > end) {
+            return end;
+        }
+        if (i > begin && (target - cumul[i - 1]) < (cumul[i] - target)) {
+            --i;
+        }
+        return i;
+    };
+
+    // Bands: cut where the cumulative weight reaches the share of all regions in preceding bands
+    std::vector<int> b_displs(nb_bands() + 1);
+    b_displs[0] = 0;
+    int nb_regions_north{0};
+    for (int band = 0; band < nb_bands(); ++band) {
+        nb_regions_north += nb_regions(band);
+        b_displs[band + 1] = (band == nb_bands() - 1)
+                                 ? nb_nodes
+                                 : cut(total * nb_regions_north / double(N_), b_displs[band], nb_nodes);
+    }
+
+    // Sectors: sort every band from west to east, and cut in the same way
+    int p{0};
+    for (int band = 0; band < nb_bands(); ++band) {
+        const int b_begin = b_displs[band];
+        const int b_end   = b_displs[band + 1];
+        omp::sort(nodes + b_begin, nodes + b_end, compare_WE_NS);
+        accumulate(b_begin, b_end);
+        int begin = b_begin;
+        for (int r = 0; r < nb_regions(band); ++r, ++p) {
+            int end = (r == nb_regions(band) - 1) ? b_end : cut(total * (p + 1) / double(N_), begin, b_end);
+            for (int i = begin; i < end; ++i) {
+                part[nodes[i].n] = p;
+            }
+            begin = end;
+        }
+    }
+}
+
+void EqualRegionsPartitioner::partition(const Grid& grid, const double weights[], int part[]) const {
+    if (N_ == 1) {  // trivial solution, so much faster
+        atlas_omp_parallel_for(idx_t j = 0; j < grid.size(); ++j) { part[j] = 0; }
+        return;
+    }
+    ATLAS_TRACE("EqualRegionsPartitioner::partition [weighted]");
+
+    ATLAS_ASSERT(grid.projection().units() == "degrees");
+
+    // Contrary to the unweighted version, every MPI task computes the full
+    // partitioning itself, so that no communication is required.
+    atlas::vector<NodeInt> nodes(grid.size());
+
+    if (StructuredGrid(grid) && (coordinates_ == Coordinates::XY)) {
+        // The grid comes sorted from north to south and west to east by construction
+        StructuredGrid structured_grid(grid);
+        ATLAS_ASSERT(structured_grid.x(1, 0) > structured_grid.x(0, 0));
+        std::vector<idx_t> offset(structured_grid.ny() + 1, 0);
+        for (idx_t j = 0; j < structured_grid.ny(); ++j) {
+            offset[j + 1] = offset[j] + structured_grid.nx(j);
+        }
+        atlas_omp_parallel_for(idx_t j = 0; j < structured_grid.ny(); ++j) {
+            int y    = microdeg(structured_grid.y(j));
+            idx_t nn = offset[j];
+            for (idx_t i = 0; i < structured_grid.nx(j); ++i, ++nn) {
+                nodes[nn].x = microdeg(structured_grid.x(i, j));
+                nodes[nn].y = y;
+                nodes[nn].n = nn;
+            }
+        }
+    }
+    else {
+        int n = 0;
+        if (coordinates_ == Coordinates::XY) {
+            for (const auto& point : grid.xy()) {
+                nodes[n].x = microdeg(point[0]);
+                nodes[n].y = microdeg(point[1]);
+                nodes[n].n = n;
+                ++n;
+            }
+        }
+        else {
+            for (const auto& point : grid.lonlat()) {
+                nodes[n].x = microdeg(point[0]);
+                nodes[n].y = microdeg(point[1]);
+                nodes[n].n = n;
+                ++n;
+            }
+        }
+        ATLAS_TRACE_SCOPE("sort all") { omp::sort(nodes.begin(), nodes.end(), compare_NS_WE); }
+    }
+
+    partition(grid.size(), nodes.data(), weights, part);
+}
+
 void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
     if (N_ == 1) {  // trivial solution, so much faster
         atlas_omp_parallel_for(idx_t j = 0; j < grid.size(); ++j) { part[j] = 0; }
@@ -89,6 +89,10 @@ public:
     using Partitioner::partition;
     virtual void partition(const Grid&, int part[]) const;
 
+    /// Weighted variant: band and sector boundaries are placed such that
+    /// every region gets an equal share of the total weight
+    virtual void partition(const Grid&, const double weights[], int part[]) const;
+
     virtual std::string type() const { return "equal_regions"; }
 
 public:
@@ -120,6 +124,10 @@ private:
     // algorithm is used internally
     void partition(int nb_nodes, NodeInt nodes[], int part[]) const;
 
+    // Same as above, but balancing the sum of weights[nodes[i].n] per region.
+    // nodes[] must be sorted from north to south, and west to east.
+    void partition(int nb_nodes, NodeInt nodes[], const double weights[], int part[]) const;
+
     // x and y in radians
     int partition(const double& x, const double& y) const;
 
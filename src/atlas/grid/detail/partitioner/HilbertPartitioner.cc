@@ -0,0 +1,233 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/grid/detail/partitioner/HilbertPartitioner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "atlas/domain/Domain.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/Iterator.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Hilbert.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+HilbertPartitioner::HilbertPartitioner(): Partitioner() {}
+
+HilbertPartitioner::HilbertPartitioner(int N): Partitioner(N) {}
+
+HilbertPartitioner::HilbertPartitioner(int N, const eckit::Parametrisation& config): Partitioner(N, config) {
+    std::string crds;
+    if (config.get("coordinates", crds)) {
+        if (crds == "lonlat") {
+            coordinates_ = Coordinates::LONLAT;
+        }
+        else if (crds == "xy") {
+            coordinates_ = Coordinates::XY;
+        }
+        else {
+            throw_Exception("HilbertPartitioner: unsupported coordinates \"" + crds + "\"", Here());
+        }
+    }
+    config.get("recursion", recursion_);
+    ATLAS_ASSERT(recursion_ > 0 && recursion_ <= 30);
+}
+
+namespace {
+// Curve in lonlat coordinates, covering the sphere
+util::Hilbert lonlat_hilbert(idx_t recursion) {
+    return util::Hilbert{RectangularDomain({0., 360.}, {-90., 90.}), recursion};
+}
+
+PointXY lonlat_curve_point(const PointLonLat& p) {
+    return PointXY{p.lon() - 360. * std::floor(p.lon() / 360.), std::max(-90., std::min(90., p.lat()))};
+}
+
+// Curve in xy coordinates, covering the bounding box of the grid
+util::Hilbert xy_hilbert(const Grid& grid, idx_t recursion) {
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = -std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double ymax = -std::numeric_limits<double>::max();
+    for (const auto& p : grid.xy()) {
+        xmin = std::min(xmin, p.x());
+        xmax = std::max(xmax, p.x());
+        ymin = std::min(ymin, p.y());
+        ymax = std::max(ymax, p.y());
+    }
+    return util::Hilbert{RectangularDomain({xmin, xmax}, {ymin, ymax}), recursion};
+}
+}  // namespace
+
+bool HilbertPartitioner::lonlat_curve(const Grid& grid) const {
+    return (coordinates_ == Coordinates::LONLAT) ||
+           (coordinates_ == Coordinates::DEFAULT && grid.projection().units() == "degrees");
+}
+
+std::vector<HilbertPartitioner::key_t> HilbertPartitioner::compute_keys(const Grid& grid) const {
+    ATLAS_TRACE("HilbertPartitioner::compute_keys");
+
+    const gidx_t size = grid.size();
+    std::vector<key_t> keys(size);
+
+    // Every thread handles a contiguous range of grid points, so that the grid iterators
+    // only need to be advanced once per thread.
+    auto thread_range = [size](gidx_t& begin, gidx_t& end) {
+        const gidx_t num_threads = atlas_omp_get_num_threads();
+        const gidx_t thread_num  = atlas_omp_get_thread_num();
+        begin                    = thread_num * size / num_threads;
+        end                      = (thread_num + 1) * size / num_threads;
+    };
+
+    if (lonlat_curve(grid)) {
+        const util::Hilbert hilbert = lonlat_hilbert(recursion_);
+        atlas_omp_parallel {
+            gidx_t begin, end;
+            thread_range(begin, end);
+            auto it = grid.lonlat().begin() + begin;
+            for (gidx_t n = begin; n < end; ++n, ++it) {
+                keys[n] = key_t{hilbert(lonlat_curve_point(*it)), n};
+            }
+        }
+    }
+    else {
+        const util::Hilbert hilbert = xy_hilbert(grid, recursion_);
+        atlas_omp_parallel {
+            gidx_t begin, end;
+            thread_range(begin, end);
+            auto it = grid.xy().begin() + begin;
+            for (gidx_t n = begin; n < end; ++n, ++it) {
+                keys[n] = key_t{hilbert(*it), n};
+            }
+        }
+    }
+
+    ATLAS_TRACE_SCOPE("sort") { omp::sort(keys.begin(), keys.end()); }
+    return keys;
+}
+
+std::vector<gidx_t> HilbertPartitioner::order(const Grid& grid) const {
+    auto keys = compute_keys(grid);
+    std::vector<gidx_t> order(keys.size());
+    atlas_omp_parallel_for(size_t i = 0; i < keys.size(); ++i) { order[i] = keys[i].second; }
+    return order;
+}
+
+std::vector<idx_t> HilbertPartitioner::order(const Grid& grid, const std::vector<PointXY>& xy,
+                                             const std::vector<PointLonLat>& lonlat,
+                                             const std::vector<gidx_t>& global_index) const {
+    ATLAS_TRACE("HilbertPartitioner::order [subset]");
+    const idx_t size = static_cast<idx_t>(global_index.size());
+    std::vector<key_t> keys(size);
+    if (lonlat_curve(grid)) {
+        ATLAS_ASSERT(idx_t(lonlat.size()) == size);
+        const util::Hilbert hilbert = lonlat_hilbert(recursion_);
+        atlas_omp_parallel_for(idx_t n = 0; n < size; ++n) {
+            keys[n] = key_t{hilbert(lonlat_curve_point(lonlat[n])), global_index[n] - 1};
+        }
+    }
+    else {
+        ATLAS_ASSERT(idx_t(xy.size()) == size);
+        const util::Hilbert hilbert = xy_hilbert(grid, recursion_);
+        atlas_omp_parallel_for(idx_t n = 0; n < size; ++n) { keys[n] = key_t{hilbert(xy[n]), global_index[n] - 1}; }
+    }
+
+    // Sort positions by key, so that points sharing a cell of the curve are ordered by global index as in order()
+    std::vector<idx_t> order(size);
+    for (idx_t n = 0; n < size; ++n) {
+        order[n] = n;
+    }
+    omp::sort(order.begin(), order.end(), [&](idx_t a, idx_t b) { return keys[a] < keys[b]; });
+    return order;
+}
+
+void HilbertPartitioner::partition(const Grid& grid, int part[]) const {
+    ATLAS_TRACE("HilbertPartitioner::partition");
+    const int nb_parts = nb_partitions();
+    if (nb_parts == 1) {
+        atlas_omp_parallel_for(gidx_t n = 0; n < grid.size(); ++n) { part[n] = 0; }
+        return;
+    }
+
+    auto keys = compute_keys(grid);
+
+    // Chunk p of the curve contains indices [ p*size/nb_parts, (p+1)*size/nb_parts )
+    const gidx_t size = keys.size();
+    atlas_omp_parallel_for(int p = 0; p < nb_parts; ++p) {
+        const gidx_t begin = p * size / nb_parts;
+        const gidx_t end   = (p + 1) * size / nb_parts;
+        for (gidx_t i = begin; i < end; ++i) {
+            part[keys[i].second] = p;
+        }
+    }
+}
+
+void HilbertPartitioner::partition(const Grid& grid, const double weights[], int part[]) const {
+    ATLAS_TRACE("HilbertPartitioner::partition [weighted]");
+    const int nb_parts = nb_partitions();
+    if (nb_parts == 1) {
+        atlas_omp_parallel_for(gidx_t n = 0; n < grid.size(); ++n) { part[n] = 0; }
+        return;
+    }
+
+    auto keys = compute_keys(grid);
+
+    // cumulative weight along the curve
+    const gidx_t size = keys.size();
+    std::vector<double> cumul(size + 1);
+    cumul[0] = 0.;
+    for (gidx_t i = 0; i < size; ++i) {
+        cumul[i + 1] = cumul[i] + weights[keys[i].second];
+    }
+    const double total = cumul[size];
+    ATLAS_ASSERT(total > 0., "Sum of weights must be positive");
+
+    // Cut the curve where the cumulative weight is closest to an equal share
+    std::vector<gidx_t> displs(nb_parts + 1);
+    displs[0]        = 0;
+    displs[nb_parts] = size;
+    for (int p = 1; p < nb_parts; ++p) {
+        const double target = total * p / double(nb_parts);
+        gidx_t i =
+            std::distance(cumul.begin(), std::lower_bound(cumul.begin() + displs[p - 1], cumul.end(), target));
+        if (i > size) {
+            i = size;
+        }
+        else if (i > displs[p - 1] && (target - cumul[i - 1]) < (cumul[i] - target)) {
+            --i;
+        }
+        displs[p] = i;
+    }
+
+    atlas_omp_parallel_for(int p = 0; p < nb_parts; ++p) {
+        for (gidx_t i = displs[p]; i < displs[p + 1]; ++i) {
+            part[keys[i].second] = p;
+        }
+    }
+}
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
+
+namespace {
+atlas::grid::detail::partitioner::PartitionerBuilder<atlas::grid::detail::partitioner::HilbertPartitioner> __Hilbert(
+    atlas::grid::detail::partitioner::HilbertPartitioner::static_type());
+}
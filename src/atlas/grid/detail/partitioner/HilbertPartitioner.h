@@ -0,0 +1,85 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "atlas/grid/detail/partitioner/Partitioner.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+/// Partitioner that orders all grid points along a Hilbert space-filling curve
+/// and cuts the curve in contiguous chunks with equal number of points,
+/// or with equal sum of weights.
+///
+/// Any grid can be partitioned (Structured, CubedSphere, Healpix, Unstructured, ...)
+///
+/// The optional config can contain:
+///
+///     - "coordinates" : <string> (default="lonlat" for grids in degrees, "xy" otherwise)
+///                                // Coordinates in which the curve is constructed.
+///     - "recursion"   : <int>    (default=20)
+///                                // Recursion of the curve. Points falling in the same
+///                                // cell of the finest level are ordered by global index.
+class HilbertPartitioner : public Partitioner {
+public:
+    HilbertPartitioner();
+    HilbertPartitioner(int N);
+    HilbertPartitioner(int N, const eckit::Parametrisation& config);
+
+    std::string type() const override { return static_type(); }
+    static std::string static_type() { return "hilbert"; }
+
+    using Partitioner::partition;
+
+    void partition(const Grid&, int part[]) const override;
+
+    void partition(const Grid&, const double weights[], int part[]) const override;
+
+    /// @brief Global indices (0-based) of all grid points, in the order of the curve
+    std::vector<gidx_t> order(const Grid&) const;
+
+    /// @brief Order of a subset of the grid points along the same curve as order(const Grid&)
+    /// Only the given points are sorted, so that e.g. a partition can be numbered along the curve
+    /// without ordering the whole grid again.
+    /// @param xy, lonlat    coordinates of the points, of which those the curve is constructed in are used
+    /// @param global_index  global indices (1-based) of the points
+    /// @return local indices [0, size) of the points, in the order of the curve
+    std::vector<idx_t> order(const Grid&, const std::vector<PointXY>& xy, const std::vector<PointLonLat>& lonlat,
+                             const std::vector<gidx_t>& global_index) const;
+
+private:
+    using key_t = std::pair<gidx_t, gidx_t>;  // (hilbert code, global index)
+
+    std::vector<key_t> compute_keys(const Grid&) const;
+
+    bool lonlat_curve(const Grid&) const;
+
+private:
+    enum class Coordinates
+    {
+        DEFAULT,
+        XY,
+        LONLAT,
+    };
+    Coordinates coordinates_ = Coordinates::DEFAULT;
+    idx_t recursion_{20};
+};
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
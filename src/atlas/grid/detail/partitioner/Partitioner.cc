@@ -19,6 +19,7 @@
 #include "eckit/thread/Mutex.h"
 
 #include "atlas/grid/Distribution.h"
+#include "atlas/grid/Grid.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/detail/distribution/DistributionArray.h"
 #include "atlas/grid/detail/partitioner/BandsPartitioner.h"
@@ -26,6 +27,7 @@
 #include "atlas/grid/detail/partitioner/CubedSpherePartitioner.h"
 #include "atlas/grid/detail/partitioner/EqualBandsPartitioner.h"
 #include "atlas/grid/detail/partitioner/EqualRegionsPartitioner.h"
+#include "atlas/grid/detail/partitioner/HilbertPartitioner.h"
 #include "atlas/grid/detail/partitioner/MatchingFunctionSpacePartitionerLonLatPolygon.h"
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitioner.h"
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerBruteForce.h"
@@ -61,9 +63,14 @@ namespace grid {
 namespace detail {
 namespace partitioner {
 
-Partitioner::Partitioner(): nb_partitions_(mpi::size()) {}
+Partitioner::Partitioner(): nb_partitions_(mpi::size()), mpi_comm_(mpi::comm().name()) {}
 
-Partitioner::Partitioner(const idx_t nb_partitions): nb_partitions_(nb_partitions) {}
+Partitioner::Partitioner(const idx_t nb_partitions): nb_partitions_(nb_partitions), mpi_comm_(mpi::comm().name()) {}
+
+Partitioner::Partitioner(const idx_t nb_partitions, const eckit::Parametrisation& config):
+    Partitioner(nb_partitions) {
+    config.get("mpi_comm", mpi_comm_);
+}
 
 Partitioner::~Partitioner() = default;
 
@@ -75,6 +82,20 @@ Distribution Partitioner::partition(const Grid& grid) const {
     return new distribution::DistributionArray{grid, atlas::grid::Partitioner(this)};
 }
 
+void Partitioner::partition(const Grid& grid, const double[], int part[]) const {
+    if (nb_partitions() == 1) {
+        for (idx_t j = 0; j < grid.size(); ++j) {
+            part[j] = 0;
+        }
+        return;
+    }
+    throw_Exception("Partitioner [" + type() + "] does not support weighted partitioning", Here());
+}
+
+Distribution Partitioner::partition(const Grid& grid, const double weights[]) const {
+    return new distribution::DistributionArray{grid, atlas::grid::Partitioner(this), weights};
+}
+
 namespace {
 
 template <typename T>
@@ -89,6 +110,7 @@ struct force_link {
         load_builder<CubedSpherePartitioner>();
         load_builder<BandsPartitioner>();
         load_builder<EqualBandsPartitioner>();
+        load_builder<HilbertPartitioner>();
         load_builder<RegularBandsPartitioner>();
         load_builder<SerialPartitioner>();
 #if ATLAS_HAVE_TRANS
@@ -37,18 +37,29 @@ public:
 public:
     Partitioner();
     Partitioner(const idx_t nb_partitions);
+    Partitioner(const idx_t nb_partitions, const eckit::Parametrisation&);
     virtual ~Partitioner();
 
     virtual void partition(const Grid& grid, int part[]) const = 0;
 
     virtual Distribution partition(const Grid& grid) const;
 
+    /// @brief Partition grid so that the sum of weights is balanced over partitions
+    /// @param weights  per grid point cost, indexed by (0-based) global index
+    virtual void partition(const Grid& grid, const double weights[], int part[]) const;
+
+    virtual Distribution partition(const Grid& grid, const double weights[]) const;
+
     idx_t nb_partitions() const;
 
+    /// @brief Name of the MPI communicator over which distributed input is combined
+    const std::string& mpi_comm() const { return mpi_comm_; }
+
     virtual std::string type() const = 0;
 
 private:
     idx_t nb_partitions_;
+    std::string mpi_comm_;
 };
 
 // ------------------------------------------------------------------
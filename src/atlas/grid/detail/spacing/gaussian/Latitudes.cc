@@ -12,8 +12,12 @@
 /// @author Willem Deconinck
 /// @date   Jan 2014
 
+#include <atomic>
+#include <cmath>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 #include "eckit/log/Bytes.h"
 
@@ -21,6 +25,7 @@
 #include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/grid/detail/spacing/gaussian/N.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -97,131 +102,76 @@ namespace {  // Anonymous namespace
 
 //-----------------------------------------------------------------------------
 
-void legpol_newton_iteration(size_t kn, const double pfn[], double px, double& pxn, double& pxmod) {
-    // Routine to perform a single Newton iteration step to find
-    //                the zero of the ordinary Legendre polynomial of degree N
-
-    //        Explicit arguments :
-    //        --------------------
-    //          KN       :  Degree of the Legendre polynomial              (in)
-    //          KODD     :  odd or even number of latitudes                (in)
-    //          PFN      :  Fourier coefficients of series expansion       (in)
-    //                      for the ordinary Legendre polynomials
-    //          PX       :  abcissa where the computations are performed   (in)
-    //          PXN      :  new abscissa (Newton iteration)                (out)
-    //          PXMOD    :  PXN-PX                                         (out)
-
-    double zdlx, zdlk, zdlldn, zdlxn, zdlmod;
-    size_t ik;
-    size_t kodd = kn % 2;  // mod(kn,2)
-
-    zdlx = px;
-    zdlk = 0.;
-    if (kodd == 0) {
-        zdlk = 0.5 * pfn[0];
-    }
-    zdlxn  = 0.;
-    zdlldn = 0.;
-    ik     = 1;
-
-    // Newton interation step
-    // ----------------------
-    for (size_t jn = 2 - kodd; jn <= kn; jn += 2) {
-        // normalised ordinary Legendre polynomial == \overbar{P_n}^0
-        zdlk += pfn[ik] * std::cos(static_cast<double>(jn) * zdlx);
-        // normalised derivative == d/d\theta(\overbar{P_n}^0)
-        zdlldn -= pfn[ik] * static_cast<double>(jn) * std::sin(static_cast<double>(jn) * zdlx);
-        ++ik;
-    }
-    // Newton method
-    zdlmod = -zdlk / zdlldn;
-    zdlxn  = zdlx + zdlmod;
-    pxn    = zdlxn;
-    pxmod  = zdlmod;
-}
-
-void legpol_weight(const size_t kn, const double pfn[], const double px, double& pw) {
-    // Routine to compute the quadrature weight of the legendre polynomial
-
-    //        Explicit arguments :
-    //        --------------------
-    //          KN       :  Degree of the Legendre polynomial              (in)
-    //          KODD     :  odd or even number of latitudes                (in)
-    //          PFN      :  Fourier coefficients of series expansion       (in)
-    //                      for the ordinary Legendre polynomials
-    //          PX       :  abcissa where the computations are performed   (in)
-    //          KFLAG    :  When KFLAG.EQ.1 computes the weights           (in)
-    //          PXN      :  new abscissa (Newton iteration)                (out)
-    //          PXMOD    :  PXN-PX                                         (out)
-
-    double zdlx, zdlldn;
-    size_t ik;
-    size_t kodd = kn % 2;
-
-    zdlx   = px;
-    zdlldn = 0.;
-    ik     = 1;
-
-    // Compute weights
-    // ---------------
-    for (size_t jn = 2 - kodd; jn <= kn; jn += 2) {
-        zdlldn -= pfn[ik] * static_cast<double>(jn) * std::sin(static_cast<double>(jn) * zdlx);
-        ++ik;
+// Nodes are computed by Newton iteration on the colatitude theta, evaluating the ordinary Legendre
+// polynomial P_n(cos theta) and its derivative d/dtheta in O(1) per node with the asymptotic expansion
+// of Stieltjes (see Hale & Townsend, SIAM J. Sci. Comput. 35, 2013). Close to the pole where the
+// expansion does not converge, a fixed number of nodes independent of n, the recurrence is used.
+
+// Nodes with 2 n sin(theta) below this threshold use the recurrence
+constexpr double legpol_interior_threshold = 60.;
+constexpr size_t legpol_interior_max_terms = 30;
+
+// Constant C_n = (4/pi) prod_{j=1}^{n} j/(j+1/2) = 2/sqrt(pi) Gamma(n+1)/Gamma(n+3/2) of the
+// interior expansion, with the Stirling series for the ratio of Gamma functions when n is large
+double legpol_interior_constant(const size_t kn) {
+    if (kn < 100) {
+        double cn = 4. / M_PI;
+        for (size_t j = 1; j <= kn; ++j) {
+            cn *= static_cast<double>(j) / (static_cast<double>(j) + 0.5);
+        }
+        return cn;
     }
-    pw = static_cast<double>(2 * kn + 1) / (zdlldn * zdlldn);
+    auto stirling = [](double z) {
+        const double z2 = z * z;
+        return (1. / 12. - (1. / 360. - (1. / 1260. - 1. / (1680. * z2)) / z2) / z2) / z;
+    };
+    const double n = static_cast<double>(kn);
+    const double a = n + 1.;
+    const double b = n + 1.5;
+    const double d = -(n + 0.5) * std::log1p(0.5 / a) - 0.5 * std::log(b) + 0.5 + stirling(a) - stirling(b);
+    return 2. / std::sqrt(M_PI) * std::exp(d);
 }
 
-//-----------------------------------------------------------------------------
-
-void legpol_quadrature(const size_t kn, const double pfn[], double& pl, double& pw, size_t& kiter, double& pmod) {
-    //**** *GAWL * - Routine to perform the Newton loop
-
-    //     Purpose.
-    //     --------
-    //           Find 0 of Legendre polynomial with Newton loop
-    //**   Interface.
-    //     ----------
-    //        *CALL* *GAWL(PFN,PL,PW,PEPS,KN,KITER,PMOD)
-
-    //        Explicit arguments :
-    //        --------------------
-    // PFN    Fourier coefficients of series expansion
-    //        for the ordinary Legendre polynomials     (in)
-    // PL     Gaussian latitude                         (inout)
-    // PEPS   0 of the machine                          (in)
-    // KN     Truncation                                (in)
-    // KITER  Number of iterations                      (out)
-    // PMOD   Last modification                         (inout)
-
-    constexpr size_t itemax = 20;
-    constexpr double ztol = std::numeric_limits<double>::epsilon() * 1000.;
-
-    double zx  = pl;
-    double zxn;
-    double zw;
-    bool tol_reached = false;
-
-    for (size_t jter = 1; jter <= itemax + 1; ++jter) {
-        kiter = jter;
-        legpol_newton_iteration(kn, pfn, zx, zxn, pmod);
-        zx = zxn;
-        if (tol_reached) {
-            legpol_weight(kn, pfn, zx, zw);
+// P_n(cos theta) ~ C_n sum_m h_m cos((n+m+1/2) theta - (m+1/2) pi/2) / (2 sin theta)^(m+1/2)
+void legpol_interior(const size_t kn, const double cn, const double theta, double& p, double& dpdtheta) {
+    const double n    = static_cast<double>(kn);
+    const double cot  = std::cos(theta) / std::sin(theta);
+    const double twos = 2. * std::sin(theta);
+    double hm         = 1.;
+    double scale      = 1. / std::sqrt(twos);
+    p                 = 0.;
+    dpdtheta          = 0.;
+    for (size_t m = 0; m < legpol_interior_max_terms; ++m) {
+        const double mh    = static_cast<double>(m) + 0.5;
+        const double alpha = (n + mh) * theta - mh * M_PI_2;
+        const double cosa  = std::cos(alpha);
+        const double term  = hm * scale;
+        p += term * cosa;
+        dpdtheta -= term * ((n + mh) * std::sin(alpha) + mh * cot * cosa);
+        if (term < std::numeric_limits<double>::epsilon() * 1.e-3) {
             break;
         }
-        if (std::abs(pmod) <= ztol) {
-            tol_reached = true;
-        }
-    }
-    if (not tol_reached) {
-        std::stringstream s;
-        s << "Could not converge gaussian latitude to accuracy [" << ztol << "]\n";
-        s << "after " << itemax << " iterations. Consequently also failed to compute quadrature weight.";
-        throw_Exception(s.str(), Here());
+        hm *= mh * mh / ((static_cast<double>(m) + 1.) * (n + mh + 1.));
+        scale /= twos;
     }
+    p *= cn;
+    dpdtheta *= cn;
+}
 
-    pl = zxn;
-    pw = zw;
+// Three-term recurrence in terms of u = 1 - cos(theta) = 2 sin^2(theta/2) and differences
+// d_k = P_k - P_(k-1), which retains accuracy close to the pole where cos(theta) ~ 1
+void legpol_recurrence(const size_t kn, const double theta, double& p, double& dpdtheta) {
+    const double sin_half = std::sin(0.5 * theta);
+    const double u        = 2. * sin_half * sin_half;
+    double dk         = -u;
+    double pk         = 1. + dk;
+    for (size_t k = 1; k < kn; ++k) {
+        const double k_d = static_cast<double>(k);
+        dk               = (k_d * dk - (2. * k_d + 1.) * u * pk) / (k_d + 1.);
+        pk += dk;
+    }
+    p        = pk;
+    dpdtheta = -static_cast<double>(kn) * (u * pk - dk) / std::sin(theta);
 }
 
 //-----------------------------------------------------------------------------
@@ -234,47 +184,59 @@ void compute_gaussian_quadrature_npole_equator(const size_t N, double lats[], do
     Log::debug() << "Atlas computing Gaussian latitudes for N " << N << std::endl;
     ATLAS_TRACE();
 
-    size_t kdgl = 2 * N;
-
-    // Computation of Fourier coefficients of series expansion for the ordinary Legendre polynomials
-    std::vector<double> zzfn(N + 1);
-    {
-        // Belousov, Swarztrauber use zfn(0)=std::sqrt(2.)
-        // IFS normalisation chosen to be 0.5*Integral(Pnm**2) = 1
-        constexpr double zfn_0 = 2.;
-        std::vector<double> zfn(kdgl+1);
-        zfn[0] = zfn_0;
-        for (size_t jn = 1; jn <= kdgl; ++jn) {
-            zfn[jn] = zfn_0;
-            for (size_t jgl = 1; jgl <= jn; ++jgl) {
-                zfn[jn] *= std::sqrt(1. - 0.25 / (static_cast<double>(jgl * jgl)));
-            }
-            size_t iodd = jn % 2;
-            for (size_t jgl = 2; jgl <= jn - iodd; jgl += 2) {
-                zfn[jn - jgl] = zfn[jn - jgl + 2] * static_cast<double>((jgl - 1) * (2 * jn - jgl + 2)) /
-                                    static_cast<double>(jgl * (2 * jn - jgl + 1));
-            }
-        }
+    const size_t kdgl = 2 * N;
+    const double n    = static_cast<double>(kdgl);
+    const double cn   = legpol_interior_constant(kdgl);
 
-        size_t iodd   = kdgl % 2;
-        for (size_t jgl = iodd, ik = iodd; jgl <= kdgl; jgl += 2, ++ik) {
-            zzfn[ik] = zfn[jgl];
-        }
-    }
+    constexpr size_t itemax = 20;
+    constexpr double ztol   = std::numeric_limits<double>::epsilon() * 1000.;
 
-    for (size_t jgl = 0; jgl < N; ++jgl) {
+    std::atomic<bool> converged{true};
+    atlas_omp_parallel_for(size_t jgl = 0; jgl < N; ++jgl) {
         // Compute first guess for colatitudes in radians
-        double z  = (4. * (jgl + 1.) - 1.) * M_PI / (4. * 2. * N + 2.);
-        lats[jgl] = (z + 1. / (std::tan(z) * (8. * (2. * N) * (2. * N))));
+        double z = (4. * (jgl + 1.) - 1.) * M_PI / (4. * n + 2.);
+        z += 1. / (std::tan(z) * (8. * n * n));
 
-        // refine colat first guess here via Newton's method
-        size_t iter;
-        double zmod;
-        legpol_quadrature(kdgl, zzfn.data(), lats[jgl], weights[jgl], iter, zmod);
+        const bool interior = 2. * n * std::sin(z) >= legpol_interior_threshold;
+        auto legpol         = [&](double theta, double& p, double& dpdtheta) {
+            if (interior) {
+                legpol_interior(kdgl, cn, theta, p, dpdtheta);
+            }
+            else {
+                legpol_recurrence(kdgl, theta, p, dpdtheta);
+            }
+        };
+
+        // refine colat first guess here via Newton's method, with one more step once converged
+        double p, dpdtheta;
+        bool tol_reached = false;
+        for (size_t jter = 1; jter <= itemax + 1; ++jter) {
+            legpol(z, p, dpdtheta);
+            const double zmod = -p / dpdtheta;
+            z += zmod;
+            if (tol_reached) {
+                break;
+            }
+            if (std::abs(zmod) <= ztol) {
+                tol_reached = true;
+            }
+        }
+        if (not tol_reached) {
+            converged = false;
+        }
+        legpol(z, p, dpdtheta);
+        // Gauss-Legendre weight 2 / (dP_n/dtheta)^2, halved so that weights sum to 1 over the sphere
+        weights[jgl] = 1. / (dpdtheta * dpdtheta);
 
         // Convert colat to lat, in degrees
         constexpr double pole = 90.;
-        lats[jgl] = pole - lats[jgl] * util::Constants::radiansToDegrees();
+        lats[jgl]             = pole - z * util::Constants::radiansToDegrees();
+    }
+    if (not converged) {
+        std::stringstream s;
+        s << "Could not converge gaussian latitudes to accuracy [" << ztol << "]\n";
+        s << "after " << itemax << " iterations. Consequently also failed to compute quadrature weights.";
+        throw_Exception(s.str(), Here());
     }
 }
 
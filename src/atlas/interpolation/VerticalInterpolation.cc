@@ -0,0 +1,273 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/interpolation/VerticalInterpolation.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "eckit/config/Configuration.h"
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/grid/Vertical.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace interpolation {
+
+namespace {
+
+// Number of columns interpolated together. The source values of a block are staged with the columns
+// contiguous, so that the loop over the columns of the block has unit stride.
+static constexpr idx_t block_size = 16;
+
+template <typename Value>
+array::LocalView<Value, 3> make_leveled_view(const Field& field) {
+    using namespace array;
+    if (field.rank() == 3) {
+        return make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all());
+    }
+    ATLAS_ASSERT(field.rank() == 2, "Vertical interpolation requires fields of shape (columns, levels[, variables])");
+    return make_view<Value, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+}
+
+void check_coordinates(const Field& z) {
+    ATLAS_ASSERT(z.rank() == 2, "Vertical coordinates must be of shape (columns, levels)");
+    ATLAS_ASSERT(z.datatype() == array::make_datatype<double>(), "Vertical coordinates must be of type double");
+}
+
+}  // namespace
+
+VerticalInterpolation::VerticalInterpolation(const Vertical& source, const Vertical& target,
+                                             const eckit::Configuration& config) {
+    configure(config);
+    source_levels_ = source.size();
+    target_levels_ = target.size();
+    setup([&source](idx_t, idx_t k) { return source[k]; }, [&target](idx_t, idx_t k) { return target[k]; });
+}
+
+VerticalInterpolation::VerticalInterpolation(const Field& source, const Vertical& target,
+                                             const eckit::Configuration& config) {
+    configure(config);
+    check_coordinates(source);
+    const auto source_z = array::make_view<const double, 2>(source);
+    columns_            = source_z.shape(0);
+    source_levels_      = source_z.shape(1);
+    target_levels_      = target.size();
+    setup([&source_z](idx_t c, idx_t k) { return source_z(c, k); }, [&target](idx_t, idx_t k) { return target[k]; });
+}
+
+VerticalInterpolation::VerticalInterpolation(const Field& source, const Field& target,
+                                             const eckit::Configuration& config) {
+    configure(config);
+    check_coordinates(source);
+    check_coordinates(target);
+    const auto source_z = array::make_view<const double, 2>(source);
+    const auto target_z = array::make_view<const double, 2>(target);
+    ATLAS_ASSERT(source_z.shape(0) == target_z.shape(0));
+    columns_       = source_z.shape(0);
+    source_levels_ = source_z.shape(1);
+    target_levels_ = target_z.shape(1);
+    setup([&source_z](idx_t c, idx_t k) { return source_z(c, k); },
+          [&target_z](idx_t c, idx_t k) { return target_z(c, k); });
+}
+
+void VerticalInterpolation::configure(const eckit::Configuration& config) {
+    std::string scheme = config.getString("scheme", "linear");
+    if (scheme == "linear") {
+        stencil_width_ = 2;
+    }
+    else if (scheme == "cubic") {
+        stencil_width_ = 4;
+    }
+    else {
+        throw_Exception("Vertical interpolation scheme \"" + scheme + "\" not recognised, use linear or cubic",
+                        Here());
+    }
+    limiter_ = config.getBool("limiter", false);
+}
+
+template <typename SourceZ, typename TargetZ>
+void VerticalInterpolation::setup(const SourceZ& source_z, const TargetZ& target_z) {
+    ATLAS_TRACE("atlas::interpolation::VerticalInterpolation::setup");
+    const idx_t ns    = source_levels_;
+    const idx_t nt    = target_levels_;
+    const idx_t width = stencil_width_;
+    ATLAS_ASSERT(ns >= width, "Not enough source levels for vertical interpolation scheme");
+
+    const idx_t nb_columns = std::max<idx_t>(columns_, 1);
+    k_begin_.resize(nb_columns * nt);
+    k_lower_.resize(nb_columns * nt);
+    weights_.assign(nb_columns * nt * width, 0.);
+
+    atlas_omp_parallel_for(idx_t c = 0; c < nb_columns; ++c) {
+        // Coordinates of decreasing columns are negated, which leaves the weights unchanged
+        const double sign = source_z(c, ns - 1) >= source_z(c, 0) ? 1. : -1.;
+        auto zs           = [&](idx_t k) { return sign * source_z(c, k); };
+
+        // Target levels are mostly monotonic too, so that the interval is found by walking from the previous one
+        idx_t k = 0;
+        for (idx_t t = 0; t < nt; ++t) {
+            const idx_t n  = c * nt + t;
+            const double z = sign * target_z(c, t);
+            while (k > 0 && z < zs(k)) {
+                --k;
+            }
+            while (k < ns - 2 && z >= zs(k + 1)) {
+                ++k;
+            }
+            k_lower_[n] = k;
+            double* w   = weights_.data() + n * width;
+
+            if (z <= zs(0)) {
+                // constant extrapolation
+                k_begin_[n] = 0;
+                w[0]        = 1.;
+                continue;
+            }
+            if (z >= zs(ns - 1)) {
+                // constant extrapolation
+                k_begin_[n]  = ns - width;
+                w[width - 1] = 1.;
+                continue;
+            }
+            if (width == 4 && k > 0 && k < ns - 2) {
+                // cubic Lagrange interpolation
+                // lev(k-1)   lev(k)   lev(k+1)   lev(k+2)
+                //    |          |     x    |          |
+                k_begin_[n] = k - 1;
+                double zk[4];
+                for (idx_t m = 0; m < 4; ++m) {
+                    zk[m] = zs(k - 1 + m);
+                }
+                for (idx_t m = 0; m < 4; ++m) {
+                    double weight = 1.;
+                    for (idx_t l = 0; l < 4; ++l) {
+                        if (l != m) {
+                            weight *= (z - zk[l]) / (zk[m] - zk[l]);
+                        }
+                    }
+                    w[m] = weight;
+                }
+                continue;
+            }
+            // linear interpolation, also in the first and last interval for cubic
+            k_begin_[n]            = std::min(std::max<idx_t>(k - (width - 2) / 2, 0), ns - width);
+            const double alpha     = (z - zs(k)) / (zs(k + 1) - zs(k));
+            w[k - k_begin_[n]]     = 1. - alpha;
+            w[k + 1 - k_begin_[n]] = alpha;
+        }
+    }
+}
+
+void VerticalInterpolation::execute(const FieldSet& source, FieldSet& target) const {
+    ATLAS_ASSERT(source.size() == target.size());
+    for (idx_t i = 0; i < source.size(); ++i) {
+        execute(source[i], target[i]);
+    }
+}
+
+void VerticalInterpolation::execute(const Field& source, Field& target) const {
+    ATLAS_TRACE("atlas::interpolation::VerticalInterpolation::execute");
+    ATLAS_ASSERT(source.datatype() == target.datatype());
+    ATLAS_ASSERT(source.rank() == target.rank());
+    if (source.datatype().kind() == array::DataType::KIND_REAL64) {
+        interpolate<double>(source, target);
+    }
+    else if (source.datatype().kind() == array::DataType::KIND_REAL32) {
+        interpolate<float>(source, target);
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
+    target.set_dirty();
+}
+
+template <typename Value>
+void VerticalInterpolation::interpolate(const Field& source, Field& target) const {
+    const auto src = make_leveled_view<const Value>(source);
+    auto tgt       = make_leveled_view<Value>(target);
+
+    const idx_t nb_columns = src.shape(0);
+    const idx_t nt         = target_levels_;
+    const idx_t nb_vars    = src.shape(2);
+    const idx_t width      = stencil_width_;
+    ATLAS_ASSERT(tgt.shape(0) == nb_columns);
+    ATLAS_ASSERT(columns_ == 0 || columns_ == nb_columns);
+    ATLAS_ASSERT(src.shape(1) == source_levels_);
+    ATLAS_ASSERT(tgt.shape(1) == target_levels_);
+    ATLAS_ASSERT(tgt.shape(2) == nb_vars);
+
+    const bool common_levels = (columns_ == 0);
+    const idx_t ns           = source_levels_;
+    const idx_t nb_blocks    = (nb_columns + block_size - 1) / block_size;
+
+    atlas_omp_parallel {
+        std::vector<double> stage(ns * block_size);  // (levels, block) source values of one variable
+        std::vector<double> value(block_size);
+        atlas_omp_for(idx_t b = 0; b < nb_blocks; ++b) {
+            const idx_t c_begin = b * block_size;
+            const idx_t nb      = std::min(block_size, nb_columns - c_begin);
+            for (idx_t v = 0; v < nb_vars; ++v) {
+                for (idx_t j = 0; j < nb; ++j) {
+                    for (idx_t k = 0; k < ns; ++k) {
+                        stage[k * block_size + j] = src(c_begin + j, k, v);
+                    }
+                }
+                for (idx_t t = 0; t < nt; ++t) {
+                    if (common_levels) {
+                        // Same stencil and weights for all columns
+                        const double* w = weights_.data() + t * width;
+                        const double* f = stage.data() + k_begin_[t] * block_size;
+                        for (idx_t j = 0; j < nb; ++j) {
+                            value[j] = 0.;
+                        }
+                        for (idx_t m = 0; m < width; ++m) {
+                            for (idx_t j = 0; j < nb; ++j) {
+                                value[j] += w[m] * f[m * block_size + j];
+                            }
+                        }
+                    }
+                    else {
+                        for (idx_t j = 0; j < nb; ++j) {
+                            const idx_t n   = (c_begin + j) * nt + t;
+                            const double* w = weights_.data() + n * width;
+                            const double* f = stage.data() + k_begin_[n] * block_size + j;
+                            double sum      = 0.;
+                            for (idx_t m = 0; m < width; ++m) {
+                                sum += w[m] * f[m * block_size];
+                            }
+                            value[j] = sum;
+                        }
+                    }
+                    if (limiter_) {
+                        for (idx_t j = 0; j < nb; ++j) {
+                            const idx_t n   = common_levels ? t : (c_begin + j) * nt + t;
+                            const double f1 = stage[k_lower_[n] * block_size + j];
+                            const double f2 = stage[(k_lower_[n] + 1) * block_size + j];
+                            value[j]        = std::min(std::max(value[j], std::min(f1, f2)), std::max(f1, f2));
+                        }
+                    }
+                    for (idx_t j = 0; j < nb; ++j) {
+                        tgt(c_begin + j, t, v) = static_cast<Value>(value[j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace interpolation
+}  // namespace atlas
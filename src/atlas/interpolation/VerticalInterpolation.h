@@ -0,0 +1,90 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/util/Config.h"
+
+namespace eckit {
+class Configuration;
+}
+
+namespace atlas {
+class Field;
+class FieldSet;
+class Vertical;
+}  // namespace atlas
+
+namespace atlas {
+namespace interpolation {
+
+/**
+ * @brief Column-wise interpolation between two sets of vertical levels
+ *
+ * The vertical coordinates of source and target are either a Vertical, common to all columns,
+ * or a Field of shape (columns, levels) such as model level pressure. Coordinates of a column
+ * must be monotonic, increasing or decreasing. Level indices and weights are computed once at
+ * construction, and shared by all columns when both coordinates are a Vertical.
+ *
+ * Fields to interpolate have shape (columns, levels) or (columns, levels, variables).
+ * Target levels outside of the source levels are extrapolated with the value of the nearest level.
+ *
+ * Configuration:
+ *   - "scheme"  : "linear" (default) or "cubic". Cubic interpolation reverts to linear in the first
+ *                 and last interval of the source levels.
+ *   - "limiter" : (default false) limit interpolated values to the range of the two source values
+ *                 surrounding the target level, so that interpolation is monotone.
+ */
+class VerticalInterpolation {
+public:
+    VerticalInterpolation(const Vertical& source, const Vertical& target,
+                          const eckit::Configuration& = util::NoConfig());
+    VerticalInterpolation(const Field& source, const Vertical& target, const eckit::Configuration& = util::NoConfig());
+    VerticalInterpolation(const Field& source, const Field& target, const eckit::Configuration& = util::NoConfig());
+
+    void execute(const Field& source, Field& target) const;
+    void execute(const FieldSet& source, FieldSet& target) const;
+
+    /// @brief Number of levels of the source
+    idx_t source_levels() const { return source_levels_; }
+
+    /// @brief Number of levels of the target
+    idx_t target_levels() const { return target_levels_; }
+
+    /// @brief Number of columns, or 0 when the levels are common to any number of columns
+    idx_t columns() const { return columns_; }
+
+private:
+    void configure(const eckit::Configuration&);
+
+    template <typename SourceZ, typename TargetZ>
+    void setup(const SourceZ& source_z, const TargetZ& target_z);
+
+    template <typename Value>
+    void interpolate(const Field& source, Field& target) const;
+
+    idx_t stencil_width_{2};
+    bool limiter_{false};
+    idx_t source_levels_{0};
+    idx_t target_levels_{0};
+    idx_t columns_{0};
+
+    // Per (column, target level): first source level of the stencil, lower source level of the
+    // interval containing the target level, and stencil weights
+    std::vector<idx_t> k_begin_;
+    std::vector<idx_t> k_lower_;
+    std::vector<double> weights_;
+};
+
+}  // namespace interpolation
+}  // namespace atlas
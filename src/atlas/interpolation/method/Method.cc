@@ -8,7 +8,10 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include "atlas/interpolation/method/Method.h"
 
@@ -20,6 +23,7 @@
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/linalg/sparse.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -95,6 +99,42 @@ void set_missing_values(Field& tgt, const std::vector<idx_t>& missing) {
     }
 }
 
+template <typename Value>
+array::LocalView<Value, 3> make_leveled_view(const Field& field) {
+    using namespace array;
+    if (field.rank() == 3) {
+        return make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all());
+    }
+    if (field.rank() == 2) {
+        return make_view<Value, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+    }
+    return make_view<Value, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
+}
+
+// Scatter-add the transposed rows [row_begin, row_end) of W applied to tgt into out,
+// whose first index is offset by col_offset
+template <typename Value>
+void adjoint_scatter_add(const eckit::linalg::SparseMatrix& W, idx_t row_begin, idx_t row_end,
+                         const array::LocalView<const Value, 3>& tgt, array::LocalView<Value, 3>& out,
+                         idx_t col_offset) {
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t Nj    = tgt.shape(1);
+    const idx_t Nk    = tgt.shape(2);
+    for (idx_t r = row_begin; r < row_end; ++r) {
+        for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+            const idx_t n = index[c] - col_offset;
+            const Value w = static_cast<Value>(weight[c]);
+            for (idx_t j = 0; j < Nj; ++j) {
+                for (idx_t k = 0; k < Nk; ++k) {
+                    out(n, j, k) += w * tgt(r, j, k);
+                }
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 
@@ -166,69 +206,6 @@ void Method::interpolate_field_rank3(const Field& src, Field& tgt, const Matrix&
     sparse_matrix_multiply(W, src_v, tgt_v, sparse::backend::openmp());
 }
 
-template <typename Value>
-void Method::adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 1>(tmp);
-    auto src_v = array::make_view<Value, 1>(src);
-    auto tgt_v = array::make_view<Value, 1>(tgt);
-
-    tmp_v.assign(0.);
-
-    if (std::is_same<Value, float>::value) {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-    }
-    else {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::Backend{linalg_backend_});
-    }
-
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        src_v(t) += tmp_v(t);
-    }
-}
-
-template <typename Value>
-void Method::adjoint_interpolate_field_rank2(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 2>(tmp);
-    auto src_v = array::make_view<Value, 2>(src);
-    auto tgt_v = array::make_view<Value, 2>(tgt);
-
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t k = 0; k < tmp.shape(1); ++k) {
-            src_v(t, k) += tmp_v(t, k);
-        }
-    }
-}
-
-template <typename Value>
-void Method::adjoint_interpolate_field_rank3(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 3>(tmp);
-    auto src_v = array::make_view<Value, 3>(src);
-    auto tgt_v = array::make_view<Value, 3>(tgt);
-
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t j = 0; j < tmp.shape(1); ++j) {
-            for (idx_t k = 0; k < tmp.shape(2); ++k) {
-                src_v(t, j, k) += tmp_v(t, j, k);
-            }
-        }
-    }
-}
-
 void Method::check_compatibility(const Field& src, const Field& tgt, const Matrix& W) const {
     ATLAS_ASSERT(src.datatype() == tgt.datatype());
     ATLAS_ASSERT(src.rank() == tgt.rank());
@@ -270,19 +247,36 @@ void Method::adjoint_interpolate_field(Field& src, const Field& tgt, const Matri
     if (tgt.shape(0) == 0) {
         return;
     }
-    check_compatibility(tgt, src, W);
-
-    if (src.rank() == 1) {
-        adjoint_interpolate_field_rank1<Value>(src, tgt, W);
-    }
-    else if (src.rank() == 2) {
-        adjoint_interpolate_field_rank2<Value>(src, tgt, W);
+    check_compatibility(src, tgt, W);
+    if (src.rank() > 3) {
+        ATLAS_NOTIMPLEMENTED;
     }
-    else if (src.rank() == 3) {
-        adjoint_interpolate_field_rank3<Value>(src, tgt, W);
+
+    if (src.rank() == 1 && std::is_same<Value, double>::value && not matrix_transpose_.empty()) {
+        // A sparse backend other than openmp is configured: apply it to the stored transpose
+        array::ArrayT<Value> tmp(src.shape());
+        auto tmp_v = array::make_view<Value, 1>(tmp);
+        auto src_v = array::make_view<Value, 1>(src);
+        auto tgt_v = array::make_view<Value, 1>(tgt);
+        tmp_v.assign(0.);
+        sparse_matrix_multiply(matrix_transpose_, tgt_v, tmp_v, sparse::Backend{linalg_backend_});
+        for (idx_t t = 0; t < tmp.shape(0); ++t) {
+            src_v(t) += tmp_v(t);
+        }
+        return;
     }
-    else {
-        ATLAS_NOTIMPLEMENTED;
+
+    auto src_v = make_leveled_view<Value>(src);
+    auto tgt_v = make_leveled_view<const Value>(tgt);
+
+    // Even blocks, then odd blocks, scatter-add concurrently and directly into the source.
+    // Each source column receives its contributions in an order fixed by the blocks alone,
+    // so that results do not depend on the number of threads.
+    const idx_t nb_blocks = static_cast<idx_t>(adjoint_row_blocks_.size()) - 1;
+    for (idx_t colour = 0; colour < 2; ++colour) {
+        atlas_omp_parallel_for(idx_t b = colour; b < nb_blocks; b += 2) {
+            adjoint_scatter_add(W, adjoint_row_blocks_[b], adjoint_row_blocks_[b + 1], tgt_v, src_v, 0);
+        }
     }
 }
 
@@ -302,12 +296,61 @@ void Method::setup(const FunctionSpace& source, const FunctionSpace& target) {
     this->do_setup(source, target);
 
     if (adjoint_) {
+        setup_adjoint();
+    }
+}
+
+void Method::setup_adjoint() {
+    ATLAS_TRACE("atlas::interpolation::method::Method::setup_adjoint()");
+    adjoint_row_blocks_.clear();
+    matrix_transpose_ = Matrix();
+
+    // if interpolation is matrix free then matrix->nonZeros() will be zero.
+    if (matrix_ == nullptr || (matrix_->nonZeros() == 0 && matrix_->rows() > 0)) {
+        return;
+    }
+
+    // The openmp backend is replaced by scatter-adding through the forward matrix; other backends
+    // are still applied to an explicit transpose for rank-1 double precision fields
+    if (sparse::Backend{linalg_backend_}.type() != sparse::backend::openmp::type()) {
         Matrix tmp(*matrix_);
+        matrix_transpose_ = tmp.transpose();
+    }
+
+    const auto& W    = *matrix_;
+    const auto outer = W.outer();
+    const auto index = W.inner();
+    const idx_t rows = static_cast<idx_t>(W.rows());
+
+    // prefix_end[r]: end of the source columns of rows before r
+    // suffix_begin[r]: begin of the source columns of rows from r onwards
+    std::vector<idx_t> prefix_end(rows + 1, 0);
+    std::vector<idx_t> suffix_begin(rows + 1, std::numeric_limits<idx_t>::max());
+    for (idx_t r = 0; r < rows; ++r) {
+        idx_t row_end = 0;
+        for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+            row_end = std::max<idx_t>(row_end, index[c] + 1);
+        }
+        prefix_end[r + 1] = std::max(prefix_end[r], row_end);
+    }
+    for (idx_t r = rows - 1; r >= 0; --r) {
+        idx_t row_begin = std::numeric_limits<idx_t>::max();
+        for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+            row_begin = std::min<idx_t>(row_begin, index[c]);
+        }
+        suffix_begin[r] = std::min(suffix_begin[r + 1], row_begin);
+    }
 
-        // if interpolation is matrix free then matrix->nonZeros() will be zero.
-        if (tmp.nonZeros() > 0) {
-            matrix_transpose_ = tmp.transpose();
+    // Each block is grown until it separates all preceding rows from all following rows,
+    // so that blocks two apart never share a source column
+    constexpr idx_t min_block_rows = 64;
+    adjoint_row_blocks_.push_back(0);
+    for (idx_t begin = 0, end = 0; begin < rows; begin = end) {
+        end = std::min(begin + min_block_rows, rows);
+        while (end < rows && suffix_begin[end] < prefix_end[begin]) {
+            ++end;
         }
+        adjoint_row_blocks_.push_back(end);
     }
 }
 
@@ -396,24 +439,28 @@ void Method::do_execute(const Field& src, Field& tgt, Metadata&) const {
     }
 
     // carry over missing value metadata
+    set_missing_value_metadata(src, tgt, not missing_.empty());
+
+    // set missing values
+    set_missing_values(tgt, missing_);
+
+    tgt.set_dirty();
+}
+
+void Method::set_missing_value_metadata(const Field& src, Field& tgt, bool has_missing) {
     if (not tgt.metadata().has("missing_value")) {
         field::MissingValue mv_src(src);
         if (mv_src) {
             mv_src.metadata(tgt);
             ATLAS_ASSERT(field::MissingValue(tgt));
         }
-        else if (not missing_.empty()) {
+        else if (has_missing) {
             if (not tgt.metadata().has("missing_value")) {
                 tgt.metadata().set("missing_value", 9999.);
             }
             tgt.metadata().set("missing_value_type", "equals");
         }
     }
-
-    // set missing values
-    set_missing_values(tgt, missing_);
-
-    tgt.set_dirty();
 }
 
 void Method::do_execute_adjoint(FieldSet& fieldsSource, const FieldSet& fieldsTarget, Metadata& metadata) const {
@@ -438,18 +485,20 @@ void Method::do_execute_adjoint(Field& src, const Field& tgt, Metadata&) const {
         throw_NotImplemented("Adjoint Interpolation does not work for fields that have missing data. ", Here());
     }
 
-    if (matrix_transpose_.empty()) {
+    if (not adjoint_ || (matrix_ && adjoint_row_blocks_.empty())) {
         throw_AssertionFailed("Need to set 'adjoint coefficients' to true in config for adjoint interpolation to work");
     }
 
-    if (src.datatype().kind() == array::DataType::KIND_REAL64) {
-        adjoint_interpolate_field<double>(src, tgt, matrix_transpose_);
-    }
-    else if (src.datatype().kind() == array::DataType::KIND_REAL32) {
-        adjoint_interpolate_field<float>(src, tgt, matrix_transpose_);
-    }
-    else {
-        ATLAS_NOTIMPLEMENTED;
+    if (matrix_) {  // (matrix == nullptr) when a partition is empty
+        if (src.datatype().kind() == array::DataType::KIND_REAL64) {
+            adjoint_interpolate_field<double>(src, tgt, *matrix_);
+        }
+        else if (src.datatype().kind() == array::DataType::KIND_REAL32) {
+            adjoint_interpolate_field<float>(src, tgt, *matrix_);
+        }
+        else {
+            ATLAS_NOTIMPLEMENTED;
+        }
     }
 
     src.set_dirty();
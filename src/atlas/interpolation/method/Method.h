@@ -97,6 +97,10 @@ protected:
     void adjointHaloExchange(const FieldSet&) const;
     void adjointHaloExchange(const Field&) const;
 
+    // Carry over missing value metadata from source to target, or set a default missing value
+    // when some target points could not be interpolated
+    static void set_missing_value_metadata(const Field& src, Field& tgt, bool has_missing);
+
     // NOTE : Matrix-free or non-linear interpolation operators do not have matrices, so do not expose here
     friend class atlas::test::Access;
     friend class interpolation::MatrixCache;
@@ -143,17 +147,10 @@ private:
     template <typename Value>
     void adjoint_interpolate_field(Field& src, const Field& tgt, const Matrix&) const;
 
-    template <typename Value>
-    void adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix&) const;
-
-    template <typename Value>
-    void adjoint_interpolate_field_rank2(Field& src, const Field& tgt, const Matrix&) const;
-
-    template <typename Value>
-    void adjoint_interpolate_field_rank3(Field& src, const Field& tgt, const Matrix&) const;
-
     void check_compatibility(const Field& src, const Field& tgt, const Matrix& W) const;
 
+    void setup_adjoint();
+
 private:
     const Matrix* matrix_ = nullptr;
     std::shared_ptr<Matrix> matrix_shared_;
@@ -161,6 +158,13 @@ private:
     NonLinear nonLinear_;
     std::string linalg_backend_;
     bool adjoint_{false};
+
+    // Row blocks of the matrix for the adjoint, which scatter-adds through the forward matrix.
+    // Source columns of a block only overlap those of its direct neighbours, so that even and
+    // odd blocks can be applied concurrently.
+    std::vector<idx_t> adjoint_row_blocks_;
+
+    // Transpose of the matrix, only stored when a sparse backend other than openmp is configured
     Matrix matrix_transpose_;
 
 protected:
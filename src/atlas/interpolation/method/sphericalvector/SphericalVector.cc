@@ -0,0 +1,301 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/interpolation/method/sphericalvector/SphericalVector.h"
+
+#include <cmath>
+#include <ostream>
+
+#include "eckit/config/Configuration.h"
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/interpolation/Cache.h"
+#include "atlas/interpolation/method/MethodFactory.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Constants.h"
+#include "atlas/util/CoordinateEnums.h"
+
+namespace atlas {
+namespace interpolation {
+namespace method {
+
+namespace {
+
+MethodBuilder<SphericalVector> __builder("spherical-vector");
+
+using Complex = std::complex<double>;
+
+bool is_vector_field(const Field& field) {
+    return field.metadata().getString("type", "scalar") == "vector";
+}
+
+// Unit vector, and local east and north unit vectors, of a point given in degrees
+struct LocalFrame {
+    LocalFrame(double lon, double lat) {
+        const double lambda     = lon * util::Constants::degreesToRadians();
+        const double phi        = lat * util::Constants::degreesToRadians();
+        const double cos_lambda = std::cos(lambda);
+        const double sin_lambda = std::sin(lambda);
+        const double cos_phi    = std::cos(phi);
+        const double sin_phi    = std::sin(phi);
+        p[0]                    = cos_phi * cos_lambda;
+        p[1]                    = cos_phi * sin_lambda;
+        p[2]                    = sin_phi;
+        east[0]                 = -sin_lambda;
+        east[1]                 = cos_lambda;
+        east[2]                 = 0.;
+        north[0]                = -sin_phi * cos_lambda;
+        north[1]                = -sin_phi * sin_lambda;
+        north[2]                = cos_phi;
+    }
+    double p[3];
+    double east[3];
+    double north[3];
+};
+
+double dot(const double a[], const double b[]) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// Rotation exp(i alpha) of the local frame from source to target, by parallel transport along the
+// great circle: v -> v - (v.q) / (1 + p.q) (p + q), which is regular everywhere except for antipodes
+Complex rotation(const LocalFrame& source, const LocalFrame& target) {
+    const double scale = dot(source.east, target.p) / (1. + dot(source.p, target.p));
+    double east[3];
+    for (int d = 0; d < 3; ++d) {
+        east[d] = source.east[d] - scale * (source.p[d] + target.p[d]);
+    }
+    return Complex{dot(east, target.east), dot(east, target.north)};
+}
+
+template <typename Value>
+array::LocalView<Value, 3> make_vector_view(const Field& field) {
+    using namespace array;
+    if (field.rank() == 3) {
+        return make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all());
+    }
+    ATLAS_ASSERT(field.rank() == 2);
+    return make_view<Value, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+}
+
+void check_vector_field(const Field& field) {
+    ATLAS_ASSERT(field.rank() == 2 || field.rank() == 3, "Vector field must be of rank 2 or 3");
+    const idx_t components = field.shape(field.rank() - 1);
+    ATLAS_ASSERT(components == 2 || components == 3, "Vector field must have 2 or 3 components");
+}
+
+}  // namespace
+
+SphericalVector::SphericalVector(const Config& config): Method(config) {
+    const auto* conf = dynamic_cast<const eckit::Configuration*>(&config);
+    ATLAS_ASSERT(conf, "spherical-vector requires a configuration containing a \"scheme\"");
+    ATLAS_ASSERT(conf->get("scheme", scheme_), "spherical-vector requires a configuration containing a \"scheme\"");
+}
+
+void SphericalVector::print(std::ostream& out) const {
+    out << "SphericalVector[scheme=" << scheme_.getString("type", "") << "]";
+}
+
+void SphericalVector::do_setup(const FunctionSpace& source, const FunctionSpace& target) {
+    ATLAS_TRACE("interpolation::method::SphericalVector::do_setup(FunctionSpace, FunctionSpace)");
+    interpolation_ = Interpolation(scheme_, source, target);
+    setup_complex_weights();
+}
+
+void SphericalVector::do_setup(const Grid& source, const Grid& target, const Cache& cache) {
+    ATLAS_TRACE("interpolation::method::SphericalVector::do_setup(Grid, Grid, Cache)");
+    interpolation_ = Interpolation(scheme_, source, target, cache);
+    setup_complex_weights();
+}
+
+void SphericalVector::setup_complex_weights() {
+    source_ = interpolation_.source();
+    target_ = interpolation_.target();
+
+    const Cache cache = interpolation_.createCache();
+    if (cache.get(MatrixCacheEntry::static_type()) == nullptr) {
+        throw_NotImplemented("spherical-vector requires a scheme that is based on a sparse matrix", Here());
+    }
+    const MatrixCache matrix_cache(cache);
+    complex_weights_.clear();
+    if (not matrix_cache) {
+        return;  // empty partition
+    }
+    setMatrix(matrix_cache);
+
+    const auto& W    = matrix();
+    const auto outer = W.outer();
+    const auto index = W.inner();
+    const auto value = W.data();
+    const idx_t rows = static_cast<idx_t>(W.rows());
+
+    const auto source_lonlat = array::make_view<double, 2>(source_.lonlat());
+    const auto target_lonlat = array::make_view<double, 2>(target_.lonlat());
+
+    complex_weights_.resize(W.nonZeros());
+    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
+        const LocalFrame target_frame(target_lonlat(r, LON), target_lonlat(r, LAT));
+        for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+            const idx_t n = index[c];
+            // Halo points beyond a pole (|lat| > 90, unshifted lon) need no special treatment: their frame is the
+            // negated frame of the point they represent, matching the reversed vector components of the halo
+            // exchange (see FixupHaloForVectors)
+            const LocalFrame source_frame(source_lonlat(n, LON), source_lonlat(n, LAT));
+            complex_weights_[c] = value[c] * rotation(source_frame, target_frame);
+        }
+    }
+}
+
+void SphericalVector::do_execute(const FieldSet& source, FieldSet& target, Metadata& metadata) const {
+    ATLAS_TRACE("atlas::interpolation::method::SphericalVector::do_execute()");
+    ATLAS_ASSERT(source.size() == target.size());
+    for (idx_t i = 0; i < source.size(); ++i) {
+        do_execute(source[i], target[i], metadata);
+    }
+}
+
+void SphericalVector::do_execute(const Field& source, Field& target, Metadata& metadata) const {
+    if (not is_vector_field(source)) {
+        Method::do_execute(source, target, metadata);
+        return;
+    }
+    ATLAS_TRACE("atlas::interpolation::method::SphericalVector::do_execute()");
+    check_vector_field(source);
+    check_vector_field(target);
+    ATLAS_ASSERT(source.datatype() == target.datatype());
+    ATLAS_ASSERT(source.rank() == target.rank());
+
+    haloExchange(source);
+
+    if (not complex_weights_.empty()) {
+        if (source.datatype().kind() == array::DataType::KIND_REAL64) {
+            interpolate_vector_field<double>(source, target);
+        }
+        else if (source.datatype().kind() == array::DataType::KIND_REAL32) {
+            interpolate_vector_field<float>(source, target);
+        }
+        else {
+            ATLAS_NOTIMPLEMENTED;
+        }
+    }
+
+    target.set_dirty();
+}
+
+void SphericalVector::do_execute_adjoint(FieldSet& source, const FieldSet& target, Metadata& metadata) const {
+    ATLAS_TRACE("atlas::interpolation::method::SphericalVector::do_execute_adjoint()");
+    ATLAS_ASSERT(source.size() == target.size());
+    for (idx_t i = 0; i < source.size(); ++i) {
+        do_execute_adjoint(source[i], target[i], metadata);
+    }
+}
+
+void SphericalVector::do_execute_adjoint(Field& source, const Field& target, Metadata& metadata) const {
+    if (not is_vector_field(source)) {
+        Method::do_execute_adjoint(source, target, metadata);
+        return;
+    }
+    ATLAS_TRACE("atlas::interpolation::method::SphericalVector::do_execute_adjoint()");
+    check_vector_field(source);
+    check_vector_field(target);
+    ATLAS_ASSERT(source.datatype() == target.datatype());
+    ATLAS_ASSERT(source.rank() == target.rank());
+
+    if (not complex_weights_.empty()) {
+        if (source.datatype().kind() == array::DataType::KIND_REAL64) {
+            adjoint_interpolate_vector_field<double>(source, target);
+        }
+        else if (source.datatype().kind() == array::DataType::KIND_REAL32) {
+            adjoint_interpolate_vector_field<float>(source, target);
+        }
+        else {
+            ATLAS_NOTIMPLEMENTED;
+        }
+    }
+
+    source.set_dirty();
+
+    adjointHaloExchange(source);
+}
+
+template <typename Value>
+void SphericalVector::interpolate_vector_field(const Field& source, Field& target) const {
+    const auto& W    = matrix();
+    const auto outer = W.outer();
+    const auto index = W.inner();
+    const auto value = W.data();
+    const idx_t rows = static_cast<idx_t>(W.rows());
+
+    const auto src = make_vector_view<const Value>(source);
+    auto tgt       = make_vector_view<Value>(target);
+    ATLAS_ASSERT(tgt.shape(0) >= rows);
+    ATLAS_ASSERT(src.shape(1) == tgt.shape(1) && src.shape(2) == tgt.shape(2));
+    const idx_t levels  = tgt.shape(1);
+    const bool vertical = tgt.shape(2) == 3;
+
+    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
+        for (idx_t l = 0; l < levels; ++l) {
+            Complex uv{0., 0.};
+            double w{0.};
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                const idx_t n = index[c];
+                uv += complex_weights_[c] * Complex{double(src(n, l, 0)), double(src(n, l, 1))};
+                if (vertical) {
+                    w += value[c] * double(src(n, l, 2));
+                }
+            }
+            tgt(r, l, 0) = static_cast<Value>(uv.real());
+            tgt(r, l, 1) = static_cast<Value>(uv.imag());
+            if (vertical) {
+                tgt(r, l, 2) = static_cast<Value>(w);
+            }
+        }
+    }
+}
+
+template <typename Value>
+void SphericalVector::adjoint_interpolate_vector_field(Field& source, const Field& target) const {
+    const auto& W    = matrix();
+    const auto outer = W.outer();
+    const auto index = W.inner();
+    const auto value = W.data();
+    const idx_t rows = static_cast<idx_t>(W.rows());
+
+    auto src       = make_vector_view<Value>(source);
+    const auto tgt = make_vector_view<const Value>(target);
+    ATLAS_ASSERT(src.shape(1) == tgt.shape(1) && src.shape(2) == tgt.shape(2));
+    const idx_t levels  = tgt.shape(1);
+    const bool vertical = tgt.shape(2) == 3;
+
+    // Transpose of the complex weights is their conjugate; rows scatter into shared source points,
+    // so levels are distributed over threads instead
+    atlas_omp_parallel_for(idx_t l = 0; l < levels; ++l) {
+        for (idx_t r = 0; r < rows; ++r) {
+            const Complex uv{double(tgt(r, l, 0)), double(tgt(r, l, 1))};
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                const idx_t n   = index[c];
+                const Complex a = std::conj(complex_weights_[c]) * uv;
+                src(n, l, 0) += static_cast<Value>(a.real());
+                src(n, l, 1) += static_cast<Value>(a.imag());
+                if (vertical) {
+                    src(n, l, 2) += static_cast<Value>(value[c] * double(tgt(r, l, 2)));
+                }
+            }
+        }
+    }
+}
+
+}  // namespace method
+}  // namespace interpolation
+}  // namespace atlas
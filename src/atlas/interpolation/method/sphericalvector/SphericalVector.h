@@ -0,0 +1,79 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <complex>
+#include <vector>
+
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/interpolation/Interpolation.h"
+#include "atlas/interpolation/method/Method.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+namespace interpolation {
+namespace method {
+
+/**
+ * @brief Interpolation of tangent vector fields on the sphere
+ *
+ * Wraps a matrix-based interpolation method, given by the "scheme" configuration.
+ * Every weight of the scheme is combined once at setup with the rotation that parallel
+ * transports the local (east, north) frame of the source point along the great circle to
+ * the target point, into a complex weight. The horizontal components (u, v) = u + i v of a
+ * field with metadata "type" = "vector" are then interpolated in a single sweep, without
+ * conversion to three Cartesian components, and remain correct close to the poles.
+ * A third (vertical) component is interpolated with the weights of the scheme.
+ * Fields that are not of "vector" type are interpolated by the scheme as scalars.
+ */
+class SphericalVector : public Method {
+public:
+    SphericalVector(const Config& config);
+    virtual ~SphericalVector() override {}
+
+    virtual void print(std::ostream&) const override;
+
+    virtual const FunctionSpace& source() const override { return source_; }
+    virtual const FunctionSpace& target() const override { return target_; }
+
+private:
+    using Method::do_setup;
+    virtual void do_setup(const FunctionSpace& source, const FunctionSpace& target) override;
+    virtual void do_setup(const Grid& source, const Grid& target, const Cache&) override;
+
+    using Method::do_execute;
+    virtual void do_execute(const FieldSet& source, FieldSet& target, Metadata&) const override;
+    virtual void do_execute(const Field& source, Field& target, Metadata&) const override;
+
+    using Method::do_execute_adjoint;
+    virtual void do_execute_adjoint(FieldSet& source, const FieldSet& target, Metadata&) const override;
+    virtual void do_execute_adjoint(Field& source, const Field& target, Metadata&) const override;
+
+    void setup_complex_weights();
+
+    template <typename Value>
+    void interpolate_vector_field(const Field& source, Field& target) const;
+
+    template <typename Value>
+    void adjoint_interpolate_vector_field(Field& source, const Field& target) const;
+
+    util::Config scheme_;
+    Interpolation interpolation_;
+    FunctionSpace source_;
+    FunctionSpace target_;
+
+    // One complex weight per non-zero of the scheme matrix, in the same order
+    std::vector<std::complex<double>> complex_weights_;
+};
+
+}  // namespace method
+}  // namespace interpolation
+}  // namespace atlas
@@ -8,9 +8,13 @@
  * nor does it submit to any jurisdiction. and Interpolation
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <sstream>
+#include <vector>
 
 #include "FiniteElement.h"
 
@@ -18,6 +22,8 @@
 #include "eckit/log/ProgressTimer.h"
 #include "eckit/log/Seconds.h"
 
+#include "atlas/array.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/grid.h"
@@ -28,11 +34,13 @@
 #include "atlas/mesh/ElementType.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildCellCentres.h"
+#include "atlas/mesh/actions/BuildNode2CellConnectivity.h"
 #include "atlas/mesh/actions/BuildXYZField.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -52,6 +60,36 @@ MethodBuilder<FiniteElement> __builder("finite-element");
 // epsilon used to scale edge tolerance when projecting ray to intesect element
 static const double parametricEpsilon = 1e-15;
 
+// maximum number of elements visited when walking from the previous element of a moving point
+static const idx_t maxWalkSteps = 16;
+
+Field create_xyz(Field lonlat_field) {
+    auto xyz_field = Field("xyz", array::make_datatype<double>(), array::make_shape(lonlat_field.shape(0), 3));
+    auto lonlat    = array::make_view<double, 2>(lonlat_field);
+    auto xyz       = array::make_view<double, 2>(xyz_field);
+    PointXYZ p2;
+    for (idx_t n = 0; n < lonlat.shape(0); ++n) {
+        const PointLonLat p1(lonlat(n, 0), lonlat(n, 1));
+        util::Earth::convertSphericalToCartesian(p1, p2);
+        xyz(n, 0) = p2.x();
+        xyz(n, 1) = p2.y();
+        xyz(n, 2) = p2.z();
+    }
+    return xyz_field;
+}
+
+template <typename Value>
+array::LocalView<Value, 3> make_leveled_view(const Field& field) {
+    using namespace array;
+    if (field.rank() == 3) {
+        return make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all());
+    }
+    if (field.rank() == 2) {
+        return make_view<Value, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+    }
+    return make_view<Value, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
+}
+
 }  // namespace
 
 
@@ -89,37 +127,43 @@ void FiniteElement::do_setup(const FunctionSpace& source, const FunctionSpace& t
     target_ = target;
 
     ATLAS_TRACE_SCOPE("Setup target") {
-
-
-        auto create_xyz = [](Field lonlat_field) {
-            auto xyz_field = Field("xyz", array::make_datatype<double>(), array::make_shape(lonlat_field.shape(0), 3));
-            auto lonlat    = array::make_view<double, 2>(lonlat_field);
-            auto xyz       = array::make_view<double, 2>(xyz_field);
-            PointXYZ p2;
-            for (idx_t n = 0; n < lonlat.shape(0); ++n) {
-                const PointLonLat p1(lonlat(n, 0), lonlat(n, 1));
-                util::Earth::convertSphericalToCartesian(p1, p2);
-                xyz(n, 0) = p2.x();
-                xyz(n, 1) = p2.y();
-                xyz(n, 2) = p2.z();
-            }
-            return xyz_field;
-        };
-
         target_ghost_  = target.ghost();
         target_lonlat_ = target.lonlat();
-        if (functionspace::NodeColumns tgt = target) {
-            auto meshTarget = tgt.mesh();
-            target_xyz_    = mesh::actions::BuildXYZField("xyz")(meshTarget);
-        }
-        else {
-            target_xyz_    = create_xyz(target_lonlat_);
+        // when matrix-free, coordinates are computed from target_lonlat_ at every execute
+        if (not matrix_free_) {
+            if (functionspace::NodeColumns tgt = target) {
+                auto meshTarget = tgt.mesh();
+                target_xyz_     = mesh::actions::BuildXYZField("xyz")(meshTarget);
+            }
+            else {
+                target_xyz_ = create_xyz(target_lonlat_);
+            }
         }
     }
 
     setup(source);
 }
 
+void FiniteElement::do_setup(const FunctionSpace& source, const Field& target) {
+    ATLAS_TRACE("atlas::interpolation::method::FiniteElement::do_setup(FunctionSpace, Field)");
+
+    source_        = source;
+    target_lonlat_ = target;
+    if (target.functionspace()) {
+        target_       = target.functionspace();
+        target_ghost_ = target_.ghost();
+    }
+    else {
+        target_ghost_ = Field("ghost", array::make_datatype<int>(), array::make_shape(target.shape(0)));
+        array::make_view<int, 1>(target_ghost_).assign(0);
+    }
+    if (not matrix_free_) {
+        target_xyz_ = create_xyz(target_lonlat_);
+    }
+
+    setup(source);
+}
+
 struct Stencil {
     enum
     {
@@ -133,7 +177,8 @@ void FiniteElement::print(std::ostream& out) const {
     out << "atlas::interpolation::method::FiniteElement{" << std::endl;
     out << "max_fraction_elems_to_try: " << max_fraction_elems_to_try_;
     out << ", treat_failure_as_missing_value: " << treat_failure_as_missing_value_;
-    if (not tgt) {
+    out << ", matrix_free: " << matrix_free_;
+    if (not tgt || matrix_free_) {
         out << "}" << std::endl;
         return;
     }
@@ -218,11 +263,25 @@ void FiniteElement::setup(const FunctionSpace& source) {
 
 
     icoords_.reset(new array::ArrayView<double, 2>(array::make_view<double, 2>(source_xyz)));
-    ocoords_.reset(new array::ArrayView<double, 2>(array::make_view<double, 2>(target_xyz_)));
     igidx_.reset(new array::ArrayView<gidx_t, 1>(array::make_view<gidx_t, 1>(src.nodes().global_index())));
     connectivity_              = &meshSource.cells().node_connectivity();
     const mesh::Nodes& i_nodes = meshSource.nodes();
 
+    if (matrix_free_) {
+        // keep the element search structures, to locate target points at every execute
+        ATLAS_TRACE_SCOPE("Setup matrix-free") {
+            eTree_        = std::move(eTree);
+            cell_centres_ = cell_centres;
+            ccoords_.reset(new array::ArrayView<double, 2>(array::make_view<double, 2>(cell_centres_)));
+            mesh::actions::build_node_to_cell_connectivity(meshSource);
+            node_cell_connectivity_ = &meshSource.nodes().cell_connectivity();
+            element_hints_.assign(target_lonlat_.shape(0), -1);
+        }
+        return;
+    }
+
+    ocoords_.reset(new array::ArrayView<double, 2>(array::make_view<double, 2>(target_xyz_)));
+
 
     idx_t inp_npts = i_nodes.size();
     idx_t out_npts = ocoords_->shape(0);
@@ -329,226 +388,444 @@ Method::Triplets FiniteElement::projectPointToElements(size_t ip, const ElemInde
                                                        std::ostream& /* failures_log */) const {
     ATLAS_ASSERT(elems.begin() != elems.end());
 
+    const PointXYZ p{(*ocoords_)(ip, size_t(0)), (*ocoords_)(ip, size_t(1)), (*ocoords_)(ip, size_t(2))};
+    for (ElemIndex3::NodeList::const_iterator itc = elems.begin(); itc != elems.end(); ++itc) {
+        const idx_t elem_id = idx_t((*itc).value().payload());
+        Triplets triplets   = projectPointToElement(ip, p, elem_id);
+        if (!triplets.empty()) {
+            return triplets;  // stop looking for elements
+        }
+    }
+    return Triplets();
+}
+
+Method::Triplets FiniteElement::projectPointToElement(size_t ip, const PointXYZ& point, idx_t elem_id) const {
     const size_t inp_points = icoords_->shape(0);
     std::array<size_t, 4> idx;
     std::array<double, 4> w;
 
     Triplets triplets;
     triplets.reserve(4);
-    Ray ray(PointXYZ{(*ocoords_)(ip, size_t(0)), (*ocoords_)(ip, size_t(1)), (*ocoords_)(ip, size_t(2))});
-    const Vector3D p{(*ocoords_)(ip, size_t(0)), (*ocoords_)(ip, size_t(1)), (*ocoords_)(ip, size_t(2))};
+    Ray ray(point);
+    const Vector3D p{point.x(), point.y(), point.z()};
     ElementEdge edge;
     idx_t single_point;
-    for (ElemIndex3::NodeList::const_iterator itc = elems.begin(); itc != elems.end(); ++itc) {
-        const idx_t elem_id = idx_t((*itc).value().payload());
-        ATLAS_ASSERT(elem_id < connectivity_->rows());
-
-        const idx_t nb_cols = [&]() {
-            int nb_cols = connectivity_->cols(elem_id);
-            if (nb_cols == 5) {
-                // Check if pentagon degenerates to quad. Otherwise abort.
-                // For now only check if first and last point coincide.
-                auto i1    = (*connectivity_)(elem_id, 0);
-                auto iN    = (*connectivity_)(elem_id, nb_cols - 1);
-                auto first = PointXYZ{(*icoords_)(i1, XX), (*icoords_)(i1, YY), (*icoords_)(i1, ZZ)};
-                auto last  = PointXYZ{(*icoords_)(iN, XX), (*icoords_)(iN, YY), (*icoords_)(iN, ZZ)};
-                if (first == last) {
-                    return 4;
-                }
+    ATLAS_ASSERT(elem_id < connectivity_->rows());
+
+    const idx_t nb_cols = [&]() {
+        int nb_cols = connectivity_->cols(elem_id);
+        if (nb_cols == 5) {
+            // Check if pentagon degenerates to quad. Otherwise abort.
+            // For now only check if first and last point coincide.
+            auto i1    = (*connectivity_)(elem_id, 0);
+            auto iN    = (*connectivity_)(elem_id, nb_cols - 1);
+            auto first = PointXYZ{(*icoords_)(i1, XX), (*icoords_)(i1, YY), (*icoords_)(i1, ZZ)};
+            auto last  = PointXYZ{(*icoords_)(iN, XX), (*icoords_)(iN, YY), (*icoords_)(iN, ZZ)};
+            if (first == last) {
+                return 4;
             }
-            return nb_cols;
-        }();
+        }
+        return nb_cols;
+    }();
+
+    ATLAS_ASSERT(nb_cols == 3 || nb_cols == 4);
+
+    for (idx_t i = 0; i < nb_cols; ++i) {
+        idx[i] = (*connectivity_)(elem_id, i);
+        ATLAS_ASSERT(idx[i] < inp_points);
+    }
 
-        ATLAS_ASSERT(nb_cols == 3 || nb_cols == 4);
+    constexpr double tolerance = 1.e-12;
 
-        for (idx_t i = 0; i < nb_cols; ++i) {
-            idx[i] = (*connectivity_)(elem_id, i);
-            ATLAS_ASSERT(idx[i] < inp_points);
+    auto on_triag_edge = [&]() {
+        if (w[0] < tolerance) {
+            edge.idx[0] = 1;
+            edge.idx[1] = 2;
+            w[0]        = 0.;
+            return true;
+        }
+        if (w[1] < tolerance) {
+            edge.idx[0] = 0;
+            edge.idx[1] = 2;
+            w[1]        = 0.;
+            return true;
+        }
+        if (w[2] < tolerance) {
+            edge.idx[0] = 0;
+            edge.idx[1] = 1;
+            w[2]        = 0.;
+            return true;
         }
+        return false;
+    };
 
-        constexpr double tolerance = 1.e-12;
+    auto on_quad_edge = [&]() {
+        if (w[0] < tolerance && w[1] < tolerance) {
+            edge.idx[0] = 2;
+            edge.idx[1] = 3;
+            w[0]        = 0.;
+            w[1]        = 0.;
+            return true;
+        }
+        if (w[1] < tolerance && w[2] < tolerance) {
+            edge.idx[0] = 0;
+            edge.idx[1] = 3;
+            w[1]        = 0.;
+            w[2]        = 0.;
+            return true;
+        }
+        if (w[2] < tolerance && w[3] < tolerance) {
+            edge.idx[0] = 0;
+            edge.idx[1] = 1;
+            w[2]        = 0.;
+            w[3]        = 0.;
+            return true;
+        }
+        if (w[3] < tolerance && w[0] < tolerance) {
+            edge.idx[0] = 1;
+            edge.idx[1] = 2;
+            w[3]        = 0.;
+            w[0]        = 0.;
+            return true;
+        }
+        return false;
+    };
 
-        auto on_triag_edge = [&]() {
-            if (w[0] < tolerance) {
-                edge.idx[0] = 1;
-                edge.idx[1] = 2;
-                w[0]        = 0.;
-                return true;
+    auto on_single_point = [&]() {
+        if (w[edge.idx[0]] < tolerance) {
+            single_point   = edge.idx[1];
+            w[edge.idx[0]] = 0.;
+            return true;
+        }
+        if (w[edge.idx[1]] < tolerance) {
+            single_point   = edge.idx[0];
+            w[edge.idx[1]] = 0.;
+            return true;
+        }
+        return false;
+    };
+
+    auto interpolate_edge = [&](const Vector3D& p0, const Vector3D& p1) {
+        /*
+         * Given points p0,p1 defining the edge, and point p, find projected point pt
+         * on edge to compute interpolation weights.
+         *                  p
+         *                  |`.
+         *                  |  `.v
+         *                  |    `.
+         *  p1--------------pt-----p0
+         *                  <--d----
+         */
+        Vector3D d     = (p1 - p0) / (p1 - p0).norm();
+        Vector3D v     = p - p0;
+        double t       = v.dot(d);
+        Vector3D pt    = p0 + d * t;
+        t              = (pt - p0).norm() / (p1 - p0).norm();
+        w[edge.idx[0]] = 1. - t;
+        w[edge.idx[1]] = t;
+    };
+
+    if (nb_cols == 3) {
+        /* triangle */
+        element::Triag3D triag(PointXYZ{(*icoords_)(idx[0], XX), (*icoords_)(idx[0], YY), (*icoords_)(idx[0], ZZ)},
+                               PointXYZ{(*icoords_)(idx[1], XX), (*icoords_)(idx[1], YY), (*icoords_)(idx[1], ZZ)},
+                               PointXYZ{(*icoords_)(idx[2], XX), (*icoords_)(idx[2], YY), (*icoords_)(idx[2], ZZ)});
+
+        // pick an epsilon based on a characteristic length (sqrt(area))
+        // (this scales linearly so it better compares with linear weights u,v,w)
+        const double edgeEpsilon = parametricEpsilon * std::sqrt(triag.area());
+        ATLAS_ASSERT(edgeEpsilon >= 0);
+
+        Intersect is = triag.intersects(ray, edgeEpsilon);
+
+        if (is) {
+            // weights are the linear Lagrange function evaluated at u,v (aka
+            // barycentric coordinates)
+            w[0] = 1. - is.u - is.v;
+            w[1] = is.u;
+            w[2] = is.v;
+
+            if (on_triag_edge()) {
+                if (on_single_point()) {
+                    triplets.emplace_back(ip, idx[single_point], w[single_point]);
+                }
+                else {
+                    if ((*igidx_)(idx[edge.idx[1]]) < (*igidx_)(idx[edge.idx[0]])) {
+                        edge.swap();
+                    }
+                    interpolate_edge(triag.p(edge.idx[0]), triag.p(edge.idx[1]));
+                    for (size_t i = 0; i < 2; ++i) {
+                        triplets.emplace_back(ip, idx[edge.idx[i]], w[edge.idx[i]]);
+                    }
+                }
             }
-            if (w[1] < tolerance) {
-                edge.idx[0] = 0;
-                edge.idx[1] = 2;
-                w[1]        = 0.;
-                return true;
+            else {
+                for (size_t i = 0; i < 3; ++i) {
+                    triplets.emplace_back(ip, idx[i], w[i]);
+                }
             }
-            if (w[2] < tolerance) {
-                edge.idx[0] = 0;
-                edge.idx[1] = 1;
-                w[2]        = 0.;
-                return true;
+
+        }
+    }
+    else {
+        /* quadrilateral */
+        element::Quad3D quad(PointXYZ{(*icoords_)(idx[0], XX), (*icoords_)(idx[0], YY), (*icoords_)(idx[0], ZZ)},
+                             PointXYZ{(*icoords_)(idx[1], XX), (*icoords_)(idx[1], YY), (*icoords_)(idx[1], ZZ)},
+                             PointXYZ{(*icoords_)(idx[2], XX), (*icoords_)(idx[2], YY), (*icoords_)(idx[2], ZZ)},
+                             PointXYZ{(*icoords_)(idx[3], XX), (*icoords_)(idx[3], YY), (*icoords_)(idx[3], ZZ)});
+
+        // pick an epsilon based on a characteristic length (sqrt(area))
+        // (this scales linearly so it better compares with linear weights u,v,w)
+        const double edgeEpsilon = parametricEpsilon * std::sqrt(quad.area());
+        ATLAS_ASSERT(edgeEpsilon >= 0);
+
+        Intersect is = quad.intersects(ray, edgeEpsilon);
+
+        if (is) {
+            // weights are the bilinear Lagrange function evaluated at u,v
+            w[0] = (1. - is.u) * (1. - is.v);
+            w[1] = is.u * (1. - is.v);
+            w[2] = is.u * is.v;
+            w[3] = (1. - is.u) * is.v;
+
+            if (on_quad_edge()) {
+                if (on_single_point()) {
+                    triplets.emplace_back(ip, idx[single_point], w[single_point]);
+                }
+                else {
+                    if ((*igidx_)(idx[edge.idx[1]]) < (*igidx_)(idx[edge.idx[0]])) {
+                        edge.swap();
+                    }
+                    interpolate_edge(quad.p(edge.idx[0]), quad.p(edge.idx[1]));
+                    for (size_t i = 0; i < 2; ++i) {
+                        triplets.emplace_back(ip, idx[edge.idx[i]], w[edge.idx[i]]);
+                    }
+                }
             }
-            return false;
-        };
-
-        auto on_quad_edge = [&]() {
-            if (w[0] < tolerance && w[1] < tolerance) {
-                edge.idx[0] = 2;
-                edge.idx[1] = 3;
-                w[0]        = 0.;
-                w[1]        = 0.;
-                return true;
+            else {
+                for (size_t i = 0; i < 4; ++i) {
+                    triplets.emplace_back(ip, idx[i], w[i]);
+                }
             }
-            if (w[1] < tolerance && w[2] < tolerance) {
-                edge.idx[0] = 0;
-                edge.idx[1] = 3;
-                w[1]        = 0.;
-                w[2]        = 0.;
-                return true;
+        }
+    }
+
+    if (!triplets.empty()) {
+        normalise(triplets);
+    }
+    return triplets;
+}
+
+Method::Triplets FiniteElement::locatePoint(size_t ip, const PointXYZ& p, idx_t& hint) const {
+    auto distance2 = [&](idx_t elem) {
+        const double dx = (*ccoords_)(elem, XX) - p.x();
+        const double dy = (*ccoords_)(elem, YY) - p.y();
+        const double dz = (*ccoords_)(elem, ZZ) - p.z();
+        return dx * dx + dy * dy + dz * dz;
+    };
+
+    // Walk from the hint element towards the neighbour (sharing a node) with centre closest to p
+    if (hint >= 0) {
+        const idx_t nb_elems = connectivity_->rows();
+        idx_t elem           = hint;
+        double elem_distance = distance2(elem);
+        for (idx_t step = 0; step < maxWalkSteps; ++step) {
+            Triplets triplets = projectPointToElement(ip, p, elem);
+            if (!triplets.empty()) {
+                hint = elem;
+                return triplets;
             }
-            if (w[2] < tolerance && w[3] < tolerance) {
-                edge.idx[0] = 0;
-                edge.idx[1] = 1;
-                w[2]        = 0.;
-                w[3]        = 0.;
-                return true;
+            idx_t next           = -1;
+            double next_distance = elem_distance;
+            for (idx_t i = 0; i < connectivity_->cols(elem); ++i) {
+                const idx_t node = (*connectivity_)(elem, i);
+                for (idx_t k = 0; k < node_cell_connectivity_->cols(node); ++k) {
+                    const idx_t neighbour = (*node_cell_connectivity_)(node, k);
+                    if (neighbour < 0 || neighbour >= nb_elems || neighbour == elem) {
+                        continue;
+                    }
+                    const double d = distance2(neighbour);
+                    if (d < next_distance) {
+                        next          = neighbour;
+                        next_distance = d;
+                    }
+                }
             }
-            if (w[3] < tolerance && w[0] < tolerance) {
-                edge.idx[0] = 1;
-                edge.idx[1] = 2;
-                w[3]        = 0.;
-                w[0]        = 0.;
-                return true;
+            if (next < 0) {
+                break;  // no neighbour is closer, fall back to searching
             }
-            return false;
-        };
-
-        auto on_single_point = [&]() {
-            if (w[edge.idx[0]] < tolerance) {
-                single_point   = edge.idx[1];
-                w[edge.idx[0]] = 0.;
-                return true;
+            elem          = next;
+            elem_distance = next_distance;
+        }
+    }
+
+    // Search nearest k cell centres, as in setup
+    const idx_t maxNbElemsToTry = std::max<idx_t>(8, idx_t(connectivity_->rows() * max_fraction_elems_to_try_));
+    for (idx_t kpts = 1; kpts <= maxNbElemsToTry; kpts *= 2) {
+        ElemIndex3::NodeList cs = eTree_->kNearestNeighbours(p, kpts);
+        for (ElemIndex3::NodeList::const_iterator itc = cs.begin(); itc != cs.end(); ++itc) {
+            const idx_t elem_id = idx_t((*itc).value().payload());
+            Triplets triplets   = projectPointToElement(ip, p, elem_id);
+            if (!triplets.empty()) {
+                hint = elem_id;
+                return triplets;
             }
-            if (w[edge.idx[1]] < tolerance) {
-                single_point   = edge.idx[0];
-                w[edge.idx[1]] = 0.;
-                return true;
+        }
+    }
+    hint = -1;
+    return Triplets();
+}
+
+void FiniteElement::do_execute(const FieldSet& src_fields, FieldSet& tgt_fields, Metadata& metadata) const {
+    if (not matrix_free_) {
+        Method::do_execute(src_fields, tgt_fields, metadata);
+        return;
+    }
+
+    ATLAS_TRACE("atlas::interpolation::method::FiniteElement::do_execute()");
+
+    const idx_t N = src_fields.size();
+    ATLAS_ASSERT(N == tgt_fields.size());
+
+    if (N == 0) {
+        return;
+    }
+
+    haloExchange(src_fields);
+
+    array::DataType datatype = src_fields[0].datatype();
+    for (idx_t i = 0; i < N; ++i) {
+        ATLAS_ASSERT(src_fields[i].datatype() == datatype);
+        ATLAS_ASSERT(tgt_fields[i].datatype() == datatype);
+        ATLAS_ASSERT(src_fields[i].rank() == tgt_fields[i].rank());
+        ATLAS_ASSERT(src_fields[i].levels() == tgt_fields[i].levels());
+        ATLAS_ASSERT(src_fields[i].variables() == tgt_fields[i].variables());
+    }
+
+    if (datatype.kind() == array::DataType::KIND_REAL64) {
+        execute_matrix_free<double>(src_fields, tgt_fields);
+    }
+    else if (datatype.kind() == array::DataType::KIND_REAL32) {
+        execute_matrix_free<float>(src_fields, tgt_fields);
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
+
+    for (idx_t i = 0; i < N; ++i) {
+        tgt_fields[i].set_dirty();
+    }
+}
+
+void FiniteElement::do_execute(const Field& src, Field& tgt, Metadata& metadata) const {
+    if (not matrix_free_) {
+        Method::do_execute(src, tgt, metadata);
+        return;
+    }
+    FieldSet tgts;
+    tgts.add(tgt);
+    do_execute(FieldSet(src), tgts, metadata);
+}
+
+void FiniteElement::do_execute_adjoint(FieldSet& src_fields, const FieldSet& tgt_fields, Metadata& metadata) const {
+    if (matrix_free_) {
+        throw_NotImplemented("Adjoint interpolation is not available for matrix-free finite-element", Here());
+    }
+    Method::do_execute_adjoint(src_fields, tgt_fields, metadata);
+}
+
+void FiniteElement::do_execute_adjoint(Field& src, const Field& tgt, Metadata& metadata) const {
+    if (matrix_free_) {
+        throw_NotImplemented("Adjoint interpolation is not available for matrix-free finite-element", Here());
+    }
+    Method::do_execute_adjoint(src, tgt, metadata);
+}
+
+template <typename Value>
+void FiniteElement::execute_matrix_free(const FieldSet& src_fields, FieldSet& tgt_fields) const {
+    const idx_t N        = src_fields.size();
+    const idx_t out_npts = target_lonlat_.shape(0);
+
+    std::vector<array::LocalView<const Value, 3>> src;
+    std::vector<array::LocalView<Value, 3>> tgt;
+    src.reserve(N);
+    tgt.reserve(N);
+    for (idx_t i = 0; i < N; ++i) {
+        src.emplace_back(make_leveled_view<const Value>(src_fields[i]));
+        tgt.emplace_back(make_leveled_view<Value>(tgt_fields[i]));
+        ATLAS_ASSERT(tgt.back().shape(0) >= out_npts);
+    }
+
+    // target points may have changed size since the previous execute
+    if (static_cast<idx_t>(element_hints_.size()) != out_npts) {
+        element_hints_.assign(out_npts, -1);
+    }
+
+    const auto lonlat = array::make_view<double, 2>(target_lonlat_);
+    const auto ghost  = array::make_view<int, 1>(target_ghost_);
+
+    std::vector<char> failed(out_npts, 0);
+    std::atomic<bool> any_failed{false};
+
+    atlas_omp_parallel_for(idx_t ip = 0; ip < out_npts; ++ip) {
+        Triplets triplets;
+        if (not ghost(ip)) {
+            PointXYZ p;
+            util::Earth::convertSphericalToCartesian(PointLonLat{lonlat(ip, LON), lonlat(ip, LAT)}, p);
+            triplets = locatePoint(size_t(ip), p, element_hints_[ip]);
+            if (triplets.empty()) {
+                failed[ip] = 1;
+                any_failed = true;
             }
-            return false;
-        };
-
-        auto interpolate_edge = [&](const Vector3D& p0, const Vector3D& p1) {
-            /*
-             * Given points p0,p1 defining the edge, and point p, find projected point pt
-             * on edge to compute interpolation weights.
-             *                  p
-             *                  |`.
-             *                  |  `.v
-             *                  |    `.
-             *  p1--------------pt-----p0
-             *                  <--d----
-             */
-            Vector3D d     = (p1 - p0) / (p1 - p0).norm();
-            Vector3D v     = p - p0;
-            double t       = v.dot(d);
-            Vector3D pt    = p0 + d * t;
-            t              = (pt - p0).norm() / (p1 - p0).norm();
-            w[edge.idx[0]] = 1. - t;
-            w[edge.idx[1]] = t;
-        };
-
-        if (nb_cols == 3) {
-            /* triangle */
-            element::Triag3D triag(PointXYZ{(*icoords_)(idx[0], XX), (*icoords_)(idx[0], YY), (*icoords_)(idx[0], ZZ)},
-                                   PointXYZ{(*icoords_)(idx[1], XX), (*icoords_)(idx[1], YY), (*icoords_)(idx[1], ZZ)},
-                                   PointXYZ{(*icoords_)(idx[2], XX), (*icoords_)(idx[2], YY), (*icoords_)(idx[2], ZZ)});
-
-            // pick an epsilon based on a characteristic length (sqrt(area))
-            // (this scales linearly so it better compares with linear weights u,v,w)
-            const double edgeEpsilon = parametricEpsilon * std::sqrt(triag.area());
-            ATLAS_ASSERT(edgeEpsilon >= 0);
-
-            Intersect is = triag.intersects(ray, edgeEpsilon);
-
-            if (is) {
-                // weights are the linear Lagrange function evaluated at u,v (aka
-                // barycentric coordinates)
-                w[0] = 1. - is.u - is.v;
-                w[1] = is.u;
-                w[2] = is.v;
-
-                if (on_triag_edge()) {
-                    if (on_single_point()) {
-                        triplets.emplace_back(ip, idx[single_point], w[single_point]);
-                    }
-                    else {
-                        if ((*igidx_)(idx[edge.idx[1]]) < (*igidx_)(idx[edge.idx[0]])) {
-                            edge.swap();
-                        }
-                        interpolate_edge(triag.p(edge.idx[0]), triag.p(edge.idx[1]));
-                        for (size_t i = 0; i < 2; ++i) {
-                            triplets.emplace_back(ip, idx[edge.idx[i]], w[edge.idx[i]]);
-                        }
-                    }
-                }
-                else {
-                    for (size_t i = 0; i < 3; ++i) {
-                        triplets.emplace_back(ip, idx[i], w[i]);
+            // accumulate in column order, as the sparse matrix does, so that results match the matrix path
+            std::sort(triplets.begin(), triplets.end(),
+                      [](const Triplet& a, const Triplet& b) { return a.col() < b.col(); });
+        }
+        for (idx_t i = 0; i < N; ++i) {
+            const idx_t Nj = tgt[i].shape(1);
+            const idx_t Nk = tgt[i].shape(2);
+            for (idx_t j = 0; j < Nj; ++j) {
+                for (idx_t k = 0; k < Nk; ++k) {
+                    Value value{0};
+                    for (const auto& triplet : triplets) {
+                        value += static_cast<Value>(triplet.value()) * src[i](triplet.col(), j, k);
                     }
+                    tgt[i](ip, j, k) = value;
                 }
+            }
+        }
+    }
 
-                break;  // stop looking for elements
+    if (any_failed && not treat_failure_as_missing_value_) {
+        std::ostringstream msg;
+        msg << "Rank " << mpi::rank() << " failed to project points:\n";
+        for (idx_t ip = 0; ip < out_npts; ++ip) {
+            if (failed[ip]) {
+                msg << "\t(lon,lat) = " << PointLonLat{lonlat(ip, LON), lonlat(ip, LAT)} << "\n";
             }
         }
-        else {
-            /* quadrilateral */
-            element::Quad3D quad(PointXYZ{(*icoords_)(idx[0], XX), (*icoords_)(idx[0], YY), (*icoords_)(idx[0], ZZ)},
-                                 PointXYZ{(*icoords_)(idx[1], XX), (*icoords_)(idx[1], YY), (*icoords_)(idx[1], ZZ)},
-                                 PointXYZ{(*icoords_)(idx[2], XX), (*icoords_)(idx[2], YY), (*icoords_)(idx[2], ZZ)},
-                                 PointXYZ{(*icoords_)(idx[3], XX), (*icoords_)(idx[3], YY), (*icoords_)(idx[3], ZZ)});
-
-            // pick an epsilon based on a characteristic length (sqrt(area))
-            // (this scales linearly so it better compares with linear weights u,v,w)
-            const double edgeEpsilon = parametricEpsilon * std::sqrt(quad.area());
-            ATLAS_ASSERT(edgeEpsilon >= 0);
-
-            Intersect is = quad.intersects(ray, edgeEpsilon);
-
-            if (is) {
-                // weights are the bilinear Lagrange function evaluated at u,v
-                w[0] = (1. - is.u) * (1. - is.v);
-                w[1] = is.u * (1. - is.v);
-                w[2] = is.u * is.v;
-                w[3] = (1. - is.u) * is.v;
-
-                if (on_quad_edge()) {
-                    if (on_single_point()) {
-                        triplets.emplace_back(ip, idx[single_point], w[single_point]);
-                    }
-                    else {
-                        if ((*igidx_)(idx[edge.idx[1]]) < (*igidx_)(idx[edge.idx[0]])) {
-                            edge.swap();
-                        }
-                        interpolate_edge(quad.p(edge.idx[0]), quad.p(edge.idx[1]));
-                        for (size_t i = 0; i < 2; ++i) {
-                            triplets.emplace_back(ip, idx[edge.idx[i]], w[edge.idx[i]]);
-                        }
-                    }
-                }
-                else {
-                    for (size_t i = 0; i < 4; ++i) {
-                        triplets.emplace_back(ip, idx[i], w[i]);
+        Log::error() << msg.str() << std::endl;
+        throw_Exception(msg.str());
+    }
+
+    // same missing value handling as the matrix path, with the failures of this execute
+    for (idx_t i = 0; i < N; ++i) {
+        Field& field = tgt_fields[i];
+        set_missing_value_metadata(src_fields[i], field, any_failed);
+        if (not any_failed) {
+            continue;
+        }
+        const Value missing_value = field.metadata().get<Value>("missing_value");
+        for (idx_t ip = 0; ip < out_npts; ++ip) {
+            if (failed[ip]) {
+                for (idx_t j = 0; j < tgt[i].shape(1); ++j) {
+                    for (idx_t k = 0; k < tgt[i].shape(2); ++k) {
+                        tgt[i](ip, j, k) = missing_value;
                     }
                 }
-                break;  // stop looking for elements
             }
         }
-
-    }  // loop over nearest elements
-
-    if (!triplets.empty()) {
-        normalise(triplets);
     }
-    return triplets;
 }
 
 }  // namespace method
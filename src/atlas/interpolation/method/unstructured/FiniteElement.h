@@ -12,7 +12,9 @@
 
 #include "atlas/interpolation/method/Method.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 #include "eckit/memory/NonCopyable.h"
@@ -21,6 +23,9 @@
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/interpolation/method/PointIndex3.h"
 #include "atlas/mesh/Elements.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/util/Point.h"
 
 namespace atlas {
 namespace interpolation {
@@ -30,6 +35,10 @@ class FiniteElement : public Method {
 public:
     FiniteElement(const Config& config): Method(config) {
         config.get("max_fraction_elems_to_try", max_fraction_elems_to_try_);
+        config.get("matrix_free", matrix_free_);
+        if (matrix_free_ && config.has("non_linear")) {
+            throw_NotImplemented("Non-linear interpolation is not available for matrix-free finite-element", Here());
+        }
     }
 
     virtual ~FiniteElement() override {}
@@ -58,6 +67,19 @@ protected:
    */
     Triplets projectPointToElements(size_t ip, const ElemIndex3::NodeList& elems, std::ostream& failures_log) const;
 
+    /**
+   * Project point p, as row ip, to a single element, returning the (normalized)
+   * interpolation weights, or no weights if the element does not contain the point
+   */
+    Triplets projectPointToElement(size_t ip, const PointXYZ& p, idx_t elem_id) const;
+
+    /**
+   * Locate point p, as row ip, starting from element hint and walking through
+   * neighbouring elements, or searching the element kd-tree if that fails.
+   * On success, hint is updated to the containing element.
+   */
+    Triplets locatePoint(size_t ip, const PointXYZ& p, idx_t& hint) const;
+
     virtual const FunctionSpace& source() const override { return source_; }
     virtual const FunctionSpace& target() const override { return target_; }
 
@@ -67,6 +89,17 @@ private:
 
     virtual void do_setup(const Grid& source, const Grid& target, const Cache&) override;
 
+    virtual void do_setup(const FunctionSpace& source, const Field& target) override;
+
+    virtual void do_execute(const FieldSet& src, FieldSet& tgt, Metadata&) const override;
+    virtual void do_execute(const Field& src, Field& tgt, Metadata&) const override;
+
+    virtual void do_execute_adjoint(FieldSet& src, const FieldSet& tgt, Metadata&) const override;
+    virtual void do_execute_adjoint(Field& src, const Field& tgt, Metadata&) const override;
+
+    template <typename Value>
+    void execute_matrix_free(const FieldSet& src, FieldSet& tgt) const;
+
 protected:
     mesh::MultiBlockConnectivity* connectivity_;
     std::unique_ptr<array::ArrayView<double, 2>> icoords_;
@@ -82,6 +115,15 @@ protected:
 
     bool treat_failure_as_missing_value_{true};
     double max_fraction_elems_to_try_{0.2};
+
+    // Matrix-free: target points are located at every execute from their current lonlat,
+    // starting from the element found for the previous location
+    bool matrix_free_{false};
+    std::unique_ptr<ElemIndex3> eTree_;
+    Field cell_centres_;
+    std::unique_ptr<array::ArrayView<double, 2>> ccoords_;
+    const mesh::Nodes::Connectivity* node_cell_connectivity_{nullptr};
+    mutable std::vector<idx_t> element_hints_;
 };
 
 }  // namespace method
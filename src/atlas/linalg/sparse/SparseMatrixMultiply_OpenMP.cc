@@ -10,6 +10,9 @@
 
 #include "atlas/linalg/sparse/SparseMatrixMultiply_OpenMP.h"
 
+#include <type_traits>
+
+#include "atlas/array/ContiguousArrayView.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 
@@ -17,6 +20,31 @@ namespace atlas {
 namespace linalg {
 namespace sparse {
 
+namespace {
+template <typename SourceView, typename TargetView>
+void spmv_layout_left_rank2(const SparseMatrix& W, const SourceView& src, TargetView& tgt) {
+    using Value       = typename std::remove_const<typename TargetView::value_type>::type;
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t rows  = static_cast<idx_t>(W.rows());
+    const idx_t Nk    = src.shape(1);
+
+    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
+        for (idx_t k = 0; k < Nk; ++k) {
+            tgt(r, k) = 0.;
+        }
+        for (idx_t c = outer[r]; c < outer[r + 1]; ++c) {
+            idx_t n = index[c];
+            Value w = static_cast<Value>(weight[c]);
+            for (idx_t k = 0; k < Nk; ++k) {
+                tgt(r, k) += w * src(n, k);
+            }
+        }
+    }
+}
+}  // namespace
+
 template <typename SourceValue, typename TargetValue>
 void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, SourceValue, TargetValue>::apply(
     const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt, const Configuration&) {
@@ -43,28 +71,17 @@ void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, SourceValue
 template <typename SourceValue, typename TargetValue>
 void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(
     const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt, const Configuration&) {
-    using Value       = TargetValue;
-    const auto outer  = W.outer();
-    const auto index  = W.inner();
-    const auto weight = W.data();
-    const idx_t rows  = static_cast<idx_t>(W.rows());
-    const idx_t Nk    = src.shape(1);
-
     ATLAS_ASSERT(src.shape(0) >= W.cols());
     ATLAS_ASSERT(tgt.shape(0) >= W.rows());
 
-    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
-        for (idx_t k = 0; k < Nk; ++k) {
-            tgt(r, k) = 0.;
-        }
-        for (idx_t c = outer[r]; c < outer[r + 1]; ++c) {
-            idx_t n = index[c];
-            Value w = static_cast<Value>(weight[c]);
-            for (idx_t k = 0; k < Nk; ++k) {
-                tgt(r, k) += w * src(n, k);
-            }
-        }
+    if (src.contiguous() && tgt.contiguous() && src.stride(1) == 1 && tgt.stride(1) == 1) {
+        // Unit stride of the inner dimension is then known at compile time, so the level loops vectorise
+        const array::ContiguousArrayView<SourceValue, 2> src_v(src.data(), src.shape());
+        array::ContiguousArrayView<TargetValue, 2> tgt_v(tgt.data(), tgt.shape());
+        spmv_layout_left_rank2(W, src_v, tgt_v);
+        return;
     }
+    spmv_layout_left_rank2(W, src, tgt);
 }
 
 template <typename SourceValue, typename TargetValue>
@@ -91,6 +91,16 @@ IrregularConnectivityImpl::IrregularConnectivityImpl(eckit::Stream& s) {
 
 //------------------------------------------------------------------------------------------------------
 
+ConnectivitySpan<const idx_t> IrregularConnectivityImpl::span() const {
+    ATLAS_ASSERT(uniform(), "span() requires the same number of columns in every row");
+    return ConnectivitySpan<const idx_t>(values_.data(), rows_, rows_ ? maxcols_ : 0);
+}
+
+ConnectivitySpan<idx_t> IrregularConnectivityImpl::span() {
+    ATLAS_ASSERT(uniform(), "span() requires the same number of columns in every row");
+    return ConnectivitySpan<idx_t>(values_.data(), rows_, rows_ ? maxcols_ : 0);
+}
+
 IrregularConnectivityImpl::~IrregularConnectivityImpl() {
     on_delete();
     //TODO owns is unsed ?
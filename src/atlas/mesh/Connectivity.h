@@ -100,6 +100,13 @@ class MultiBlockConnectivityImpl;
 /// In the second mode of construction, resizing is possible
 
 namespace detail {
+/// Base of the indices as stored in connectivity tables
+#if ATLAS_HAVE_FORTRAN
+constexpr idx_t CONNECTIVITY_BASE = 1;
+#else
+constexpr idx_t CONNECTIVITY_BASE = 0;
+#endif
+
 // FortranIndex:
 // Helper class that does +1 and -1 operations on stored values
 
@@ -169,6 +176,53 @@ private:
     idx_t size_;
 };
 
+/// @brief Plain strided span over connectivity values with the same number of columns in every row
+///
+/// Access through this span involves no proxy object and no indirection through displacements and
+/// counts: entry (row,col) is stored at data()[row*stride()+col], and the storage base is the
+/// compile-time constant BASE. Loops over connectivity accessed this way can be vectorised.
+///
+/// operator() and set() use base 0, like the connectivity classes.
+/// data() and row() expose the raw storage with base BASE, as it is seen from Fortran.
+template <typename Index>
+class ConnectivitySpan {
+public:
+    static constexpr idx_t BASE = detail::CONNECTIVITY_BASE;
+
+    ATLAS_HOST_DEVICE
+    ConnectivitySpan(Index* data, idx_t rows, idx_t cols): data_(data), rows_(rows), cols_(cols) {}
+
+    /// @brief Access to the entry (row,col) with base 0
+    ATLAS_HOST_DEVICE
+    idx_t operator()(idx_t row, idx_t col) const { return data_[row * cols_ + col] - BASE; }
+
+    /// @brief Modify the entry (row,col). Value must be given with base 0
+    ATLAS_HOST_DEVICE
+    void set(idx_t row, idx_t col, idx_t value) const { data_[row * cols_ + col] = value + BASE; }
+
+    /// @brief Raw storage of given row, with base BASE
+    ATLAS_HOST_DEVICE
+    Index* row(idx_t row) const { return data_ + row * cols_; }
+
+    /// @brief Raw storage, with base BASE
+    ATLAS_HOST_DEVICE
+    Index* data() const { return data_; }
+
+    ATLAS_HOST_DEVICE
+    idx_t rows() const { return rows_; }
+
+    ATLAS_HOST_DEVICE
+    idx_t cols() const { return cols_; }
+
+    ATLAS_HOST_DEVICE
+    idx_t stride() const { return cols_; }
+
+private:
+    Index* data_;
+    idx_t rows_;
+    idx_t cols_;
+};
+
 class IrregularConnectivityImpl {
 public:
     typedef ConnectivityRow Row;
@@ -245,6 +299,14 @@ public:
     ATLAS_HOST_DEVICE
     Row row(idx_t row_idx) const;
 
+    /// @brief True if every row has the same number of columns, in which case span() can be used
+    bool uniform() const { return rows_ == 0 || mincols_ == maxcols_; }
+
+    /// @brief Plain strided span over all rows, for fast access in compute kernels
+    /// @note Only valid if uniform()
+    ConnectivitySpan<const idx_t> span() const;
+    ConnectivitySpan<idx_t> span();
+
     // -- Modifiers
 
     /// @brief Modify row with given values. Values must be given with base 0
@@ -582,6 +644,12 @@ public:
     ATLAS_HOST_DEVICE
     idx_t missing_value() const { return missing_value_; }
 
+    /// @brief Plain strided span over this block, for fast access in compute kernels
+    ATLAS_HOST_DEVICE
+    ConnectivitySpan<const idx_t> span() const { return ConnectivitySpan<const idx_t>(values_.data(), rows_, cols_); }
+    ATLAS_HOST_DEVICE
+    ConnectivitySpan<idx_t> span() { return ConnectivitySpan<idx_t>(values_.data(), rows_, cols_); }
+
     size_t footprint() const;
 
     //-- Modifiers
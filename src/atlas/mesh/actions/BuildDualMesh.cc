@@ -12,6 +12,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 
@@ -27,6 +28,7 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildDualMesh.h"
 #include "atlas/parallel/Checksum.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -76,6 +78,45 @@ struct Node {
     bool operator<(const Node& other) const { return (g < other.g); }
 };
 
+// Boundary edges (edges with only one cell) connected to each node, in increasing edge order.
+// Flat CSR storage: boundary edges of node n are edges_[offset_[n]:offset_[n+1]]
+class NodeToBoundaryEdges {
+public:
+    NodeToBoundaryEdges(const mesh::HybridElements& edges, idx_t nb_nodes): offset_(nb_nodes + 1, 0) {
+        const mesh::HybridElements::Connectivity& edge_node_connectivity = edges.node_connectivity();
+        const mesh::HybridElements::Connectivity& edge_cell_connectivity = edges.cell_connectivity();
+        const idx_t nb_edges                                             = edges.size();
+        const idx_t missing_value = edge_cell_connectivity.missing_value();
+
+        std::vector<char> bdry(nb_edges);
+        atlas_omp_parallel_for(idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+            bdry[jedge] = edge_cell_connectivity(jedge, 0) != missing_value &&
+                          edge_cell_connectivity(jedge, 1) == missing_value;
+        }
+        for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+            if (bdry[jedge]) {
+                ++offset_[edge_node_connectivity(jedge, 0) + 1];
+                ++offset_[edge_node_connectivity(jedge, 1) + 1];
+            }
+        }
+        std::partial_sum(offset_.begin(), offset_.end(), offset_.begin());
+        edges_.resize(offset_[nb_nodes]);
+        std::vector<idx_t> fill(offset_.begin(), offset_.end() - 1);
+        for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+            if (bdry[jedge]) {
+                edges_[fill[edge_node_connectivity(jedge, 0)]++] = jedge;
+                edges_[fill[edge_node_connectivity(jedge, 1)]++] = jedge;
+            }
+        }
+    }
+    idx_t size(idx_t node) const { return offset_[node + 1] - offset_[node]; }
+    idx_t operator()(idx_t node, idx_t j) const { return edges_[offset_[node] + j]; }
+
+private:
+    std::vector<idx_t> offset_;
+    std::vector<idx_t> edges_;
+};
+
 }  // namespace
 
 array::Array* build_centroids_xy(const mesh::HybridElements&, const Field& xy);
@@ -144,7 +185,7 @@ array::Array* build_centroids_xy(const mesh::HybridElements& elements, const Fie
     array::ArrayView<double, 2> centroids = array::make_view<double, 2>(*array_centroids);
     idx_t nb_elems                        = elements.size();
     const mesh::HybridElements::Connectivity& elem_nodes = elements.node_connectivity();
-    for (idx_t e = 0; e < nb_elems; ++e) {
+    atlas_omp_parallel_for(idx_t e = 0; e < nb_elems; ++e) {
         centroids(e, XX)                 = 0.;
         centroids(e, YY)                 = 0.;
         const idx_t nb_nodes_per_elem    = elem_nodes.cols(e);
@@ -180,12 +221,23 @@ void add_median_dual_volume_contribution_cells(const mesh::HybridElements& cells
     // special ordering for bit-identical results
     idx_t nb_cells = cells.size();
     std::vector<Node> ordering(nb_cells);
-    for (idx_t jcell = 0; jcell < nb_cells; ++jcell) {
+    atlas_omp_parallel_for(idx_t jcell = 0; jcell < nb_cells; ++jcell) {
         ordering[jcell] = Node(util::unique_lonlat(cell_centroids(jcell, XX), cell_centroids(jcell, YY)), jcell);
     }
     std::sort(ordering.data(), ordering.data() + nb_cells);
 
+    // Contributions (cell, edge of cell, node of edge) are numbered in the above ordering, so that each node
+    // can sum its own contributions independently, in the same order as a serial loop over the ordering
+    std::vector<idx_t> cell_offset(nb_cells + 1, 0);
     for (idx_t jcell = 0; jcell < nb_cells; ++jcell) {
+        idx_t icell            = ordering[jcell].i;
+        cell_offset[jcell + 1] = cell_offset[jcell] + (patch(icell) ? 0 : 2 * cell_edge_connectivity.cols(icell));
+    }
+    const idx_t nb_contributions = cell_offset[nb_cells];
+    std::vector<double> contribution_area(nb_contributions);
+    std::vector<idx_t> contribution_node(nb_contributions);
+
+    atlas_omp_parallel_for(idx_t jcell = 0; jcell < nb_cells; ++jcell) {
         idx_t icell = ordering[jcell].i;
         if (patch(icell)) {
             continue;
@@ -193,19 +245,41 @@ void add_median_dual_volume_contribution_cells(const mesh::HybridElements& cells
         double x0 = cell_centroids(icell, XX);
         double y0 = cell_centroids(icell, YY);
 
+        idx_t c = cell_offset[jcell];
         for (idx_t jedge = 0; jedge < cell_edge_connectivity.cols(icell); ++jedge) {
             idx_t iedge = cell_edge_connectivity(icell, jedge);
             double x1   = edge_centroids(iedge, XX);
             double y1   = edge_centroids(iedge, YY);
-            for (idx_t jnode = 0; jnode < 2; ++jnode) {
-                idx_t inode       = edge_node_connectivity(iedge, jnode);
-                double x2         = xy(inode, XX);
-                double y2         = xy(inode, YY);
-                double triag_area = std::abs(x0 * (y1 - y2) + x1 * (y2 - y0) + x2 * (y0 - y1)) * 0.5;
-                dual_volumes(inode) += triag_area;
+            for (idx_t jnode = 0; jnode < 2; ++jnode, ++c) {
+                idx_t inode          = edge_node_connectivity(iedge, jnode);
+                double x2            = xy(inode, XX);
+                double y2            = xy(inode, YY);
+                contribution_node[c] = inode;
+                contribution_area[c] = std::abs(x0 * (y1 - y2) + x1 * (y2 - y0) + x2 * (y0 - y1)) * 0.5;
             }
         }
     }
+
+    // Flat CSR of contributions per node, in contribution order
+    const idx_t nb_nodes = nodes.size();
+    std::vector<idx_t> node_offset(nb_nodes + 1, 0);
+    for (idx_t c = 0; c < nb_contributions; ++c) {
+        ++node_offset[contribution_node[c] + 1];
+    }
+    std::partial_sum(node_offset.begin(), node_offset.end(), node_offset.begin());
+    std::vector<idx_t> node_contributions(nb_contributions);
+    {
+        std::vector<idx_t> fill(node_offset.begin(), node_offset.end() - 1);
+        for (idx_t c = 0; c < nb_contributions; ++c) {
+            node_contributions[fill[contribution_node[c]]++] = c;
+        }
+    }
+
+    atlas_omp_parallel_for(idx_t inode = 0; inode < nb_nodes; ++inode) {
+        for (idx_t j = node_offset[inode]; j < node_offset[inode + 1]; ++j) {
+            dual_volumes(inode) += contribution_area[node_contributions[j]];
+        }
+    }
 }
 
 void add_median_dual_volume_contribution_poles(const mesh::HybridElements& edges, const mesh::Nodes& nodes,
@@ -215,32 +289,20 @@ void add_median_dual_volume_contribution_poles(const mesh::HybridElements& edges
     array::ArrayView<double, 1> dual_volumes = array::make_view<double, 1>(array_dual_volumes);
     auto xy                                  = array::make_view<double, 2>(nodes.xy());
     auto edge_centroids                      = array::make_view<double, 2>(edges.field("centroids_xy"));
-    const mesh::HybridElements::Connectivity& edge_node_connectivity = edges.node_connectivity();
-    const mesh::HybridElements::Connectivity& edge_cell_connectivity = edges.cell_connectivity();
-
-    const idx_t nb_edges = edges.size();
-    std::map<idx_t, std::vector<idx_t>> node_to_bdry_edge;
-    for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-        if (edge_cell_connectivity(jedge, 0) != edge_cell_connectivity.missing_value() &&
-            edge_cell_connectivity(jedge, 1) == edge_cell_connectivity.missing_value()) {
-            node_to_bdry_edge[edge_node_connectivity(jedge, 0)].push_back(jedge);
-            node_to_bdry_edge[edge_node_connectivity(jedge, 1)].push_back(jedge);
-        }
-    }
+    const idx_t nb_nodes = nodes.size();
+    const NodeToBoundaryEdges node_to_bdry_edge(edges, nb_nodes);
 
     const double tol = 1.e-6;
     double min[2], max[2];
     global_bounding_box(nodes, min, max);
 
-    std::map<idx_t, std::vector<idx_t>>::iterator it;
-    for (it = node_to_bdry_edge.begin(); it != node_to_bdry_edge.end(); ++it) {
-        const idx_t jnode              = (*it).first;
-        std::vector<idx_t>& bdry_edges = (*it).second;
-        const double x0                = xy(jnode, XX);
-        const double y0                = xy(jnode, YY);
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nb_nodes; ++jnode) {
+        const idx_t nb_bdry_edges = node_to_bdry_edge.size(jnode);
+        const double x0           = xy(jnode, XX);
+        const double y0           = xy(jnode, YY);
         double x1, y1, y2;
-        for (idx_t jedge = 0; jedge < static_cast<idx_t>(bdry_edges.size()); ++jedge) {
-            const idx_t iedge = bdry_edges[jedge];
+        for (idx_t jedge = 0; jedge < nb_bdry_edges; ++jedge) {
+            const idx_t iedge = node_to_bdry_edge(jnode, jedge);
             x1                = edge_centroids(iedge, XX);
             y1                = edge_centroids(iedge, YY);
 
@@ -274,7 +336,6 @@ void build_dual_normals(Mesh& mesh) {
     global_bounding_box(nodes, min, max);
     double tol = 1.e-6;
 
-    double xl, yl, xr, yr;
     array::ArrayView<double, 2> edge_centroids = array::make_view<double, 2>(edges.field("centroids_xy"));
     array::ArrayView<double, 2> dual_normals   = array::make_view<double, 2>(
         edges.add(Field("dual_normals", array::make_datatype<double>(), array::make_shape(nb_edges, 2))));
@@ -282,27 +343,20 @@ void build_dual_normals(Mesh& mesh) {
     const mesh::HybridElements::Connectivity& edge_node_connectivity = edges.node_connectivity();
     const mesh::HybridElements::Connectivity& edge_cell_connectivity = edges.cell_connectivity();
 
-    std::map<idx_t, std::vector<idx_t>> node_to_bdry_edge;
-    for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-        if (edge_cell_connectivity(jedge, 0) != edge_cell_connectivity.missing_value() &&
-            edge_cell_connectivity(jedge, 1) == edge_cell_connectivity.missing_value()) {
-            node_to_bdry_edge[edge_node_connectivity(jedge, 0)].push_back(jedge);
-            node_to_bdry_edge[edge_node_connectivity(jedge, 1)].push_back(jedge);
-        }
-    }
+    const NodeToBoundaryEdges node_to_bdry_edge(edges, nodes.size());
 
-    for (idx_t edge = 0; edge < nb_edges; ++edge) {
+    // Pole edges only modify their own centroid, and only read centroids of boundary edges
+    atlas_omp_parallel_for(idx_t edge = 0; edge < nb_edges; ++edge) {
         if (edge_cell_connectivity(edge, 0) == edge_cell_connectivity.missing_value()) {
             // this is a pole edge
             // only compute for one node
             for (idx_t n = 0; n < 2; ++n) {
-                idx_t node                     = edge_node_connectivity(edge, n);
-                std::vector<idx_t>& bdry_edges = node_to_bdry_edge[node];
+                idx_t node = edge_node_connectivity(edge, n);
                 double x[2];
                 idx_t cnt                 = 0;
-                const idx_t nb_bdry_edges = static_cast<idx_t>(bdry_edges.size());
+                const idx_t nb_bdry_edges = node_to_bdry_edge.size(node);
                 for (idx_t jedge = 0; jedge < nb_bdry_edges; ++jedge) {
-                    idx_t bdry_edge = bdry_edges[jedge];
+                    idx_t bdry_edge = node_to_bdry_edge(node, jedge);
                     if (std::abs(edge_centroids(bdry_edge, YY) - max[YY]) < tol) {
                         edge_centroids(edge, YY) = 90.;
                         x[cnt]                   = edge_centroids(bdry_edge, XX);
@@ -330,6 +384,7 @@ void build_dual_normals(Mesh& mesh) {
             }
         }
         else {
+            double xl, yl, xr, yr;
             idx_t left_elem  = edge_cell_connectivity(edge, 0);
             idx_t right_elem = edge_cell_connectivity(edge, 1);
             xl               = elem_centroids(left_elem, XX);
@@ -367,7 +422,7 @@ void make_dual_normals_outward(Mesh& mesh) {
     array::ArrayView<double, 2> dual_normals = array::make_view<double, 2>(edges.field("dual_normals"));
     const idx_t nb_edges                     = edges.size();
 
-    for (idx_t edge = 0; edge < nb_edges; ++edge) {
+    atlas_omp_parallel_for(idx_t edge = 0; edge < nb_edges; ++edge) {
         if (edge_cell_connectivity(edge, 0) != edge_cell_connectivity.missing_value()) {
             // Make normal point from node 1 to node 2
             const idx_t ip1 = edge_node_connectivity(edge, 0);
@@ -34,6 +34,7 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -53,16 +54,43 @@ namespace actions {
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace {  // anonymous
-struct Sort {
-    Sort() = default;
-    Sort(gidx_t gid, idx_t idx) {
-        g = gid;
-        i = idx;
+
+// Unique ids of all edges, used to order connectivity rows for bit-reproducibility
+std::vector<gidx_t> compute_edge_uids(const Mesh& mesh) {
+    const mesh::HybridElements::Connectivity& edge_node_connectivity = mesh.edges().node_connectivity();
+    const idx_t nb_edges                                             = mesh.edges().size();
+    std::vector<gidx_t> edge_uid(nb_edges);
+    UniqueLonLat compute_uid(mesh);
+    atlas_omp_parallel_for(idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+        edge_uid[jedge] = compute_uid(edge_node_connectivity.row(jedge));
     }
-    gidx_t g;
-    idx_t i;
-    bool operator<(const Sort& other) const { return (g < other.g); }
-};
+    return edge_uid;
+}
+
+// Sort the first row_size[row] edges of each row by edge uid, and by edge index for equal uids.
+// Rows are short, so this replaces a global sort of all edges and can be done in parallel.
+template <typename Connectivity>
+void sort_rows_by_edge_uid(Connectivity& connectivity, const std::vector<idx_t>& row_size,
+                           const std::vector<gidx_t>& edge_uid) {
+    const idx_t rows = connectivity.rows();
+    auto uid_order   = [&edge_uid](idx_t a, idx_t b) {
+        return edge_uid[a] < edge_uid[b] || (edge_uid[a] == edge_uid[b] && a < b);
+    };
+    atlas_omp_parallel {
+        std::vector<idx_t> edges;
+        atlas_omp_for(idx_t jrow = 0; jrow < rows; ++jrow) {
+            edges.resize(row_size[jrow]);
+            for (idx_t jcol = 0; jcol < row_size[jrow]; ++jcol) {
+                edges[jcol] = connectivity(jrow, jcol);
+            }
+            std::sort(edges.begin(), edges.end(), uid_order);
+            for (idx_t jcol = 0; jcol < row_size[jrow]; ++jcol) {
+                connectivity.set(jrow, jcol, edges[jcol]);
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 void build_element_to_edge_connectivity(Mesh& mesh) {
@@ -79,39 +107,26 @@ void build_element_to_edge_connectivity(Mesh& mesh) {
         cell_edge_connectivity.add(nb_elements, nb_edges_per_elem, init.data());
     }
 
-    idx_t nb_edges                                                   = mesh.edges().size();
-    const mesh::HybridElements::Connectivity& edge_cell_connectivity = mesh.edges().cell_connectivity();
-    const mesh::HybridElements::Connectivity& edge_node_connectivity = mesh.edges().node_connectivity();
+    idx_t nb_edges                    = mesh.edges().size();
+    const idx_t missing_value         = mesh.edges().cell_connectivity().missing_value();
+    const auto edge_cell_connectivity = mesh.edges().cell_connectivity().span();
+    const auto edge_node_connectivity = mesh.edges().node_connectivity().span();
 
     auto edge_flags   = array::make_view<int, 1>(mesh.edges().flags());
     auto is_pole_edge = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
-    // Sort edges for bit-reproducibility
-    std::vector<Sort> edge_sort;
-    edge_sort.reserve(nb_edges);
-    {
-        UniqueLonLat compute_uid(mesh);
-
-        for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-            edge_sort.emplace_back(Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge));
-        }
-
-        std::sort(edge_sort.data(), edge_sort.data() + nb_edges);
-    }
-
-    // Fill in cell_edge_connectivity
+    // Fill in cell_edge_connectivity in edge order
     std::vector<idx_t> edge_cnt(mesh.cells().size());
     for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-        int iedge = edge_sort[jedge].i;
         for (idx_t j = 0; j < 2; ++j) {
-            idx_t elem = edge_cell_connectivity(iedge, j);
+            idx_t elem = edge_cell_connectivity(jedge, j);
 
-            if (elem != edge_cell_connectivity.missing_value()) {
+            if (elem != missing_value) {
                 ATLAS_ASSERT(edge_cnt[elem] < cell_edge_connectivity.cols(elem));
-                cell_edge_connectivity.set(elem, edge_cnt[elem]++, iedge);
+                cell_edge_connectivity.set(elem, edge_cnt[elem]++, jedge);
             }
             else {
-                if (not is_pole_edge(iedge)) {
+                if (not is_pole_edge(jedge)) {
                     if (j == 0) {
                         auto node_gidx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
                         std::stringstream ss;
@@ -126,6 +141,9 @@ void build_element_to_edge_connectivity(Mesh& mesh) {
         }
     }
 
+    // Order edges of each element by edge uid for bit-reproducibility
+    sort_rows_by_edge_uid(cell_edge_connectivity, edge_cnt, compute_edge_uids(mesh));
+
 
     // Verify that all edges have been found
     auto field_flags = array::make_view<int, 1>(mesh.cells().flags());
@@ -161,7 +179,7 @@ void build_node_to_edge_connectivity(Mesh& mesh) {
     mesh::Nodes::Connectivity& node_to_edge = nodes.edge_connectivity();
     node_to_edge.clear();
 
-    const mesh::HybridElements::Connectivity& edge_node_connectivity = mesh.edges().node_connectivity();
+    const auto edge_node_connectivity = mesh.edges().node_connectivity().span();
 
     std::vector<idx_t> to_edge_size(nodes.size(), 0);
     for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
@@ -176,21 +194,15 @@ void build_node_to_edge_connectivity(Mesh& mesh) {
         to_edge_size[jnode] = 0;
     }
 
-    UniqueLonLat compute_uid(mesh);
-    std::vector<Sort> edge_sort(nb_edges);
     for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-        edge_sort[jedge] = Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge);
-    }
-    std::stable_sort(edge_sort.data(), edge_sort.data() + nb_edges);
-
-    for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-        idx_t iedge = edge_sort[jedge].i;
-        ATLAS_ASSERT(iedge < nb_edges);
         for (idx_t j = 0; j < 2; ++j) {
-            idx_t node = edge_node_connectivity(iedge, j);
-            node_to_edge.set(node, to_edge_size[node]++, iedge);
+            idx_t node = edge_node_connectivity(jedge, j);
+            node_to_edge.set(node, to_edge_size[node]++, jedge);
         }
     }
+
+    // Order edges of each node by edge uid for bit-reproducibility
+    sort_rows_by_edge_uid(node_to_edge, to_edge_size, compute_edge_uids(mesh));
 }
 
 class AccumulatePoleEdges {
@@ -319,19 +319,23 @@ void build_lookup_node2elem(const Mesh& mesh, Node2Elem& node2elem) {
         node2elem[jnode].reserve(12);
     }
 
-    const mesh::HybridElements::Connectivity& elem_nodes = mesh.cells().node_connectivity();
-    auto field_flags                                     = array::make_view<int, 1>(mesh.cells().flags());
-    auto patched                                         = [&field_flags](idx_t e) {
+    auto field_flags = array::make_view<int, 1>(mesh.cells().flags());
+    auto patched     = [&field_flags](idx_t e) {
         using Topology = atlas::mesh::Nodes::Topology;
         return Topology::check(field_flags(e), Topology::PATCH);
     };
 
-    idx_t nb_elems = mesh.cells().size();
-    for (idx_t elem = 0; elem < nb_elems; ++elem) {
-        if (not patched(elem)) {
-            for (idx_t n = 0; n < elem_nodes.cols(elem); ++n) {
-                int node = elem_nodes(elem, n);
-                node2elem[node].push_back(elem);
+    // Per element type, every element has the same number of nodes
+    for (idx_t t = 0; t < mesh.cells().nb_types(); ++t) {
+        const mesh::Elements& elements = mesh.cells().elements(t);
+        const auto elem_nodes          = elements.node_connectivity().span();
+        const idx_t begin              = elements.begin();
+        for (idx_t jelem = 0; jelem < elem_nodes.rows(); ++jelem) {
+            const idx_t elem = begin + jelem;
+            if (not patched(elem)) {
+                for (idx_t n = 0; n < elem_nodes.cols(); ++n) {
+                    node2elem[elem_nodes(jelem, n)].push_back(elem);
+                }
             }
         }
     }
@@ -1001,7 +1005,6 @@ public:
             mesh::Elements& elements                   = mesh.cells().elements(t);
 
             // Add new elements
-            BlockConnectivity& node_connectivity = elements.node_connectivity();
             if (nb_elements_of_type[t] == 0) {
                 continue;
             }
@@ -1009,6 +1012,8 @@ public:
             idx_t old_size      = elements.size();
             idx_t new_elems_pos = elements.add(nb_elements_of_type[t]);
 
+            const auto node_connectivity = elements.node_connectivity().span();
+
             auto elem_type_glb_idx = elements.view<gidx_t, 1>(mesh.cells().global_index());
             auto elem_type_part    = elements.view<int, 1>(mesh.cells().partition());
             auto elem_type_ridx    = elements.indexview<idx_t, 1>(mesh.cells().remote_index());
@@ -10,6 +10,7 @@
 
 #include <array>
 #include <bitset>
+#include <tuple>
 #include <utility>
 
 #include "atlas/mesh/actions/Reorder.h"
@@ -203,24 +204,26 @@ void reorder_elements_using_nodes(Mesh& mesh, Mesh::HybridElements& elements) {
     for (idx_t t = 0; t < elements.nb_types(); ++t) {
         auto& elems        = elements.elements(t);
         auto& connectivity = elems.node_connectivity();
+        auto halo          = elems.view<int, 1>(elems.halo());
         idx_t nb_nodes     = elems.nb_nodes();
         idx_t nb_elems     = elems.size();
-        std::vector<std::pair<idx_t, idx_t>> node_lowest_index;
+        // Elements remain sorted by halo
+        std::vector<std::tuple<int, idx_t, idx_t>> node_lowest_index;
         node_lowest_index.reserve(elems.size());
         for (idx_t e = 0; e < nb_elems; ++e) {
             idx_t lowest = std::numeric_limits<idx_t>::max();
             for (idx_t n = 0; n < nb_nodes; ++n) {
                 lowest = std::min(lowest, connectivity(e, n));
             }
-            node_lowest_index.emplace_back(lowest, e);
+            node_lowest_index.emplace_back(halo(e), lowest, e);
         }
         std::sort(node_lowest_index.begin(), node_lowest_index.end());
         std::vector<idx_t> order;
         order.reserve(nb_elems);
-        for (const auto& pair : node_lowest_index) {
-            order.emplace_back(pair.second);
+        for (const auto& key : node_lowest_index) {
+            order.emplace_back(std::get<2>(key));
         }
-        for (idx_t ifield = 0; ifield < mesh.edges().nb_fields(); ++ifield) {
+        for (idx_t ifield = 0; ifield < elements.nb_fields(); ++ifield) {
             reorder_field(elements.field(ifield), order, elems.begin(), elems.end());
         }
 
@@ -39,10 +39,10 @@ public:  // -- static functions --
     /// - mesh.edges().node_connectivity() gets updated
     static void reorderNodes(Mesh& mesh, const std::vector<idx_t>& order);
 
-    /// Reorder the cells by lowest node local index within each cell
+    /// Reorder the cells by lowest node local index within each cell, keeping cells sorted by halo
     static void reorderCellsUsingNodes(Mesh& mesh);
 
-    /// Reorder the edges by lowest node local index within each edge
+    /// Reorder the edges by lowest node local index within each edge, keeping edges sorted by halo
     static void reorderEdgesUsingNodes(Mesh& mesh);
 
 public:  // -- member functions --
@@ -14,6 +14,9 @@
 
 #include "eckit/filesystem/PathName.h"
 
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/IsGhostNode.h"
 #include "atlas/mesh/Mesh.h"
@@ -207,6 +210,96 @@ void write_load_balance_report(const Mesh& mesh, std::ostream& ofs) {
     }
 }
 
+void write_load_balance_report(const Mesh& mesh, const Field& weights, const std::string& filename) {
+    std::ofstream ofs;
+    if (mpi::rank() == 0) {
+        eckit::PathName path(filename);
+        ofs.open(path.localPath(), std::ofstream::out);
+    }
+
+    write_load_balance_report(mesh, weights, ofs);
+
+    if (mpi::rank() == 0) {
+        ofs.close();
+    }
+}
+
+void write_load_balance_report(const Mesh& mesh, const Field& weights, std::ostream& ofs) {
+    write_load_balance_report(mesh, ofs);
+
+    ATLAS_ASSERT(weights.datatype() == array::DataType::kind<double>());
+    ATLAS_ASSERT(weights.shape(0) >= mesh.nodes().size());
+    ATLAS_ASSERT(weights.rank() <= 2);
+
+    idx_t npart = mpi::size();
+    idx_t root  = 0;
+
+    std::vector<double> cost(npart, 0.);
+    {
+        const mesh::Nodes& nodes = mesh.nodes();
+        IsGhostNode is_ghost(nodes);
+        idx_t nb_nodes = nodes.size();
+        double owned_cost(0.);
+        if (weights.rank() == 1) {
+            auto w = array::make_view<double, 1>(weights);
+            for (idx_t n = 0; n < nb_nodes; ++n) {
+                if (not is_ghost(n)) {
+                    owned_cost += w(n);
+                }
+            }
+        }
+        else {
+            auto w = array::make_view<double, 2>(weights);
+            for (idx_t n = 0; n < nb_nodes; ++n) {
+                if (not is_ghost(n)) {
+                    for (idx_t jlev = 0; jlev < w.shape(1); ++jlev) {
+                        owned_cost += w(n, jlev);
+                    }
+                }
+            }
+        }
+        ATLAS_TRACE_MPI(GATHER) { mpi::comm().gather(owned_cost, cost, root); }
+    }
+
+    if (mpi::rank() == 0) {
+        int idt = 14;
+
+        double total = std::accumulate(cost.data(), cost.data() + npart, 0.);
+        double max   = *std::max_element(cost.data(), cost.data() + npart);
+        double min   = *std::min_element(cost.data(), cost.data() + npart);
+        double avg   = total / static_cast<double>(npart);
+
+        ofs << "#----------------------------------------------------\n";
+        ofs << "# COST\n";
+        ofs << std::setw(6) << "#     ";
+        ofs << std::setw(idt) << "tot";
+        ofs << std::setw(idt) << "max";
+        ofs << std::setw(idt) << "min";
+        ofs << std::setw(idt) << "avg";
+        ofs << std::setw(idt) << "imbalance(%)";
+        ofs << "\n";
+        ofs << std::setw(6) << "#     ";
+        ofs << std::setprecision(4) << std::scientific;
+        ofs << std::setw(idt) << total;
+        ofs << std::setw(idt) << max;
+        ofs << std::setw(idt) << min;
+        ofs << std::setw(idt) << avg;
+        ofs << std::setw(idt) << std::fixed << std::setprecision(2) << (avg > 0. ? (max / avg - 1.) * 100. : 0.);
+        ofs << "\n";
+        ofs << "# PER TASK\n";
+        ofs << std::setw(6) << "# part";
+        ofs << std::setw(idt) << "cost";
+        ofs << std::setw(idt) << "ratio(%)";
+        ofs << "\n";
+        for (idx_t jpart = 0; jpart < npart; ++jpart) {
+            ofs << std::setw(6) << jpart;
+            ofs << std::setw(idt) << std::scientific << std::setprecision(4) << cost[jpart];
+            ofs << std::setw(idt) << std::fixed << std::setprecision(2) << (avg > 0. ? cost[jpart] / avg * 100. : 0.);
+            ofs << "\n";
+        }
+    }
+}
+
 // ------------------------------------------------------------------
 
 // C wrapper interfaces to C++ routines
@@ -12,12 +12,18 @@
 
 namespace atlas {
 class Mesh;
+class Field;
 namespace mesh {
 namespace actions {
 
 void write_load_balance_report(const Mesh& mesh, std::ostream& ofs);
 void write_load_balance_report(const Mesh& mesh, const std::string& filename);
 
+/// @brief Write load balance report, including the imbalance of a per-node cost
+/// @param weights  double Field on the mesh nodes (rank 1, or rank 2 summed over levels)
+void write_load_balance_report(const Mesh& mesh, const Field& weights, std::ostream& ofs);
+void write_load_balance_report(const Mesh& mesh, const Field& weights, const std::string& filename);
+
 // ------------------------------------------------------------------
 // C wrapper interfaces to C++ routines
 
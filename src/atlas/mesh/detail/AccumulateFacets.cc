@@ -8,10 +8,18 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/mesh/Elements.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 
@@ -19,250 +27,256 @@ namespace atlas {
 namespace mesh {
 namespace detail {
 
-void accumulate_facets(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
-                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
-                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets, idx_t& nb_inner_facets,
-                       idx_t& missing_value) {
-    ATLAS_TRACE();
-    missing_value = -1;
-    std::vector<std::vector<idx_t>> node_to_facet(nodes.size());
-    for (auto& facet : node_to_facet) {
-        facet.reserve(6);
-    }
-    nb_facets       = 0;
-    nb_inner_facets = 0;
-    if (connectivity_facet_to_elem.size() == 0) {
-        connectivity_facet_to_elem.reserve(6 * cells.size());
-    }
-    if (facet_nodes_data.size() == 0) {
-        facet_nodes_data.reserve(6 * cells.size());
-    }
-    for (idx_t t = 0; t < cells.nb_types(); ++t) {
-        const mesh::Elements& elements            = cells.elements(t);
-        const mesh::BlockConnectivity& elem_nodes = elements.node_connectivity();
-        auto elem_flags                           = elements.view<int, 1>(elements.flags());
+namespace {
 
-        auto patch = [&elem_flags](idx_t e) {
-            using Topology = atlas::mesh::Nodes::Topology;
-            return Topology::check(elem_flags(e), Topology::PATCH);
-        };
-
-        idx_t nb_elems          = elements.size();
-        idx_t nb_nodes_in_facet = 2;
-
-        std::vector<std::vector<int>> facet_node_numbering;
-        idx_t nb_facets_in_elem;
-        if (elements.name() == "Pentagon") {
-            nb_facets_in_elem = 5;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 4;
-            facet_node_numbering[4][0] = 4;
-            facet_node_numbering[4][1] = 0;
-        }
-        else if (elements.name() == "Quadrilateral") {
-            nb_facets_in_elem = 4;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 0;
-        }
-        else if (elements.name() == "Triangle") {
-            nb_facets_in_elem = 3;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 0;
+using occurrence_t = std::int64_t;
+
+// Concurrent open-addressing hash table of facets, keyed on the sorted pair of facet nodes.
+//
+// A facet "occurrence" is a facet of an element, numbered in the order of a serial traversal of
+// element types, elements, and facets within elements. For every facet the table records the first
+// and the last occurrence, so that facet numbering and facet-to-element connectivity are identical to
+// those of a serial traversal, regardless of the number of threads inserting concurrently.
+class FacetTable {
+public:
+    static constexpr std::uint64_t EMPTY = std::numeric_limits<std::uint64_t>::max();
+
+    // The key packs both node indices of a facet in 32 bits each, which limits the number of nodes
+    static constexpr std::uint64_t MAX_NODES = std::uint64_t(1) << 32;
+
+    explicit FacetTable(size_t nb_occurrences) {
+        // Every inner facet occurs twice, so the load factor stays well below 1/2
+        capacity_ = 1024;
+        while (capacity_ < nb_occurrences + nb_occurrences / 2) {
+            capacity_ *= 2;
         }
-        else {
-            throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
+        mask_ = capacity_ - 1;
+        keys_.reset(new std::atomic<std::uint64_t>[capacity_]);
+        first_.reset(new std::atomic<occurrence_t>[capacity_]);
+        last_.reset(new std::atomic<occurrence_t>[capacity_]);
+        facet_.reset(new idx_t[capacity_]);
+        const idx_t capacity = static_cast<idx_t>(capacity_);
+        atlas_omp_parallel_for(idx_t slot = 0; slot < capacity; ++slot) {
+            keys_[slot].store(EMPTY, std::memory_order_relaxed);
+            first_[slot].store(std::numeric_limits<occurrence_t>::max(), std::memory_order_relaxed);
+            last_[slot].store(-1, std::memory_order_relaxed);
         }
+    }
 
-        std::vector<idx_t> facet_nodes(nb_nodes_in_facet);
+    static std::uint64_t key(idx_t node1, idx_t node2) {
+        if (node2 < node1) {
+            std::swap(node1, node2);
+        }
+        return (std::uint64_t(std::uint32_t(node1)) << 32) | std::uint64_t(std::uint32_t(node2));
+    }
 
-        for (idx_t e = 0; e < nb_elems; ++e) {
-            if (patch(e)) {
-                continue;
+    // Insert an occurrence of facet with given key, thread-safe. Returns the slot of the facet.
+    size_t insert(std::uint64_t key, occurrence_t occurrence) {
+        for (size_t slot = hash(key) & mask_;; slot = (slot + 1) & mask_) {
+            std::uint64_t k = keys_[slot].load(std::memory_order_acquire);
+            if (k == EMPTY && keys_[slot].compare_exchange_strong(k, key, std::memory_order_acq_rel)) {
+                k = key;
             }
-            for (idx_t f = 0; f < nb_facets_in_elem; ++f) {
-                bool found_face = false;
-
-                for (idx_t jnode = 0; jnode < nb_nodes_in_facet; ++jnode) {
-                    facet_nodes[jnode] = elem_nodes(e, facet_node_numbering[f][jnode]);
-                }
-
-                idx_t node = facet_nodes[0];
-                for (const idx_t face : node_to_facet[node]) {
-                    idx_t nb_matched_nodes = 0;
-                    if (nb_nodes_in_facet > 1)  // 2D or 3D
-                    {
-                        for (idx_t jnode = 0; jnode < nb_nodes_in_facet; ++jnode) {
-                            idx_t other_node = facet_nodes[jnode];
-                            for (const idx_t other_face : node_to_facet[other_node]) {
-                                if (other_face == face) {
-                                    ++nb_matched_nodes;
-                                    break;
-                                }
-                            }
-                        }
-                        if (nb_matched_nodes == nb_nodes_in_facet) {
-                            connectivity_facet_to_elem[2 * face + 1] = e + elements.begin();
-                            ++nb_inner_facets;
-                            found_face = true;
-                            break;
-                        }
-                    }
-                }
-
-                if (found_face == false) {
-                    connectivity_facet_to_elem.emplace_back(elements.begin() + e);
-                    // if 2nd element stays missing_value, it is a bdry face
-                    connectivity_facet_to_elem.emplace_back(missing_value);
-                    for (idx_t n = 0; n < nb_nodes_in_facet; ++n) {
-                        node_to_facet[facet_nodes[n]].emplace_back(nb_facets);
-                        facet_nodes_data.emplace_back(facet_nodes[n]);
-                    }
-                    ++nb_facets;
-                }
+            if (k == key) {
+                fetch_min(first_[slot], occurrence);
+                fetch_max(last_[slot], occurrence);
+                return slot;
             }
         }
     }
+
+    occurrence_t first(size_t slot) const { return first_[slot].load(std::memory_order_relaxed); }
+    occurrence_t last(size_t slot) const { return last_[slot].load(std::memory_order_relaxed); }
+    idx_t& facet(size_t slot) { return facet_[slot]; }
+
+private:
+    // Finaliser of the splitmix64 generator
+    static std::uint64_t hash(std::uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+    static void fetch_min(std::atomic<occurrence_t>& a, occurrence_t value) {
+        occurrence_t current = a.load(std::memory_order_relaxed);
+        while (value < current && !a.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+    static void fetch_max(std::atomic<occurrence_t>& a, occurrence_t value) {
+        occurrence_t current = a.load(std::memory_order_relaxed);
+        while (value > current && !a.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    size_t capacity_;
+    size_t mask_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> keys_;
+    std::unique_ptr<std::atomic<occurrence_t>[]> first_;
+    std::unique_ptr<std::atomic<occurrence_t>[]> last_;
+    std::unique_ptr<idx_t[]> facet_;
+};
+
+idx_t nb_facets_in_element(const mesh::Elements& elements) {
+    if (elements.name() == "Pentagon") {
+        return 5;
+    }
+    else if (elements.name() == "Quadrilateral") {
+        return 4;
+    }
+    else if (elements.name() == "Triangle") {
+        return 3;
+    }
+    throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
 }
 
+size_t count_facet_occurrences(const mesh::HybridElements& cells) {
+    size_t nb_occurrences = 0;
+    for (idx_t t = 0; t < cells.nb_types(); ++t) {
+        nb_occurrences += size_t(cells.elements(t).size()) * size_t(nb_facets_in_element(cells.elements(t)));
+    }
+    return nb_occurrences;
+}
+
+// Accumulate facets of elements in given range for each element type.
+// Facet f of an element with n nodes connects element nodes f and (f+1)%n.
+// Facets found in previous calls with the same table are matched as well.
 void accumulate_facets_in_range(std::vector<array::Range>& range, const mesh::HybridElements& cells,
-                                const mesh::Nodes& /*nodes*/,
                                 std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
                                 std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
-                                idx_t& nb_inner_facets, idx_t& missing_value,
-                                std::vector<std::vector<idx_t>>& node_to_facet) {
+                                idx_t& nb_inner_facets, idx_t missing_value, FacetTable& table,
+                                occurrence_t& occurrence_offset) {
     ATLAS_TRACE();
-    if (connectivity_facet_to_elem.size() == 0) {
-        connectivity_facet_to_elem.reserve(6 * cells.size());
-    }
-    if (facet_nodes_data.size() == 0) {
-        facet_nodes_data.reserve(6 * cells.size());
+
+    struct Occurrence {
+        idx_t elem;      // global element index, or -1 for patch elements
+        idx_t nodes[2];  // facet nodes, ordered as in the element
+        size_t slot;
+    };
+
+    // List all facet occurrences in serial traversal order
+    std::vector<Occurrence> occurrences;
+    {
+        size_t nb_occurrences = 0;
+        for (idx_t t = 0; t < cells.nb_types(); ++t) {
+            nb_occurrences +=
+                size_t(range[t].end() - range[t].start()) * size_t(nb_facets_in_element(cells.elements(t)));
+        }
+        occurrences.resize(nb_occurrences);
     }
+    size_t type_offset = 0;
     for (idx_t t = 0; t < cells.nb_types(); ++t) {
-        const mesh::Elements& elements            = cells.elements(t);
-        const mesh::BlockConnectivity& elem_nodes = elements.node_connectivity();
-        auto elem_flags                           = elements.view<int, 1>(elements.flags());
+        const mesh::Elements& elements = cells.elements(t);
+        const auto elem_nodes          = elements.node_connectivity().span();
+        const auto elem_flags          = elements.view<int, 1>(elements.flags());
+        const idx_t nb_facets_in_elem  = nb_facets_in_element(elements);
+        const idx_t e_start            = range[t].start();
+        const idx_t e_end              = range[t].end();
 
-        auto patch = [&elem_flags](idx_t e) {
+        atlas_omp_parallel_for(idx_t e = e_start; e < e_end; ++e) {
             using Topology = atlas::mesh::Nodes::Topology;
-            return Topology::check(elem_flags(e), Topology::PATCH);
-        };
-
-        idx_t nb_nodes_in_facet = 2;
-
-        std::vector<std::vector<int>> facet_node_numbering;
-        idx_t nb_facets_in_elem;
-        if (elements.name() == "Pentagon") {
-            nb_facets_in_elem = 5;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 4;
-            facet_node_numbering[4][0] = 4;
-            facet_node_numbering[4][1] = 0;
-        }
-        else if (elements.name() == "Quadrilateral") {
-            nb_facets_in_elem = 4;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 0;
-        }
-        else if (elements.name() == "Triangle") {
-            nb_facets_in_elem = 3;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 0;
-        }
-        else {
-            throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
+            const bool patch = Topology::check(elem_flags(e), Topology::PATCH);
+            for (idx_t f = 0; f < nb_facets_in_elem; ++f) {
+                Occurrence& o = occurrences[type_offset + size_t(e - e_start) * nb_facets_in_elem + f];
+                o.elem        = patch ? -1 : elements.begin() + e;
+                o.nodes[0]    = elem_nodes(e, f);
+                o.nodes[1]    = elem_nodes(e, (f + 1) % nb_facets_in_elem);
+            }
         }
+        type_offset += size_t(e_end - e_start) * nb_facets_in_elem;
+    }
 
-        std::vector<idx_t> facet_nodes(nb_nodes_in_facet);
+    const idx_t nb_occurrences = static_cast<idx_t>(occurrences.size());
 
-        const idx_t e_start = range[t].start();
-        const idx_t e_end   = range[t].end();
+    // Concurrent insertion in the hash table
+    atlas_omp_parallel_for(idx_t i = 0; i < nb_occurrences; ++i) {
+        Occurrence& o = occurrences[i];
+        if (o.elem >= 0) {
+            o.slot = table.insert(FacetTable::key(o.nodes[0], o.nodes[1]), occurrence_offset + i);
+        }
+    }
 
-        for (idx_t e = e_start; e < e_end; ++e) {
-            if (patch(e)) {
-                continue;
+    auto is_new_facet = [&](idx_t i) {
+        const Occurrence& o = occurrences[i];
+        return o.elem >= 0 && table.first(o.slot) == occurrence_offset + i;
+    };
+
+    // Number new facets in order of their first occurrence: count per chunk, then prefix sum
+    const idx_t nb_chunks = std::max(1, atlas_omp_get_max_threads()) * 4;
+    auto chunk_begin      = [&](idx_t c) { return idx_t((size_t(nb_occurrences) * size_t(c)) / size_t(nb_chunks)); };
+    std::vector<idx_t> chunk_offset(nb_chunks + 1, 0);
+    atlas_omp_parallel_for(idx_t c = 0; c < nb_chunks; ++c) {
+        idx_t count = 0;
+        for (idx_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i) {
+            if (is_new_facet(i)) {
+                ++count;
             }
+        }
+        chunk_offset[c + 1] = count;
+    }
+    chunk_offset[0] = nb_facets;
+    for (idx_t c = 0; c < nb_chunks; ++c) {
+        chunk_offset[c + 1] += chunk_offset[c];
+    }
+    const idx_t new_nb_facets = chunk_offset[nb_chunks];
+
+    facet_nodes_data.resize(2 * size_t(new_nb_facets));
+    connectivity_facet_to_elem.resize(2 * size_t(new_nb_facets));
+
+    atlas_omp_parallel_for(idx_t c = 0; c < nb_chunks; ++c) {
+        idx_t facet = chunk_offset[c];
+        for (idx_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i) {
+            if (is_new_facet(i)) {
+                const Occurrence& o                       = occurrences[i];
+                table.facet(o.slot)                       = facet;
+                facet_nodes_data[2 * facet + 0]           = o.nodes[0];
+                facet_nodes_data[2 * facet + 1]           = o.nodes[1];
+                connectivity_facet_to_elem[2 * facet + 0] = o.elem;
+                // if 2nd element stays missing_value, it is a bdry face
+                connectivity_facet_to_elem[2 * facet + 1] = missing_value;
+                ++facet;
+            }
+        }
+    }
 
-            for (idx_t f = 0; f < nb_facets_in_elem; ++f) {
-                bool found_face = false;
-
-                for (idx_t jnode = 0; jnode < nb_nodes_in_facet; ++jnode) {
-                    facet_nodes[jnode] = elem_nodes(e, facet_node_numbering[f][jnode]);
-                }
-
-                int node = facet_nodes[0];
-                for (idx_t face : node_to_facet[node]) {
-                    idx_t nb_matched_nodes = 0;
-                    if (nb_nodes_in_facet > 1)  // 2D or 3D
-                    {
-                        for (idx_t jnode = 0; jnode < nb_nodes_in_facet; ++jnode) {
-                            idx_t other_node = facet_nodes[jnode];
-                            for (idx_t other_face : node_to_facet[other_node]) {
-                                if (other_face == face) {
-                                    ++nb_matched_nodes;
-                                    break;
-                                }
-                            }
-                        }
-                        if (nb_matched_nodes == nb_nodes_in_facet) {
-                            connectivity_facet_to_elem[2 * face + 1] = e + elements.begin();
-                            ++nb_inner_facets;
-                            found_face = true;
-                            break;
-                        }
-                    }
-                }
-
-                if (found_face == false) {
-                    connectivity_facet_to_elem.emplace_back(elements.begin() + e);
-                    // if 2nd element stays missing_value, it is a bdry face
-                    connectivity_facet_to_elem.emplace_back(missing_value);
-                    for (idx_t n = 0; n < nb_nodes_in_facet; ++n) {
-                        node_to_facet[facet_nodes[n]].emplace_back(nb_facets);
-                        facet_nodes_data.emplace_back(facet_nodes[n]);
-                    }
-                    ++nb_facets;
-                }
+    // Connect the other element of inner facets. Should more than two elements share a facet,
+    // the last one is connected, as in a serial traversal.
+    idx_t nb_matched = 0;
+    atlas_omp_pragma( omp parallel for reduction(+:nb_matched) )
+    for (idx_t i = 0; i < nb_occurrences; ++i) {
+        const Occurrence& o = occurrences[i];
+        if (o.elem >= 0 && table.first(o.slot) != occurrence_offset + i) {
+            ++nb_matched;
+            if (table.last(o.slot) == occurrence_offset + i) {
+                connectivity_facet_to_elem[2 * table.facet(o.slot) + 1] = o.elem;
             }
         }
     }
+
+    nb_facets = new_nb_facets;
+    nb_inner_facets += nb_matched;
+    occurrence_offset += nb_occurrences;
+}
+
+}  // namespace
+
+void accumulate_facets(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets, idx_t& nb_inner_facets,
+                       idx_t& missing_value) {
+    ATLAS_TRACE();
+    missing_value   = -1;
+    nb_facets       = 0;
+    nb_inner_facets = 0;
+
+    std::vector<array::Range> range;
+    for (idx_t t = 0; t < cells.nb_types(); ++t) {
+        range.emplace_back(0, cells.elements(t).size());
+    }
+
+    ATLAS_ASSERT(std::uint64_t(nodes.size()) <= FacetTable::MAX_NODES, "Too many nodes for the facet table key");
+    FacetTable table(count_facet_occurrences(cells));
+    occurrence_t occurrence_offset = 0;
+    accumulate_facets_in_range(range, cells, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
+                               nb_inner_facets, missing_value, table, occurrence_offset);
 }
 
 void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
@@ -298,19 +312,18 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
     }
 
 
-    missing_value = -1;
-    std::vector<std::vector<idx_t>> node_to_facet(nodes.size());
-    for (auto& facets : node_to_facet) {
-        facets.reserve(6);
-    }
+    missing_value   = -1;
     nb_facets       = 0;
     nb_inner_facets = 0;
 
+    ATLAS_ASSERT(std::uint64_t(nodes.size()) <= FacetTable::MAX_NODES, "Too many nodes for the facet table key");
+    FacetTable table(count_facet_occurrences(cells));
+    occurrence_t occurrence_offset = 0;
 
     halo_offsets = std::vector<idx_t>{0};
     for (int h = 0; h <= maxhalo; ++h) {
-        accumulate_facets_in_range(ranges[h], cells, nodes, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
-                                   nb_inner_facets, missing_value, node_to_facet);
+        accumulate_facets_in_range(ranges[h], cells, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
+                                   nb_inner_facets, missing_value, table, occurrence_offset);
         halo_offsets.emplace_back(nb_facets);
     }
 }
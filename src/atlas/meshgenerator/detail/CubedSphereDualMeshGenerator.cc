@@ -26,6 +26,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/cubedsphere/CubedSphereUtility.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 
 #define DEBUG_OUTPUT 0
 #define DEBUG_OUTPUT_DETAIL 0
@@ -300,7 +301,7 @@ void CubedSphereDualMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid,
     // Need to decrement halo by one.
     auto nodesHalo = array::make_view<int, 1>(nodes.halo());
 
-    for (idx_t idx = 0; idx < nodes.size(); ++idx) {
+    atlas_omp_parallel_for(idx_t idx = 0; idx < nodes.size(); ++idx) {
         nodesHalo(idx) = std::max(0, nodesHalo(idx) - 1);
     }
 
@@ -322,16 +323,17 @@ void CubedSphereDualMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid,
         bool incomplete{};           // True if nodes are missing.
     };
 
-    auto nodeLists = std::vector<NodeList>{};
+    // Exclude outer ring of cubed sphere mesh halo. Nodes are sorted by halo,
+    // so this is a trailing range of nodes.
+    idx_t nDualCells = 0;
+    while (nDualCells < primalNodes.size() && primalNodesHalo(nDualCells) != nHalo + 1) {
+        ++nDualCells;
+    }
 
-    for (idx_t idx = 0; idx < primalNodes.size(); ++idx) {
-        // Exclude outer ring of cubed sphere mesh halo.
-        if (primalNodesHalo(idx) == nHalo + 1) {
-            break;
-        }
+    auto nodeLists = std::vector<NodeList>(static_cast<size_t>(nDualCells));
 
-        nodeLists.emplace_back();
-        auto& nodeList = nodeLists.back();
+    atlas_omp_parallel_for(idx_t idx = 0; idx < nDualCells; ++idx) {
+        auto& nodeList = nodeLists[static_cast<size_t>(idx)];
 
         // Get tij of cell.
         const auto tCell  = primalNodesTij(idx, Coordinates::T);
@@ -435,7 +437,7 @@ void CubedSphereDualMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid,
     auto& nodeConnectivity = cells.node_connectivity();
 
     // Loop over dual mesh cells and set connectivity.
-    for (idx_t idx = 0; idx < nCells; ++idx) {
+    atlas_omp_parallel_for(idx_t idx = 0; idx < nCells; ++idx) {
         // Set connectivity.
         nodeConnectivity.set(idx, nodeLists[idx].nodes.data());
 
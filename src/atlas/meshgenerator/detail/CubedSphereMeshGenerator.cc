@@ -31,6 +31,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/cubedsphere/CubedSphereUtility.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/projection/detail/CubedSphereProjectionBase.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -357,6 +358,53 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
         return std::make_pair(iNode > 0 ? iNode - 1 : iNode, jNode > 0 ? jNode - 1 : jNode);
     };
 
+    // Global cells and nodes are numbered in (t, j, i) order. To do this in
+    // parallel, the rows of all tiles are split into one contiguous chunk per
+    // thread. Each chunk is counted first, and then numbered starting from the
+    // counts of the chunks before it.
+    const idx_t nChunks = std::max(1, atlas_omp_get_max_threads());
+
+    // Return the first row of a chunk.
+    const auto chunkBegin = [&](idx_t nRows, idx_t chunk) -> idx_t {
+        return static_cast<idx_t>((static_cast<size_t>(nRows) * static_cast<size_t>(chunk)) /
+                                  static_cast<size_t>(nChunks));
+    };
+
+    // Replace per-chunk, per-partition counts by the counts of all preceding
+    // chunks. Returns the total count of each partition.
+    const auto chunkPartOffsets = [&](std::vector<idx_t>& chunkPartCounts) -> std::vector<idx_t> {
+        auto partCounts = std::vector<idx_t>(static_cast<size_t>(nParts), 0);
+        for (idx_t chunk = 0; chunk < nChunks; ++chunk) {
+            for (idx_t part = 0; part < nParts; ++part) {
+                idx_t& count           = chunkPartCounts[static_cast<size_t>(chunk * nParts + part)];
+                const idx_t chunkCount = count;
+                count                  = partCounts[static_cast<size_t>(part)];
+                partCounts[static_cast<size_t>(part)] += chunkCount;
+            }
+        }
+        return partCounts;
+    };
+
+    // Row (t, j) of a local bounding box.
+    struct Row {
+        idx_t t{};
+        idx_t j{};
+    };
+
+    // Join per-row lists of local elements, keeping (t, j, i) order.
+    const auto joinRows = [](const std::vector<std::vector<LocalElem>>& rowElems) -> std::vector<LocalElem> {
+        size_t size = 0;
+        for (const auto& elems : rowElems) {
+            size += elems.size();
+        }
+        auto localElems = std::vector<LocalElem>{};
+        localElems.reserve(size);
+        for (const auto& elems : rowElems) {
+            localElems.insert(localElems.end(), elems.begin(), elems.end());
+        }
+        return localElems;
+    };
+
     // ---------------------------------------------------------------------------
     // 2. GLOBAL CELL DISTRIBUTION
     //    Need to construct a lightweight global mesh. This will help us pair up
@@ -401,14 +449,49 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
         ++tijIt;
     }
 
-    // Set counters for cell local indices.
-    auto cellLocalIdxCount = std::vector<idx_t>(nParts, 0);
+    // Rows of cells over all tiles.
+    const idx_t cellRowSize = N + 2 * nHalo;
+    const idx_t nCellRows   = 6 * cellRowSize;
 
-    // Give possible edge-halo cells a unique global ID.
-    gidx_t cellGlobalIdxCount = nCellsUnique + 1;
+    // Count cells per chunk: interior cells for each partition, and the rest.
+    auto chunkCellLocalIdxCount  = std::vector<idx_t>(static_cast<size_t>(nChunks * nParts), 0);
+    auto chunkCellGlobalIdxCount = std::vector<gidx_t>(static_cast<size_t>(nChunks + 1), 0);
 
-    for (idx_t t = 0; t < 6; ++t) {
-        for (idx_t j = -nHalo; j < N + nHalo; ++j) {
+    atlas_omp_parallel_for(idx_t chunk = 0; chunk < nChunks; ++chunk) {
+        idx_t* cellLocalIdxCount = chunkCellLocalIdxCount.data() + chunk * nParts;
+        for (idx_t row = chunkBegin(nCellRows, chunk); row < chunkBegin(nCellRows, chunk + 1); ++row) {
+            const idx_t t = row / cellRowSize;
+            const idx_t j = row % cellRowSize - nHalo;
+            for (idx_t i = -nHalo; i < N + nHalo; ++i) {
+                if (invalidCell(i, j)) {
+                    continue;
+                }
+                if (interiorCell(i, j)) {
+                    ++cellLocalIdxCount[globalCells[getCellIdx(i, j, t)].part];
+                }
+                else {
+                    ++chunkCellGlobalIdxCount[static_cast<size_t>(chunk + 1)];
+                }
+            }
+        }
+    }
+
+    const auto cellLocalIdxTotal = chunkPartOffsets(chunkCellLocalIdxCount);
+    std::partial_sum(chunkCellGlobalIdxCount.begin(), chunkCellGlobalIdxCount.end(), chunkCellGlobalIdxCount.begin());
+
+    ATLAS_ASSERT(idxSum(cellLocalIdxTotal) == nCellsUnique);
+    ATLAS_ASSERT(chunkCellGlobalIdxCount.back() == nCellsTotal - nCellsUnique);
+
+    atlas_omp_parallel_for(idx_t chunk = 0; chunk < nChunks; ++chunk) {
+        // Set counters for cell local indices.
+        idx_t* cellLocalIdxCount = chunkCellLocalIdxCount.data() + chunk * nParts;
+
+        // Give possible edge-halo cells a unique global ID.
+        gidx_t cellGlobalIdxCount = nCellsUnique + 1 + chunkCellGlobalIdxCount[static_cast<size_t>(chunk)];
+
+        for (idx_t row = chunkBegin(nCellRows, chunk); row < chunkBegin(nCellRows, chunk + 1); ++row) {
+            const idx_t t = row / cellRowSize;
+            const idx_t j = row % cellRowSize - nHalo;
             for (idx_t i = -nHalo; i < N + nHalo; ++i) {
                 // Skip invalid cell.
                 if (invalidCell(i, j)) {
@@ -421,7 +504,7 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
                 // Set cell remote index if interior cell.
                 if (interiorCell(i, j)) {
                     // Set remote index.
-                    globalCell.remoteIdx = cellLocalIdxCount[static_cast<size_t>(globalCell.part)]++;
+                    globalCell.remoteIdx = cellLocalIdxCount[globalCell.part]++;
                 }
                 else {
                     // Set global index.
@@ -432,9 +515,6 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
         }
     }
 
-    ATLAS_ASSERT(idxSum(cellLocalIdxCount) == nCellsUnique);
-    ATLAS_ASSERT(cellGlobalIdxCount == nCellsTotal + 1);
-
     // ---------------------------------------------------------------------------
     // 3. GLOBAL NODE DISTRIBUTION
     //    Construct a lightweight global distribution of nodes. Again, this will
@@ -444,15 +524,22 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
     // Make list of all nodes.
     auto globalNodes = std::vector<GlobalElem>(static_cast<size_t>(nNodesArray));
 
-    // Set counters for local node indices.
-    auto nodeLocalIdxCount = std::vector<idx_t>(nParts, 0);
-
-    // Set counter for global indices.
-    gidx_t nodeGlobalOwnedIdxCount = 1;
-    idx_t nodeGlobalGhostIdxCount  = nNodesUnique + 1;
-
-    for (idx_t t = 0; t < 6; ++t) {
-        for (idx_t j = -nHalo; j < N + nHalo + 1; ++j) {
+    // Rows of nodes over all tiles.
+    const idx_t nodeRowSize = N + 2 * nHalo + 1;
+    const idx_t nNodeRows   = 6 * nodeRowSize;
+
+    // Count nodes per chunk: owned nodes for each partition, owned nodes and
+    // ghost nodes. The partition of owned nodes is set here, so that the
+    // (possibly expensive) tile check is done only once.
+    auto chunkNodeLocalIdxCount       = std::vector<idx_t>(static_cast<size_t>(nChunks * nParts), 0);
+    auto chunkNodeGlobalOwnedIdxCount = std::vector<gidx_t>(static_cast<size_t>(nChunks + 1), 0);
+    auto chunkNodeGlobalGhostIdxCount = std::vector<gidx_t>(static_cast<size_t>(nChunks + 1), 0);
+
+    atlas_omp_parallel_for(idx_t chunk = 0; chunk < nChunks; ++chunk) {
+        idx_t* nodeLocalIdxCount = chunkNodeLocalIdxCount.data() + chunk * nParts;
+        for (idx_t row = chunkBegin(nNodeRows, chunk); row < chunkBegin(nNodeRows, chunk + 1); ++row) {
+            const idx_t t = row / nodeRowSize;
+            const idx_t j = row % nodeRowSize - nHalo;
             for (idx_t i = -nHalo; i < N + nHalo + 1; ++i) {
                 // Skip if not a valid node.
                 if (invalidNode(i, j)) {
@@ -467,18 +554,12 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
                 std::tie(iCell, jCell)      = nodeOwnerCell(i, j);
                 const GlobalElem& ownerCell = globalCells[getCellIdx(iCell, jCell, t)];
 
+                bool isOwner = false;
                 if (interiorNode(i, j)) {
                     // Node is definitely an owner.
-                    globalNode.globalIdx = nodeGlobalOwnedIdxCount++;
-                    globalNode.part      = ownerCell.part;
-                    globalNode.remoteIdx = nodeLocalIdxCount[static_cast<size_t>(globalNode.part)]++;
+                    isOwner = true;
                 }
-                else if (exteriorNode(i, j)) {
-                    // Node is definitely a ghost.
-                    globalNode.globalIdx = nodeGlobalGhostIdxCount++;
-                    // Leave remote index and partition undefined.
-                }
-                else {
+                else if (not exteriorNode(i, j)) {
                     // We're not sure (i.e., node is on a tile edge).
 
                     // Check that xy is on this tile.
@@ -489,24 +570,65 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
                     // This is cheaper than determining the correct tGlobal.
                     idx_t tGlobal = csProjection.getCubedSphereTiles().indexFromXY(xy.data());
 
-                    if (tGlobal == t) {
-                        // Node is an owner.
-                        globalNode.globalIdx = nodeGlobalOwnedIdxCount++;
-                        globalNode.part      = ownerCell.part;
-                        globalNode.remoteIdx = nodeLocalIdxCount[static_cast<size_t>(globalNode.part)]++;
-                    }
-                    else {
-                        // Node is a ghost.
-                        globalNode.globalIdx = nodeGlobalGhostIdxCount++;
-                    }
-                }  // Finished with this node.
+                    isOwner = (tGlobal == t);
+                }
+
+                if (isOwner) {
+                    globalNode.part = ownerCell.part;
+                    ++nodeLocalIdxCount[globalNode.part];
+                    ++chunkNodeGlobalOwnedIdxCount[static_cast<size_t>(chunk + 1)];
+                }
+                else {
+                    // Leave partition undefined.
+                    ++chunkNodeGlobalGhostIdxCount[static_cast<size_t>(chunk + 1)];
+                }
             }
-        }  // Finished with all nodes on tile.
-    }      // Finished with all tiles.
+        }
+    }
+
+    const auto nodeLocalIdxTotal = chunkPartOffsets(chunkNodeLocalIdxCount);
+    std::partial_sum(chunkNodeGlobalOwnedIdxCount.begin(), chunkNodeGlobalOwnedIdxCount.end(),
+                     chunkNodeGlobalOwnedIdxCount.begin());
+    std::partial_sum(chunkNodeGlobalGhostIdxCount.begin(), chunkNodeGlobalGhostIdxCount.end(),
+                     chunkNodeGlobalGhostIdxCount.begin());
+
+    ATLAS_ASSERT(chunkNodeGlobalOwnedIdxCount.back() == nNodesUnique);
+    ATLAS_ASSERT(chunkNodeGlobalGhostIdxCount.back() == nNodesTotal - nNodesUnique);
+    ATLAS_ASSERT(idxSum(nodeLocalIdxTotal) == nNodesUnique);
+
+    atlas_omp_parallel_for(idx_t chunk = 0; chunk < nChunks; ++chunk) {
+        // Set counters for local node indices.
+        idx_t* nodeLocalIdxCount = chunkNodeLocalIdxCount.data() + chunk * nParts;
 
-    ATLAS_ASSERT(nodeGlobalOwnedIdxCount == nNodesUnique + 1);
-    ATLAS_ASSERT(nodeGlobalGhostIdxCount == nNodesTotal + 1);
-    ATLAS_ASSERT(idxSum(nodeLocalIdxCount) == nNodesUnique);
+        // Set counter for global indices.
+        gidx_t nodeGlobalOwnedIdxCount = 1 + chunkNodeGlobalOwnedIdxCount[static_cast<size_t>(chunk)];
+        gidx_t nodeGlobalGhostIdxCount = nNodesUnique + 1 + chunkNodeGlobalGhostIdxCount[static_cast<size_t>(chunk)];
+
+        for (idx_t row = chunkBegin(nNodeRows, chunk); row < chunkBegin(nNodeRows, chunk + 1); ++row) {
+            const idx_t t = row / nodeRowSize;
+            const idx_t j = row % nodeRowSize - nHalo;
+            for (idx_t i = -nHalo; i < N + nHalo + 1; ++i) {
+                // Skip if not a valid node.
+                if (invalidNode(i, j)) {
+                    continue;
+                }
+
+                // Get this node.
+                GlobalElem& globalNode = globalNodes[getNodeIdx(i, j, t)];
+
+                if (globalNode.part != undefinedIdx) {
+                    // Node is an owner.
+                    globalNode.globalIdx = nodeGlobalOwnedIdxCount++;
+                    globalNode.remoteIdx = nodeLocalIdxCount[globalNode.part]++;
+                }
+                else {
+                    // Node is a ghost.
+                    globalNode.globalIdx = nodeGlobalGhostIdxCount++;
+                    // Leave remote index and partition undefined.
+                }
+            }
+        }
+    }
 
     // ---------------------------------------------------------------------------
     // 4. LOCATE LOCAL CELLS.
@@ -516,79 +638,95 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
     //    away from an owner cell.
     // ---------------------------------------------------------------------------
 
-    // Make vector of local cells.
-    auto localCells = std::vector<LocalElem>{};
-
-    // Loop over all possible local cells.
+    // Make list of rows of local bounding boxes.
+    auto cellRows = std::vector<Row>{};
     for (idx_t t = 0; t < 6; ++t) {
         // Limit range to bounds recorded earlier.
         const BoundingBox& bounds = cellBounds[static_cast<size_t>(t)];
 
         for (idx_t j = bounds.jBegin; j < bounds.jEnd; ++j) {
-            for (idx_t i = bounds.iBegin; i < bounds.iEnd; ++i) {
-                if (invalidCell(i, j)) {
-                    continue;
-                }
+            cellRows.push_back(Row{t, j});
+        }
+    }
 
-                // Get cell
-                GlobalElem& globalCell = globalCells[getCellIdx(i, j, t)];
+    // Make vectors of local cells on each row.
+    auto rowLocalCells = std::vector<std::vector<LocalElem>>(cellRows.size());
 
-                // Check if cell is an owner.
-                if (globalCell.part == static_cast<idx_t>(thisPart)) {
-                    // Cell is an owner.
-                    localCells.emplace_back();
-                    LocalElem& localCell = localCells.back();
+    // Loop over all possible local cells.
+    atlas_omp_parallel_for(idx_t row = 0; row < static_cast<idx_t>(cellRows.size()); ++row) {
+        const idx_t t             = cellRows[static_cast<size_t>(row)].t;
+        const idx_t j             = cellRows[static_cast<size_t>(row)].j;
+        const BoundingBox& bounds = cellBounds[static_cast<size_t>(t)];
+        auto& rowCells            = rowLocalCells[static_cast<size_t>(row)];
 
-                    localCell.type      = ElemType::OWNER;
-                    localCell.halo      = 0;
-                    localCell.t         = t;
-                    localCell.i         = i;
-                    localCell.j         = j;
-                    localCell.globalPtr = &globalCell;
-                }
-                else {
-                    // Cell is halo if there are nearby owners.
-                    bool ownerFound = false;
-                    idx_t halo      = nHalo;
-                    for (idx_t jHalo = j - nHalo; jHalo < j + nHalo + 1; ++jHalo) {
-                        for (idx_t iHalo = i - nHalo; iHalo < i + nHalo + 1; ++iHalo) {
-                            if (invalidCell(iHalo, jHalo) || (iHalo == i && jHalo == j)) {
-                                continue;
-                            }
+        for (idx_t i = bounds.iBegin; i < bounds.iEnd; ++i) {
+            if (invalidCell(i, j)) {
+                continue;
+            }
 
-                            // Is there a nearby owner cell?
-                            const GlobalElem& ownerCell = globalCells[getCellIdx(iHalo, jHalo, t)];
+            // Get cell
+            GlobalElem& globalCell = globalCells[getCellIdx(i, j, t)];
+
+            // Check if cell is an owner.
+            if (globalCell.part == static_cast<idx_t>(thisPart)) {
+                // Cell is an owner.
+                rowCells.emplace_back();
+                LocalElem& localCell = rowCells.back();
+
+                localCell.type      = ElemType::OWNER;
+                localCell.halo      = 0;
+                localCell.t         = t;
+                localCell.i         = i;
+                localCell.j         = j;
+                localCell.globalPtr = &globalCell;
+            }
+            else {
+                // Cell is halo if there are nearby owners.
+                bool ownerFound = false;
+                idx_t halo      = nHalo;
+                for (idx_t jHalo = j - nHalo; jHalo < j + nHalo + 1; ++jHalo) {
+                    for (idx_t iHalo = i - nHalo; iHalo < i + nHalo + 1; ++iHalo) {
+                        if (invalidCell(iHalo, jHalo) || (iHalo == i && jHalo == j)) {
+                            continue;
+                        }
 
-                            const bool isOwner = ownerCell.part == static_cast<idx_t>(thisPart);
+                        // Is there a nearby owner cell?
+                        const GlobalElem& ownerCell = globalCells[getCellIdx(iHalo, jHalo, t)];
 
-                            ownerFound = ownerFound || isOwner;
+                        const bool isOwner = ownerCell.part == static_cast<idx_t>(thisPart);
 
-                            if (isOwner) {
-                                // Determine halo level from cell distance (l-infinity norm).
-                                const idx_t dist = std::max(std::abs(iHalo - i), std::abs(jHalo - j));
+                        ownerFound = ownerFound || isOwner;
 
-                                halo = std::min(dist, halo);
-                            }
+                        if (isOwner) {
+                            // Determine halo level from cell distance (l-infinity norm).
+                            const idx_t dist = std::max(std::abs(iHalo - i), std::abs(jHalo - j));
+
+                            halo = std::min(dist, halo);
                         }
                     }
+                }
 
-                    if (ownerFound) {
-                        // Cell is a halo.
-                        localCells.emplace_back();
-                        LocalElem& localCell = localCells.back();
+                if (ownerFound) {
+                    // Cell is a halo.
+                    rowCells.emplace_back();
+                    LocalElem& localCell = rowCells.back();
 
-                        localCell.type      = ElemType::HALO;
-                        localCell.halo      = halo;
-                        localCell.t         = t;
-                        localCell.i         = i;
-                        localCell.j         = j;
-                        localCell.globalPtr = &globalCell;
+                    localCell.type      = ElemType::HALO;
+                    localCell.halo      = halo;
+                    localCell.t         = t;
+                    localCell.i         = i;
+                    localCell.j         = j;
+                    localCell.globalPtr = &globalCell;
 
-                    }  // Finished with halo search.
-                }      // Finished with cell.
-            }
-        }  // Finished with all cells on tile.
-    }      // Finished with all tiles.
+                }  // Finished with halo search.
+            }      // Finished with cell.
+        }
+    }  // Finished with all rows.
+
+    // Make vector of local cells.
+    auto localCells         = joinRows(rowLocalCells);
+    const idx_t nLocalCells = static_cast<idx_t>(localCells.size());
+    rowLocalCells.clear();
 
     // Partition by cell type.
     auto haloBeginIt =
@@ -601,7 +739,8 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
 
     // Point global cell to local cell. This is needed to determine node halos.
     // Need to determine remote index and partition if we haven't done so already.
-    for (LocalElem& localCell : localCells) {
+    atlas_omp_parallel_for(idx_t cellLocalIdx = 0; cellLocalIdx < nLocalCells; ++cellLocalIdx) {
+        LocalElem& localCell          = localCells[static_cast<size_t>(cellLocalIdx)];
         localCell.globalPtr->localPtr = &localCell;
 
         if (localCell.globalPtr->remoteIdx == undefinedIdx) {
@@ -625,79 +764,96 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
     //    mesh.
     // ---------------------------------------------------------------------------
 
-    // Make vector of local nodes.
-    auto localNodes = std::vector<LocalElem>{};
-
-    // Loop over all possible local nodes.
+    // Make list of rows of local bounding boxes, including the node row above
+    // the top row of cells.
+    auto nodeRows = std::vector<Row>{};
     for (idx_t t = 0; t < 6; ++t) {
         // Limit range to bounds recorded earlier.
         const BoundingBox& bounds = cellBounds[static_cast<size_t>(t)];
 
         for (idx_t j = bounds.jBegin; j < bounds.jEnd + 1; ++j) {
-            for (idx_t i = bounds.iBegin; i < bounds.iEnd + 1; ++i) {
-                if (invalidNode(i, j)) {
-                    continue;
-                }
+            nodeRows.push_back(Row{t, j});
+        }
+    }
 
-                // Get node.
-                GlobalElem& globalNode = globalNodes[getNodeIdx(i, j, t)];
+    // Make vectors of local nodes on each row.
+    auto rowLocalNodes = std::vector<std::vector<LocalElem>>(nodeRows.size());
 
-                // Check if node is an owner.
-                if (globalNode.part == static_cast<idx_t>(thisPart)) {
-                    // Node is an owner.
-                    localNodes.emplace_back();
-                    LocalElem& localNode = localNodes.back();
+    // Loop over all possible local nodes.
+    atlas_omp_parallel_for(idx_t row = 0; row < static_cast<idx_t>(nodeRows.size()); ++row) {
+        const idx_t t             = nodeRows[static_cast<size_t>(row)].t;
+        const idx_t j             = nodeRows[static_cast<size_t>(row)].j;
+        const BoundingBox& bounds = cellBounds[static_cast<size_t>(t)];
+        auto& rowNodes            = rowLocalNodes[static_cast<size_t>(row)];
+
+        for (idx_t i = bounds.iBegin; i < bounds.iEnd + 1; ++i) {
+            if (invalidNode(i, j)) {
+                continue;
+            }
+
+            // Get node.
+            GlobalElem& globalNode = globalNodes[getNodeIdx(i, j, t)];
+
+            // Check if node is an owner.
+            if (globalNode.part == static_cast<idx_t>(thisPart)) {
+                // Node is an owner.
+                rowNodes.emplace_back();
+                LocalElem& localNode = rowNodes.back();
+
+                localNode.type      = ElemType::OWNER;
+                localNode.halo      = 0;
+                localNode.i         = i;
+                localNode.j         = j;
+                localNode.t         = t;
+                localNode.globalPtr = &globalNode;
+            }
+            else {
+                // Node is possibly a ghost or halo.
+
+                // Search four neighbouring cells of node.
+                bool isGhost = false;
+                idx_t halo   = nHalo;
+
+                // A double-loop with no more than four iterations!
+                for (idx_t iCell = i - 1; iCell < i + 1; ++iCell) {
+                    for (idx_t jCell = j - 1; jCell < j + 1; ++jCell) {
+                        if (invalidCell(iCell, jCell)) {
+                            continue;
+                        }
+
+                        const GlobalElem& globalCell = globalCells[getCellIdx(iCell, jCell, t)];
+
+                        // Get halo information from cell.
+                        // By this point, any global cell on this PE will have a
+                        // non-null local cell pointer.
+                        if (globalCell.localPtr) {
+                            isGhost = true;
+                            halo    = std::min<idx_t>(halo, globalCell.localPtr->halo);
+                        }
+                    }
+                }
 
-                    localNode.type      = ElemType::OWNER;
-                    localNode.halo      = 0;
+                if (isGhost) {
+                    // Node is an ghost/halo.
+                    rowNodes.emplace_back();
+                    LocalElem& localNode = rowNodes.back();
+
+                    localNode.type      = ElemType::HALO;
+                    localNode.halo      = halo;
+                    localNode.t         = t;
                     localNode.i         = i;
                     localNode.j         = j;
-                    localNode.t         = t;
                     localNode.globalPtr = &globalNode;
                 }
-                else {
-                    // Node is possibly a ghost or halo.
-
-                    // Search four neighbouring cells of node.
-                    bool isGhost = false;
-                    idx_t halo   = nHalo;
-
-                    // A double-loop with no more than four iterations!
-                    for (idx_t iCell = i - 1; iCell < i + 1; ++iCell) {
-                        for (idx_t jCell = j - 1; jCell < j + 1; ++jCell) {
-                            if (invalidCell(iCell, jCell)) {
-                                continue;
-                            }
-
-                            const GlobalElem& globalCell = globalCells[getCellIdx(iCell, jCell, t)];
-
-                            // Get halo information from cell.
-                            // By this point, any global cell on this PE will have a
-                            // non-null local cell pointer.
-                            if (globalCell.localPtr) {
-                                isGhost = true;
-                                halo    = std::min<idx_t>(halo, globalCell.localPtr->halo);
-                            }
-                        }
-                    }
 
-                    if (isGhost) {
-                        // Node is an ghost/halo.
-                        localNodes.emplace_back();
-                        LocalElem& localNode = localNodes.back();
-
-                        localNode.type      = ElemType::HALO;
-                        localNode.halo      = halo;
-                        localNode.t         = t;
-                        localNode.i         = i;
-                        localNode.j         = j;
-                        localNode.globalPtr = &globalNode;
-                    }
+            }  // Finished with this node.
+        }
+    }  // Finished with all rows.
 
-                }  // Finished with this node.
-            }
-        }  // Finished with all nodes on tile.
-    }      // Finished with all tiles.
+    // Make vector of local nodes.
+    auto localNodes         = joinRows(rowLocalNodes);
+    const idx_t nLocalNodes = static_cast<idx_t>(localNodes.size());
+    rowLocalNodes.clear();
 
     // Partition by node type.
     auto ghostBeginIt =
@@ -711,7 +867,8 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
     // Associate global nodes with local nodes. Allows us to determine node
     // local indices around a cell.
     // Determine partition and remote index if we haven't done so already.
-    for (LocalElem& localNode : localNodes) {
+    atlas_omp_parallel_for(idx_t nodeLocalIdx = 0; nodeLocalIdx < nLocalNodes; ++nodeLocalIdx) {
+        LocalElem& localNode          = localNodes[static_cast<size_t>(nodeLocalIdx)];
         localNode.globalPtr->localPtr = &localNode;
 
         if (localNode.globalPtr->remoteIdx == undefinedIdx) {
@@ -753,8 +910,9 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
     auto nodesTij       = array::make_view<idx_t, 2>(tijField);
 
     // Set fields.
-    idx_t nodeLocalIdx = 0;
-    for (const LocalElem& localNode : localNodes) {
+    atlas_omp_parallel_for(idx_t nodeLocalIdx = 0; nodeLocalIdx < nLocalNodes; ++nodeLocalIdx) {
+        const LocalElem& localNode = localNodes[static_cast<size_t>(nodeLocalIdx)];
+
         // Set global index.
         nodesGlobalIdx(nodeLocalIdx) = localNode.globalPtr->globalIdx;
 
@@ -805,8 +963,6 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
                 break;
             }
         }
-
-        ++nodeLocalIdx;
     }
 
     // ---------------------------------------------------------------------------
@@ -855,8 +1011,9 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
         return static_cast<idx_t>(globalNode.localPtr - localNodes.data());
     };
 
-    idx_t cellLocalIdx = 0;
-    for (const LocalElem& localCell : localCells) {
+    atlas_omp_parallel_for(idx_t cellLocalIdx = 0; cellLocalIdx < nLocalCells; ++cellLocalIdx) {
+        const LocalElem& localCell = localCells[static_cast<size_t>(cellLocalIdx)];
+
         // Get local indices four surroundings nodes.
         const auto quadNodeIdx = std::array<idx_t, 4>{getNodeLocalIdx(localCell.i, localCell.j, localCell.t),
                                                       getNodeLocalIdx(localCell.i + 1, localCell.j, localCell.t),
@@ -918,8 +1075,6 @@ void CubedSphereMeshGenerator::generate_mesh(const CubedSphereGrid& csGrid, cons
                 break;
             }
         }
-
-        ++cellLocalIdx;
     }
 
     // ---------------------------------------------------------------------------
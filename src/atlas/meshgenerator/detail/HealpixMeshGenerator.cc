@@ -33,6 +33,7 @@
 #include "atlas/meshgenerator/detail/HealpixMeshGenerator.h"
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -73,6 +74,11 @@ HealpixMeshGenerator::HealpixMeshGenerator(const eckit::Parametrisation& p) {
     }
     options.set("pole_elements", pole_elements);
 
+    std::string reorder;
+    if (p.get("reorder", reorder)) {
+        options.set("reorder", reorder);
+    }
+
     std::string partitioner;
     if (p.get("partitioner", partitioner)) {
         if (not grid::Partitioner::exists(partitioner)) {
@@ -510,6 +516,10 @@ void HealpixMeshGenerator::generate(const Grid& grid, const grid::Distribution&
     setGrid(mesh, grid, distribution);
 
     generate_mesh(grid, distribution, mesh);
+
+    std::string reorder_type;
+    options.get("reorder", reorder_type);
+    reorder(mesh, reorder_type, grid, distribution);
 }
 
 void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid::Distribution& distribution,
@@ -547,7 +557,6 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     ATLAS_ASSERT(HealpixGrid(grid));
 
     const int mypart                = options.get<size_t>("part");
-    const int nparts                = options.get<size_t>("nb_parts");
     const bool three_dimensional    = options.get<bool>("3d");
     const std::string pole_elements = options.get<std::string>("pole_elements");
     const int nb_pole_nodes         = (pole_elements == "pentagons") ? 4 : (three_dimensional ? 1 : 8);
@@ -560,19 +569,13 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     nb_points_     = 12 * ns * ns + (nb_pole_nodes == 8 ? 8 : 0);
     nb_nodes_      = nvertices;
 
-    int inode;
     auto nb_lat_nodes = [ny, nb_pole_nodes, &grid](int latid) {
         return ((latid == 0) or (latid == ny - 1) ? nb_pole_nodes : grid.nx()[latid - 1]);
     };
 
-    int ii, ix, iy, ii_ghost, ii_glb;
     int iy_min, iy_max;   // a belt (iy_min:iy_max) surrounding the nodes on this processor
     int nnodes_nonghost;  // non-ghost node: belongs to this part
 
-    // vector of local indices: necessary for remote indices of ghost nodes
-    std::vector<int> local_idx(nvertices, -1);
-    std::vector<int> current_idx(nparts, 0);  // index counter for each proc
-
     // ANSATZ: requirement on the partitioner
     auto compute_part = [&](int iy, gidx_t ii_glb) -> int {
         // nodes at the pole belong to proc_0 (north) and proc_maxRank (south)
@@ -581,9 +584,9 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     };
 
 #if DEBUG_OUTPUT_DETAIL
-    for (iy = 0; iy < ny; iy++) {
+    for (int iy = 0; iy < ny; iy++) {
         int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
+        for (int ix = 0; ix < nx; ix++) {
             Log::info() << "iy, ix, glb_idx, up_idx, down_idx, right_idx, pent_right_idx : " << iy << ", " << ix << ", "
                         << idx_xy_to_x(ix, iy, ns) + 1 << ", " << up_idx(ix, iy, ns) + 1 << ", "
                         << down_idx(ix, iy, ns) + 1 << ", " << right_idx(ix, iy, ns) + 1 << ", "
@@ -593,45 +596,58 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     }
 #endif
 
-    // loop over all points to determine local indices and surrounding rectangle
-    ii_glb          = 0;  // global index starting from 0
+    // Loop over the points of the rows that may contain points of this part, to determine the surrounding
+    // rectangle. These are the rows enclosing the range of global indices of this part, and the pole rows,
+    // whose nodes belong to the first and last part.
+    std::vector<gidx_t> row_offset(ny + 1, 0);
+    for (int iy = 0; iy < ny; iy++) {
+        row_offset[iy + 1] = row_offset[iy] + nb_lat_nodes(iy);
+    }
+    int iy_begin = ny;
+    int iy_end   = 0;
+    {
+        const auto range = distribution.index_range(mypart);
+        if (range.first < range.second) {
+            auto row = [&row_offset](gidx_t ii_glb) -> int {
+                return std::upper_bound(row_offset.begin(), row_offset.end(), ii_glb) - row_offset.begin() - 1;
+            };
+            iy_begin = row(range.first + nb_pole_nodes);
+            iy_end   = row(range.second - 1 + nb_pole_nodes) + 1;
+        }
+        if (mypart == 0) {
+            iy_begin = 0;
+            iy_end   = std::max(iy_end, 1);
+        }
+        if (mypart == static_cast<int>(mpi::comm().size()) - 1) {
+            iy_begin = std::min(iy_begin, ny - 1);
+            iy_end   = ny;
+        }
+    }
+
     iy_min          = ny + 1;
     iy_max          = 0;
     nnodes_nonghost = 0;
-    for (iy = 0; iy < ny; iy++) {
-        int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
-            int proc_id       = compute_part(iy, ii_glb);
-            local_idx[ii_glb] = current_idx[proc_id]++;
-            if (proc_id == mypart) {
-                ++nnodes_nonghost;
-                iy_min = std::min(iy_min, iy);
-                iy_max = std::max(iy_max, iy);
+    atlas_omp_parallel {
+        int thread_iy_min          = ny + 1;
+        int thread_iy_max          = 0;
+        int thread_nnodes_nonghost = 0;
+        atlas_omp_for(int iy = iy_begin; iy < iy_end; iy++) {
+            const int nx        = nb_lat_nodes(iy);
+            const gidx_t ii_glb = row_offset[iy];
+            for (int ix = 0; ix < nx; ix++) {
+                if (compute_part(iy, ii_glb + ix) == mypart) {
+                    ++thread_nnodes_nonghost;
+                    thread_iy_min = std::min(thread_iy_min, iy);
+                    thread_iy_max = std::max(thread_iy_max, iy);
+                }
             }
-            ++ii_glb;
         }
-    }
-
-#if DEBUG_OUTPUT_DETAIL
-    inode = 0;
-    Log::info() << "local_idx : " << std::endl;
-    for (size_t ilat = 0; ilat < ny; ilat++) {
-        for (size_t ilon = 0; ilon < nb_lat_nodes(ilat); ilon++) {
-            Log::info() << std::setw(4) << local_idx[inode];
-            inode++;
+        atlas_omp_critical {
+            nnodes_nonghost += thread_nnodes_nonghost;
+            iy_min = std::min(iy_min, thread_iy_min);
+            iy_max = std::max(iy_max, thread_iy_max);
         }
-        Log::info() << std::endl;
-    }
-    inode = 0;
-    Log::info() << "global_idx : " << std::endl;
-    for (size_t ilat = 0; ilat < ny; ilat++) {
-        for (size_t ilon = 0; ilon < nb_lat_nodes(ilat); ilon++) {
-            Log::info() << std::setw(4) << inode;
-            inode++;
-        }
-        Log::info() << std::endl;
     }
-#endif
 
     // dimensions of surrounding belt (SB)
     int nnodes_SB = 0;
@@ -657,51 +673,50 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
 #endif
 
     // partitions and local indices in SB
+    // (is_ghost_SB is not a std::vector<bool>, so that rows can be filled concurrently)
     std::vector<int> parts_SB(nnodes_SB, -1);
     std::vector<int> local_idx_SB(nnodes_SB, -1);
-    std::vector<bool> is_ghost_SB(nnodes_SB, true);
+    std::vector<char> is_ghost_SB(nnodes_SB, true);
 
     // starting from index 0, first global node-index for this partition
     int parts_sidx = idx_xy_to_x(0, iy_min, ns);
 
-    ii       = 0;                                  // index inside SB
-    ii_ghost = nnodes_SB - (iy_max - iy_min + 1);  // first local ghost idx
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy) + 1;
-        for (ix = 0; ix < nx; ix++) {
-            if (ix != nx - 1) {
-                ii_glb           = ii + parts_sidx;
-                parts_SB[ii]     = compute_part(iy, ii_glb);
-                local_idx_SB[ii] = ii;
-                is_ghost_SB[ii]  = !(parts_SB[ii] == mypart);
-                ++ii;
-            }
-            else {
-                parts_SB[ii_ghost]     = compute_part(iy, ii_glb);
-                local_idx_SB[ii_ghost] = ii_ghost;
-                is_ghost_SB[ii_ghost]  = true;
-                ++ii_ghost;
-            }
+    // Each row owns a contiguous range of SB indices, followed by its (east) periodic point among the
+    // ghosts at the end of SB, so that the rows can be processed independently.
+    const int nrows_SB       = iy_max - iy_min + 1;
+    const int ii_ghost_begin = nnodes_SB - nrows_SB;  // first local ghost idx
+    atlas_omp_parallel_for(int iy = iy_min; iy <= iy_max; iy++) {
+        const int nx = nb_lat_nodes(iy);
+        int ii       = static_cast<int>(row_offset[iy] - row_offset[iy_min]);  // index inside SB
+        for (int ix = 0; ix < nx; ix++, ii++) {
+            parts_SB[ii]     = compute_part(iy, ii + parts_sidx);
+            local_idx_SB[ii] = ii;
+            is_ghost_SB[ii]  = !(parts_SB[ii] == mypart);
         }
+        // the periodic point takes the partition of the last point of the row
+        const int ii_ghost     = ii_ghost_begin + iy - iy_min;
+        parts_SB[ii_ghost]     = compute_part(iy, ii - 1 + parts_sidx);
+        local_idx_SB[ii_ghost] = ii_ghost;
+        is_ghost_SB[ii_ghost]  = true;
     }
 
 #if DEBUG_OUTPUT_DETAIL
     Log::info() << "[" << mypart << "] : "
                 << "parts_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
+    for (int ii = 0; ii < nnodes_SB; ii++) {
         Log::info() << parts_SB[ii] << ",";
     }
     Log::info() << std::endl;
     Log::info() << "[" << mypart << "] : "
                 << "local_idx_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
+    for (int ii = 0; ii < nnodes_SB; ii++) {
         Log::info() << local_idx_SB[ii] << ",";
     }
     Log::info() << std::endl;
     Log::info() << "[" << mypart << "] : "
                 << "is_ghost_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
-        Log::info() << is_ghost_SB[ii] << ",";
+    for (int ii = 0; ii < nnodes_SB; ii++) {
+        Log::info() << static_cast<int>(is_ghost_SB[ii]) << ",";
     }
     Log::info() << std::endl;
 #endif
@@ -713,16 +728,16 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     int nnodes = 0;
     int nquads = 0;
     int npents = 0;
-    ii         = 0;
+    int ii     = 0;
 
     int glb2loc_ghost_offset = -nnodes_SB + iy_max + nb_nodes_ + 1;
     auto get_local_id        = [this, &parts_sidx, &glb2loc_ghost_offset](gidx_t gidx) {
         return gidx - (gidx < nb_nodes_ ? parts_sidx : glb2loc_ghost_offset);
     };
 
-    for (iy = iy_min; iy <= iy_max; iy++) {
+    for (int iy = iy_min; iy <= iy_max; iy++) {
         int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
+        for (int ix = 0; ix < nx; ix++) {
             if (not is_ghost_SB[ii]) {
                 const bool at_pole      = (iy == 0 or iy == ny - 1);
                 bool not_duplicate_cell = (at_pole ? (ix % 2) : 1);
@@ -812,23 +827,61 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     auto cells_glb_idx      = array::make_view<gidx_t, 1>(mesh.cells().global_index());
     auto& node_connectivity = mesh.cells().node_connectivity();
 
-    idx_t cell_nodes[5];
-    int jquadcell = quad_begin;
-    int jpentcell = pent_begin;
+    // Count per row the nodes of this part, and the cells it owns, so that rows can be filled in parallel
+    // with the same local indices as in a row-by-row traversal.
+    auto get_SB_idx = [&](int ix, int iy) -> int { return static_cast<int>(get_local_id(idx_xy_to_x(ix, iy, ns))); };
+    auto is_pentagon_row = [&](int iy) { return (iy == 1 or iy == 4 * ns - 1) and pole_elements == "pentagons"; };
+    auto owns_cell       = [&](int ix, int iy) -> bool {
+        const bool at_pole = (iy == 0 or iy == ny - 1);
+        if (at_pole and (ix % 2 == 0 or nb_pole_nodes < 8)) {
+            // if nb_pole_nodes = 4 : the pole nodes do not own any pentagons
+            // if nb_pole_nodes = 1 : the pole nodes do not own any quads
+            return false;
+        }
+        return not is_ghost_SB[get_SB_idx(ix, iy)];
+    };
+    // cells that shift the global cell indexing, due to extra points at the north pole
+    auto offsets_cells = [&](int iy) {
+        return (nb_pole_nodes == 8 and (iy == 0 or iy == ny - 1)) or (nb_pole_nodes == 4 and is_pentagon_row(iy));
+    };
 
-    int inode_nonghost, inode_ghost;
+    std::vector<int> row_nonghost(nrows_SB + 1, 0);
+    std::vector<int> row_ghost(nrows_SB + 1, 0);
+    std::vector<int> row_quads(nrows_SB + 1, 0);
+    std::vector<int> row_pents(nrows_SB + 1, 0);
+    std::vector<int> row_cell_offset(nrows_SB + 1, 0);
+    atlas_omp_parallel_for(int iy = iy_min; iy <= iy_max; iy++) {
+        const int jrow = iy - iy_min + 1;
+        const int nx   = nb_lat_nodes(iy) + 1;
+        for (int ix = 0; ix < nx; ix++) {
+            const int iil = get_SB_idx(ix, iy);
+            if (is_node_SB[iil]) {
+                ++(is_ghost_SB[iil] ? row_ghost : row_nonghost)[jrow];
+            }
+            if (owns_cell(ix, iy)) {
+                ++(is_pentagon_row(iy) ? row_pents : row_quads)[jrow];
+                if (offsets_cells(iy)) {
+                    ++row_cell_offset[jrow];
+                }
+            }
+        }
+    }
+    for (auto* row_count : {&row_nonghost, &row_ghost, &row_quads, &row_pents, &row_cell_offset}) {
+        std::partial_sum(row_count->begin(), row_count->end(), row_count->begin());
+    }
+    ATLAS_ASSERT(row_quads.back() == nquads && row_pents.back() == npents);
 
     // loop over nodes and set properties
-    inode_nonghost = 0;
-    inode_ghost    = nnodes_nonghost;  // ghost nodes start counting after nonghost nodes
-    ii             = 0;                // index inside SB
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy) + 1;
-        for (ix = 0; ix < nx; ix++) {
-            int iil = idx_xy_to_x(ix, iy, ns);
-            iil -= (iil < nb_nodes_ ? parts_sidx : -nnodes_SB + iy_max + nb_nodes_ + 1);
+    atlas_omp_parallel_for(int iy = iy_min; iy <= iy_max; iy++) {
+        const int jrow     = iy - iy_min;
+        int inode_nonghost = row_nonghost[jrow];
+        int inode_ghost    = nnodes_nonghost + row_ghost[jrow];  // ghost nodes start counting after nonghost nodes
+        int nx             = nb_lat_nodes(iy) + 1;
+        for (int ix = 0; ix < nx; ix++) {
+            int iil = get_SB_idx(ix, iy);
             if (is_node_SB[iil]) {
                 // set node counter
+                int inode;
                 if (is_ghost_SB[iil]) {
                     inode = inode_ghost++;
                 }
@@ -922,111 +975,101 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
                             << "; glb_idx=" << glb_idx(inode) << "; loc_idx=" << local_idx_SB[iil] << std::endl;
 #endif
             }
-            ii += (ix != nx - 1 ? 1 : 0);
         }
     }
 
     auto get_local_idx_SB = [&local_idx_SB, &get_local_id](gidx_t gidx) { return local_idx_SB[get_local_id(gidx)]; };
 
-    ii               = 0;  // index inside SB (surrounding belt)
-    int jcell_offset = 0;  // global index offset due to extra points at the north pole
-    gidx_t jcell     = 0;  // global cell counter
-    gidx_t points_in_partition = 0;
-    for (iy = iy_min; iy <= iy_max; iy++) {
+    atlas_omp_parallel_for(int iy = iy_min; iy <= iy_max; iy++) {
+        const int jrow   = iy - iy_min;
+        int jquadcell    = quad_begin + row_quads[jrow];
+        int jpentcell    = pent_begin + row_pents[jrow];
+        int jcell_offset = row_cell_offset[jrow];  // global index offset due to extra points at the north pole
+        gidx_t jcell     = row_quads[jrow] + row_pents[jrow];  // global cell counter
+        gidx_t points_in_partition = row_offset[iy + 1] - row_offset[iy_min];
+        idx_t cell_nodes[5];
         int nx = nb_lat_nodes(iy) + 1;
-        points_in_partition += (nx - 1);
-        for (ix = 0; ix < nx; ix++) {
-            const bool at_pole     = (iy == 0 or iy == ny - 1);
-            int not_duplicate_cell = (at_pole ? ix % 2 : 1);
-            if (at_pole and (not not_duplicate_cell or nb_pole_nodes < 8)) {
-                // if nb_pole_nodes = 4 : the pole nodes do not own any pentagons
-                // if nb_pole_nodes = 1 : the pole nodes do not own any quads
+        for (int ix = 0; ix < nx; ix++) {
+            if (not owns_cell(ix, iy)) {
                 continue;
             }
-            bool pentagon = (iy == 1 or iy == 4 * ns - 1) and pole_elements == "pentagons";
-            int iil       = idx_xy_to_x(ix, iy, ns);
-            iil -= (iil < nb_nodes_ ? parts_sidx : -nnodes_SB + iy_max + nb_nodes_ + 1);
-            if (not is_ghost_SB[iil]) {
-                jcell++;  // a cell will be added
-                // define cell vertices (in local indices) in cell_nodes
-                int node_id           = 0;
-                cell_nodes[node_id++] = get_local_idx_SB(idx_xy_to_x(ix, iy, ns));
-                cell_nodes[node_id++] = get_local_idx_SB(down_idx(ix, iy, ns));
-                bool south_hemisphere = (iy > 2 * ns);
-                if (pentagon && not south_hemisphere) {
-                    cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
-                }
-                cell_nodes[node_id++] = get_local_idx_SB(right_idx(ix, iy, ns));
-                if (pentagon && south_hemisphere) {
-                    // in the south hemisphere the pentagon point comes in a different clock-wise ordering
-                    cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
-                }
-                cell_nodes[node_id++] = get_local_idx_SB(up_idx(ix, iy, ns));
+            bool pentagon = is_pentagon_row(iy);
+            int iil       = get_SB_idx(ix, iy);
+            jcell++;  // a cell will be added
+            // define cell vertices (in local indices) in cell_nodes
+            int node_id           = 0;
+            cell_nodes[node_id++] = get_local_idx_SB(idx_xy_to_x(ix, iy, ns));
+            cell_nodes[node_id++] = get_local_idx_SB(down_idx(ix, iy, ns));
+            bool south_hemisphere = (iy > 2 * ns);
+            if (pentagon && not south_hemisphere) {
+                cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
+            }
+            cell_nodes[node_id++] = get_local_idx_SB(right_idx(ix, iy, ns));
+            if (pentagon && south_hemisphere) {
+                // in the south hemisphere the pentagon point comes in a different clock-wise ordering
+                cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
+            }
+            cell_nodes[node_id++] = get_local_idx_SB(up_idx(ix, iy, ns));
 
-                // match global cell indexing for the three healpix versions
-                if (nb_pole_nodes == 1) {
-                    cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx + ix + 1;
-                }
-                else if (nb_pole_nodes == 8) {
-                    if (iy == 0) {
-                        cells_glb_idx(jquadcell) = 12 * ns * ns + 1 + ix / 2;
-                        jcell_offset++;
-                    }
-                    else if (iy == ny - 1) {
-                        cells_glb_idx(jquadcell) = 12 * ns * ns + 5 + ix / 2;
-                        jcell_offset++;
-                    }
-                    else {
-                        cells_glb_idx(jquadcell) = parts_sidx + iil - 3 - (mypart != 0 ? 4 : jcell_offset);
-                    }
-                }
-                else if (nb_pole_nodes == 4) {
-                    if (iy == 0 or iy == ny - 1) {
-                        continue;
-                    }
-                    if (pentagon) {
-                        cells_glb_idx(jpentcell) = (mypart != 0 ? 12 * ns * ns - 3 + ix : jcell);
-                        jcell_offset++;
-                    }
-                    else {
-                        cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx - 6 + ix + (mypart != 0 ? 4 : jcell_offset);
-                    }
+            // match global cell indexing for the three healpix versions
+            if (nb_pole_nodes == 1) {
+                cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx + ix + 1;
+            }
+            else if (nb_pole_nodes == 8) {
+                if (iy == 0) {
+                    cells_glb_idx(jquadcell) = 12 * ns * ns + 1 + ix / 2;
+                    jcell_offset++;
                 }
-#if DEBUG_OUTPUT_DETAIL
-                std::cout << "[" << mypart << "] : ";
-                if (pentagon) {
-                    std::cout << "New pent: loc-idx " << jpentcell << ", glb-idx " << cells_glb_idx(jpentcell) << ": ";
+                else if (iy == ny - 1) {
+                    cells_glb_idx(jquadcell) = 12 * ns * ns + 5 + ix / 2;
+                    jcell_offset++;
                 }
                 else {
-                    std::cout << "New quad: loc-idx " << jquadcell << ", glb-idx " << cells_glb_idx(jquadcell) << ": ";
+                    cells_glb_idx(jquadcell) = parts_sidx + iil - 3 - (mypart != 0 ? 4 : jcell_offset);
                 }
-                std::cout << glb_idx(cell_nodes[0]) << "," << glb_idx(cell_nodes[1]) << "," << glb_idx(cell_nodes[2])
-                          << "," << glb_idx(cell_nodes[3]);
-                if (pentagon) {
-                    std::cout << "," << glb_idx(cell_nodes[4]);
-                }
-                std::cout << std::endl;
-#endif
-                // add cell to the node connectivity table
+            }
+            else if (nb_pole_nodes == 4) {
                 if (pentagon) {
-                    cells_part(jpentcell) = mypart;
-                    node_connectivity.set(jpentcell, cell_nodes);
-                    ++jpentcell;
+                    cells_glb_idx(jpentcell) = (mypart != 0 ? 12 * ns * ns - 3 + ix : jcell);
+                    jcell_offset++;
                 }
                 else {
-                    cells_part(jquadcell) = mypart;
-                    node_connectivity.set(jquadcell, cell_nodes);
-                    ++jquadcell;
+                    cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx - 6 + ix + (mypart != 0 ? 4 : jcell_offset);
                 }
             }
-            ii += (ix != nx - 1 ? 1 : 0);
+#if DEBUG_OUTPUT_DETAIL
+            std::cout << "[" << mypart << "] : ";
+            if (pentagon) {
+                std::cout << "New pent: loc-idx " << jpentcell << ", glb-idx " << cells_glb_idx(jpentcell) << ": ";
+            }
+            else {
+                std::cout << "New quad: loc-idx " << jquadcell << ", glb-idx " << cells_glb_idx(jquadcell) << ": ";
+            }
+            std::cout << glb_idx(cell_nodes[0]) << "," << glb_idx(cell_nodes[1]) << "," << glb_idx(cell_nodes[2])
+                      << "," << glb_idx(cell_nodes[3]);
+            if (pentagon) {
+                std::cout << "," << glb_idx(cell_nodes[4]);
+            }
+            std::cout << std::endl;
+#endif
+            // add cell to the node connectivity table
+            if (pentagon) {
+                cells_part(jpentcell) = mypart;
+                node_connectivity.set(jpentcell, cell_nodes);
+                ++jpentcell;
+            }
+            else {
+                cells_part(jquadcell) = mypart;
+                node_connectivity.set(jquadcell, cell_nodes);
+                ++jquadcell;
+            }
         }
     }
 
 #if DEBUG_OUTPUT_DETAIL
     // list nodes
     Log::info() << "Listing nodes ...";
-    for (inode = 0; inode < nnodes; inode++) {
+    for (int inode = 0; inode < nnodes; inode++) {
         std::cout << "[" << mypart << "] : "
                   << " node " << inode << ": ghost = " << ghost(inode) << ", glb_idx = " << glb_idx(inode)
                   << ", part = " << part(inode) << ", lon = " << lonlat(inode, 0) << ", lat = " << lonlat(inode, 1)
@@ -8,7 +8,11 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "eckit/utils/Hash.h"
 
@@ -16,11 +20,19 @@
 #include "atlas/field/Field.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
+#include "atlas/grid/detail/partitioner/HilbertPartitioner.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/Reorder.h"
 #include "atlas/meshgenerator/MeshGenerator.h"
 #include "atlas/meshgenerator/detail/MeshGeneratorImpl.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/Point.h"
 
 using atlas::Mesh;
 
@@ -117,6 +129,82 @@ void MeshGeneratorImpl::setGrid(Mesh& mesh, const Grid& g, const std::string& d)
     mesh.metadata().set("distribution", d);
 }
 
+void MeshGeneratorImpl::reorder(Mesh& mesh, const std::string& type) const {
+    if (type == "none") {
+        return;
+    }
+    ATLAS_TRACE("MeshGenerator reorder");
+    ATLAS_ASSERT(mesh.edges().size() == 0, "Reordering during mesh generation must happen before edges are built");
+
+    mesh::actions::Reorder reorder{util::Config("type", type) | util::Config("ghost_at_end", true)};
+    apply_nodes_order(mesh, reorder.get()->computeNodesOrder(mesh));
+    mesh.metadata().set("reorder", type);
+}
+
+void MeshGeneratorImpl::reorder(Mesh& mesh, const std::string& reorder_type, const Grid& grid,
+                                const grid::Distribution& distribution) const {
+    if (not reorder_type.empty()) {
+        reorder(mesh, reorder_type);
+        return;
+    }
+    if (distribution.type() != grid::detail::partitioner::HilbertPartitioner::static_type()) {
+        return;
+    }
+    ATLAS_TRACE("MeshGenerator reorder along partitioner curve");
+    ATLAS_ASSERT(mesh.edges().size() == 0, "Reordering during mesh generation must happen before edges are built");
+
+    const auto ghost   = array::make_view<int, 1>(mesh.nodes().ghost());
+    const auto xy      = array::make_view<double, 2>(mesh.nodes().xy());
+    const auto lonlat  = array::make_view<double, 2>(mesh.nodes().lonlat());
+    const auto glb_idx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+    const idx_t size   = mesh.nodes().size();
+
+    std::vector<idx_t> owned;
+    std::vector<idx_t> ghosts;
+    owned.reserve(size);
+    for (idx_t n = 0; n < size; ++n) {
+        (ghost(n) ? ghosts : owned).push_back(n);
+    }
+
+    const idx_t nb_owned = static_cast<idx_t>(owned.size());
+    std::vector<PointXY> owned_xy(nb_owned);
+    std::vector<PointLonLat> owned_lonlat(nb_owned);
+    std::vector<gidx_t> owned_glb_idx(nb_owned);
+    for (idx_t j = 0; j < nb_owned; ++j) {
+        const idx_t n    = owned[j];
+        owned_xy[j]      = PointXY{xy(n, XX), xy(n, YY)};
+        owned_lonlat[j]  = PointLonLat{lonlat(n, LON), lonlat(n, LAT)};
+        owned_glb_idx[j] = glb_idx(n);
+    }
+
+    // Same curve, with default settings, as the partitioner: owned nodes are numbered in the order in which the
+    // curve was cut into partitions
+    auto curve = grid::detail::partitioner::HilbertPartitioner().order(grid, owned_xy, owned_lonlat, owned_glb_idx);
+
+    std::vector<idx_t> order;
+    order.reserve(size);
+    for (idx_t j : curve) {
+        order.push_back(owned[j]);
+    }
+    order.insert(order.end(), ghosts.begin(), ghosts.end());
+    apply_nodes_order(mesh, std::move(order));
+    mesh.metadata().set("reorder", distribution.type());
+}
+
+void MeshGeneratorImpl::apply_nodes_order(Mesh& mesh, std::vector<idx_t>&& order) const {
+    // Ghost nodes grouped by halo and owning partition, so that halo exchanges pack and unpack contiguous ranges
+    const auto ghost = array::make_view<int, 1>(mesh.nodes().ghost());
+    const auto halo  = array::make_view<int, 1>(mesh.nodes().halo());
+    const auto part  = array::make_view<int, 1>(mesh.nodes().partition());
+    auto group       = [&](idx_t n) {
+        return ghost(n) ? std::make_tuple(1, halo(n), part(n)) : std::make_tuple(0, 0, 0);
+    };
+    std::stable_sort(order.begin(), order.end(), [&](idx_t a, idx_t b) { return group(a) < group(b); });
+
+    mesh::actions::ReorderImpl::reorderNodes(mesh, order);
+    mesh::actions::ReorderImpl::reorderCellsUsingNodes(mesh);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 }  // namespace meshgenerator
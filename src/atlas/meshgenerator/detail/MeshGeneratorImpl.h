@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include "atlas/library/config.h"
 #include "atlas/util/Object.h"
 
 namespace eckit {
@@ -62,6 +66,20 @@ protected:
     void setProjection(Mesh&, const Projection&) const;
     void setGrid(Mesh&, const Grid&, const grid::Distribution&) const;
     void setGrid(Mesh&, const Grid&, const std::string& distribution) const;
+
+    /// @brief Renumber nodes and cells of a generated mesh for memory locality
+    /// Nodes are ordered with the mesh::actions::Reorder of given type ("hilbert", "reverse_cuthill_mckee", ...).
+    /// Owned nodes come first, followed by ghost nodes grouped by halo and owning partition.
+    /// Cells are then ordered by their lowest node index, so that edges built later follow the same order.
+    void reorder(Mesh&, const std::string& type) const;
+
+    /// @brief Renumber nodes and cells of a generated mesh, with the "reorder" type if not empty.
+    /// Otherwise, when the distribution comes from the "hilbert" partitioner, owned nodes are numbered
+    /// along the partitioner's curve, so that partitioning and locality ordering share one curve.
+    void reorder(Mesh&, const std::string& type, const Grid&, const grid::Distribution&) const;
+
+private:
+    void apply_nodes_order(Mesh&, std::vector<idx_t>&& order) const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
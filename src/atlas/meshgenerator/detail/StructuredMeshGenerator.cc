@@ -35,6 +35,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/StructuredMeshGenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -53,6 +54,25 @@ static double to_rad = M_PI / 180.;
 static double to_deg = 180. * M_1_PI;
 }  // namespace
 
+namespace {
+// Elements generated for one row between latitudes latN and latS = latN + 1, and the range of
+// longitude indices they use on either latitude (-1 when unused)
+struct RowElements {
+    idx_t nb_elems{0};
+    idx_t nquads{0};
+    idx_t ntriags{0};
+    idx_t beginN{-1};
+    idx_t endN{-1};
+    idx_t beginS{-1};
+    idx_t endS{-1};
+};
+
+void extend_range(idx_t& begin, idx_t& end, idx_t b, idx_t e) {
+    begin = (begin == -1) ? b : std::min(begin, b);
+    end   = std::max(end, e);
+}
+}  // namespace
+
 struct Region {
     int north {-1};
     int south {-1};
@@ -126,6 +146,11 @@ StructuredMeshGenerator::StructuredMeshGenerator(const eckit::Parametrisation& p
         options.set("ghost_at_end", ghost_at_end);
     }
 
+    std::string reorder;
+    if (p.get("reorder", reorder)) {
+        options.set("reorder", reorder);
+    }
+
     std::string partitioner;
     if (p.get("partitioner", partitioner)) {
         if (not grid::Partitioner::exists(partitioner)) {
@@ -237,20 +262,6 @@ void StructuredMeshGenerator::generate(const Grid& grid, const grid::Distributio
 
     idx_t mypart = options.getInt("part");
 
-// show distribution
-#if DEBUG_OUTPUT
-    int inode                       = 0;
-    const atlas::vector<int>& parts = distribution;
-    Log::info() << "Partition : " << std::endl;
-    for (size_t ilat = 0; ilat < rg.ny(); ilat++) {
-        for (size_t ilon = 0; ilon < rg.nx(ilat); ilon++) {
-            Log::info() << std::setw(3) << distribution.partition(inode);
-            inode++;
-        }
-        Log::info() << std::endl;
-    }
-#endif
-
     // clone some grid properties
     setGrid(mesh, rg, distribution);
 
@@ -258,6 +269,10 @@ void StructuredMeshGenerator::generate(const Grid& grid, const grid::Distributio
     generate_region(rg, distribution, mypart, region);
 
     generate_mesh(rg, distribution, region, mesh);
+
+    std::string reorder_type;
+    options.get("reorder", reorder_type);
+    reorder(mesh, reorder_type, grid, distribution);
 }
 
 void StructuredMeshGenerator::generate_region(const StructuredGrid& rg, const grid::Distribution& distribution,
@@ -285,71 +300,21 @@ void StructuredMeshGenerator::generate_region(const StructuredGrid& rg, const gr
     }
     else {
         ATLAS_TRACE_SCOPE("compute bounds") {
-            // This part does not scale
-            /*
-Find min and max latitudes used by this part.
-*/
-
-            size_t num_threads = atlas_omp_get_max_threads();
-            if (num_threads == 1) {
-                int n = 0;
+            // Find min and max latitudes used by this part, from the range of global indices of this part,
+            // so that only points of this part and its surroundings are visited hereafter
+            const auto range = distribution.index_range(mypart);
+            if (range.first < range.second) {
+                std::vector<gidx_t> row_end(rg.ny());
+                gidx_t n = 0;
                 for (idx_t jlat = 0; jlat < rg.ny(); ++jlat) {
-                    for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon) {
-                        if (distribution.partition(n) == mypart) {
-                            lat_north = jlat;
-                            goto end_north;
-                        }
-                        ++n;
-                    }
-                }
-            end_north:;
-
-                n = rg.size() - 1;
-                for (idx_t jlat = rg.ny() - 1; jlat >= 0; --jlat) {
-                    for (idx_t jlon = rg.nx(jlat) - 1; jlon >= 0; --jlon) {
-                        if (distribution.partition(n) == mypart) {
-                            lat_south = jlat;
-                            goto end_south;
-                        }
-                        --n;
-                    }
-                }
-            end_south:;
-            }
-            else {
-                std::vector<idx_t> thread_reduce_lat_north(num_threads, std::numeric_limits<idx_t>::max());
-                std::vector<idx_t> thread_reduce_lat_south(num_threads, std::numeric_limits<idx_t>::min());
-
-                atlas_omp_parallel {
-                    const idx_t thread_num = atlas_omp_get_thread_num();
-                    const idx_t jbegin = static_cast<int>(size_t(thread_num) * size_t(rg.ny()) / size_t(num_threads));
-                    const idx_t jend = static_cast<int>(size_t(thread_num + 1) * size_t(rg.ny()) / size_t(num_threads));
-
-                    auto& thread_lat_north = thread_reduce_lat_north[thread_num];
-                    auto& thread_lat_south = thread_reduce_lat_south[thread_num];
-
-                    for (idx_t jlat = jbegin; jlat < jend && thread_lat_north > jend; ++jlat) {
-                        int n = rg.index(0, jlat);
-                        for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon, ++n) {
-                            if (distribution.partition(n) == mypart) {
-                                thread_lat_north = jlat;
-                                break;
-                            }
-                        }
-                    }
-
-                    for (idx_t jlat = jend - 1; jlat >= jbegin && thread_lat_south < jbegin; --jlat) {
-                        int n = rg.index(0, jlat);
-                        for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon, ++n) {
-                            if (distribution.partition(n) == mypart) {
-                                thread_lat_south = jlat;
-                                break;
-                            }
-                        }
-                    }
+                    n += rg.nx(jlat);
+                    row_end[jlat] = n;
                 }
-                lat_north = *std::min_element(thread_reduce_lat_north.begin(), thread_reduce_lat_north.end());
-                lat_south = *std::max_element(thread_reduce_lat_south.begin(), thread_reduce_lat_south.end());
+                auto row = [&row_end](gidx_t gidx) -> idx_t {
+                    return std::upper_bound(row_end.begin(), row_end.end(), gidx) - row_end.begin();
+                };
+                lat_north = row(range.first);
+                lat_south = row(range.second - 1);
             }
         }
     }
@@ -393,16 +358,16 @@ We need to connect to next region
     array::ArrayView<int, 3> elemview = array::make_view<int, 3>(*region.elems);
     elemview.assign(-1);
 
-    ATLAS_TRACE_SCOPE("generate elements") {
-        eckit::Channel blackhole;
-
-        eckit::ProgressTimer progress("Generating elements for " + std::to_string(lat_south - lat_north) + " rows",
-                                      lat_south - lat_north, " row", 5.,
-                                      lat_south - lat_north > 1280 ? Log::trace() : blackhole);
+    // Rows of elements are generated independently in parallel. Only the ranges of longitude indices used on
+    // each latitude, shared by two rows, are merged afterwards, in row order as they would be serially.
+    std::vector<RowElements> rows(lat_south - lat_north);
 
-        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat, ++progress) {
+    ATLAS_TRACE_SCOPE("generate elements") {
+        atlas_omp_parallel_for(idx_t jlat = lat_north; jlat < lat_south; ++jlat) {
             //    std::stringstream filename; filename << "/tmp/debug/"<<jlat;
 
+            RowElements& row = rows[jlat - lat_north];
+
             idx_t ilat, latN, latS;
             idx_t ipN1, ipN2, ipS1, ipS2;
             double xN1, xN2, yN, xS1, xS2, yS;
@@ -410,7 +375,7 @@ We need to connect to next region
             bool try_make_triangle_up, try_make_triangle_down, try_make_quad;
             bool add_triag, add_quad;
 
-            ilat = jlat - region.north;
+            ilat = jlat - lat_north;
 
             auto lat_elems_view = elemview.slice(ilat, Range::all(), Range::all());
 
@@ -654,20 +619,10 @@ We need to connect to next region
                     }
                     add_quad = (pE == mypart);
                     if (add_quad) {
-                        ++region.nquads;
+                        ++row.nquads;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS2);
+                        extend_range(row.beginN, row.endN, ipN1, ipN2);
+                        extend_range(row.beginS, row.endS, ipS1, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -696,20 +651,10 @@ We need to connect to next region
                     add_triag = (mypart == pE);
 
                     if (add_triag) {
-                        ++region.ntriags;
+                        ++row.ntriags;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS1);
+                        extend_range(row.beginN, row.endN, ipN1, ipN2);
+                        extend_range(row.beginS, row.endS, ipS1, ipS1);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -750,20 +695,10 @@ We need to connect to next region
                     add_triag = (mypart == pE);
 
                     if (add_triag) {
-                        ++region.ntriags;
+                        ++row.ntriags;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max(region.lat_end.at(latN), ipN1);
-                        region.lat_end.at(latS)   = std::max(region.lat_end.at(latS), ipS2);
+                        extend_range(row.beginN, row.endN, ipN1, ipN1);
+                        extend_range(row.beginS, row.endS, ipS1, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -779,7 +714,36 @@ We need to connect to next region
                 ipN2 = std::min(endN, ipN1 + 1);
                 ipS2 = std::min(endS, ipS1 + 1);
             }
-            region.nb_lat_elems.at(jlat) = jelem;
+            row.nb_elems = jelem;
+        }  // for jlat
+    }
+
+    ATLAS_TRACE_SCOPE("merge rows") {
+        eckit::Channel blackhole;
+
+        eckit::ProgressTimer progress("Merging elements of " + std::to_string(lat_south - lat_north) + " rows",
+                                      lat_south - lat_north, " row", 5.,
+                                      lat_south - lat_north > 1280 ? Log::trace() : blackhole);
+
+        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat, ++progress) {
+            const RowElements& row = rows[jlat - lat_north];
+
+            const idx_t latN = jlat;
+            const idx_t latS = jlat + 1;
+            const double yN  = rg.y(latN);
+            const double yS  = rg.y(latS);
+
+            if (row.beginN != -1) {
+                extend_range(region.lat_begin.at(latN), region.lat_end.at(latN), row.beginN, row.endN);
+            }
+            if (row.beginS != -1) {
+                extend_range(region.lat_begin.at(latS), region.lat_end.at(latS), row.beginS, row.endS);
+            }
+            region.nquads += row.nquads;
+            region.ntriags += row.ntriags;
+            nelems += row.nb_elems;
+
+            region.nb_lat_elems.at(jlat) = row.nb_elems;
 #if DEBUG_OUTPUT
             ATLAS_DEBUG_VAR(region.nb_lat_elems.at(jlat));
 #endif
@@ -805,6 +769,19 @@ We need to connect to next region
                 region.lat_end.at(latS) = std::max(region.lat_end.at(latS), region.lat_begin.at(latS));
             }
         }  // for jlat
+
+        // Rows were stored relative to lat_north, whereas they are accessed relative to region.north,
+        // which has moved south past any leading rows without elements
+        const idx_t shift = region.north - lat_north;
+        if (shift > 0) {
+            for (idx_t jlat = region.north; jlat < lat_south; ++jlat) {
+                for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(jlat); ++jelem) {
+                    for (idx_t k = 0; k < 4; ++k) {
+                        elemview(jlat - region.north, jelem, k) = elemview(jlat - lat_north, jelem, k);
+                    }
+                }
+            }
+        }
     }
 
     //  Log::info()  << "nb_triags = " << region.ntriags << std::endl;
@@ -1071,18 +1048,27 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         }
     }
 
-    idx_t jnode = 0;
-    l           = 0;
+    // Offsets of rows in the local node numbering, so that rows can be filled in parallel
+    l = 0;
     for (idx_t jlat = region.north; jlat <= region.south; ++jlat) {
         idx_t ilat          = jlat - region.north;
         offset_loc.at(ilat) = l;
         l += region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1;
+        if (!include_periodic_ghost_points) {
+            // periodic points (jlon >= nx) are skipped
+            l -= std::max<idx_t>(0, region.lat_end.at(jlat) - std::max(region.lat_begin.at(jlat), rg.nx(jlat)) + 1);
+        }
+    }
+
+    atlas_omp_parallel_for(idx_t jlat = region.north; jlat <= region.south; ++jlat) {
+        idx_t ilat  = jlat - region.north;
+        idx_t jnode = offset_loc.at(ilat);
 
         double y = rg.y(jlat);
         for (idx_t jlon = region.lat_begin.at(jlat); jlon <= region.lat_end.at(jlat); ++jlon) {
             if (jlon < rg.nx(jlat)) {
                 idx_t inode = node_numbering.at(jnode);
-                n           = offset_glb.at(jlat) + jlon;
+                idx_t n     = offset_glb.at(jlat) + jlon;
 
                 double x = rg.x(jlon, jlat);
                 // std::cout << "jlat = " << jlat << "; jlon = " << jlon << "; x = " <<
@@ -1091,12 +1077,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 xy(inode, XX) = x;
                 xy(inode, YY) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat(crd);
-                lonlat(inode, LON) = crd[LON];
-                lonlat(inode, LAT) = crd[LAT];
-
                 glb_idx(inode) = n + 1;
                 part(inode)    = distribution.partition(n);
                 ghost(inode)   = 0;
@@ -1137,12 +1117,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 xy(inode, XX) = x;
                 xy(inode, YY) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat(crd);
-                lonlat(inode, LON) = crd[LON];
-                lonlat(inode, LAT) = crd[LAT];
-
                 glb_idx(inode) = periodic_glb.at(jlat) + 1;
                 //#warning TODO: use commented approach
                 //        part(inode)      = parts.at( offset_glb.at(jlat) );
@@ -1170,11 +1144,9 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 }
                 ++jnode;
             }
-            else {
-                --l;
-            }
         }
     }
+    idx_t jnode = l;
 
     if (include_north_pole) {
         idx_t inode   = node_numbering.at(jnode);
@@ -1184,12 +1156,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         xy(inode, XX) = x;
         xy(inode, YY) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat(crd);
-        lonlat(inode, LON) = crd[LON];
-        lonlat(inode, LAT) = crd[LAT];
-
         glb_idx(inode) = periodic_glb.at(rg.ny() - 1) + 2;
         part(inode)    = mypart;
         ghost(inode)   = 0;
@@ -1207,12 +1173,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         xy(inode, XX) = x;
         xy(inode, YY) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat(crd);
-        lonlat(inode, LON) = crd[LON];
-        lonlat(inode, LAT) = crd[LAT];
-
         glb_idx(inode) = periodic_glb.at(rg.ny() - 1) + 3;
         part(inode)    = mypart;
         ghost(inode)   = 0;
@@ -1221,6 +1181,19 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         Topology::set(flags(inode), Topology::SOUTH);
         ++jnode;
     }
+
+    // geographic coordinates by using projection, converted in a single batch
+    if (xy.contiguous() && lonlat.contiguous()) {
+        rg.projection().xy2lonlat(xy.data(), lonlat.data(), nnodes);
+    }
+    else {
+        for (idx_t inode = 0; inode < nnodes; ++inode) {
+            double crd[] = {xy(inode, XX), xy(inode, YY)};
+            rg.projection().xy2lonlat(crd);
+            lonlat(inode, LON) = crd[LON];
+            lonlat(inode, LAT) = crd[LAT];
+        }
+    }
     }
 
     mesh.metadata().set<size_t>("nb_nodes_including_halo[0]", nodes.size());
@@ -1279,14 +1252,39 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
     }
 
     if ((region.nquads + region.ntriags) > 0) {
-    for (idx_t jlat = region.north; jlat < region.south; ++jlat) {
-        idx_t ilat  = jlat - region.north;
-        idx_t jlatN = jlat;
-        idx_t jlatS = jlat + 1;
-        idx_t ilatN = ilat;
-        idx_t ilatS = ilat + 1;
+    const auto elems = array::make_view<int, 3>(*region.elems);
+
+    // Offsets of rows in quadrilaterals and triangles, so that rows can be filled in parallel
+    const idx_t nb_rows = std::max<idx_t>(0, region.south - region.north);
+    std::vector<idx_t> row_quads(nb_rows + 1, 0);
+    std::vector<idx_t> row_triags(nb_rows + 1, 0);
+    atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+        const idx_t nb_elems = region.nb_lat_elems.at(region.north + ilat);
+        for (idx_t jelem = 0; jelem < nb_elems; ++jelem) {
+            if (elems(ilat, jelem, 2) >= 0 && elems(ilat, jelem, 3) >= 0) {
+                ++row_quads[ilat + 1];
+            }
+            else {
+                ++row_triags[ilat + 1];
+            }
+        }
+    }
+    std::partial_sum(row_quads.begin(), row_quads.end(), row_quads.begin());
+    std::partial_sum(row_triags.begin(), row_triags.end(), row_triags.begin());
+
+    atlas_omp_parallel_for(idx_t jlat = region.north; jlat < region.south; ++jlat) {
+        idx_t ilat   = jlat - region.north;
+        idx_t jlatN  = jlat;
+        idx_t jlatS  = jlat + 1;
+        idx_t ilatN  = ilat;
+        idx_t ilatS  = ilat + 1;
+        idx_t jquad  = row_quads[ilat];
+        idx_t jtriag = row_triags[ilat];
+        idx_t jcell;
+        idx_t quad_nodes[4];
+        idx_t triag_nodes[3];
         for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(jlat); ++jelem) {
-            const auto elem = array::make_view<int, 3>(*region.elems).slice(ilat, jelem, Range::all());
+            const auto elem = elems.slice(ilat, jelem, Range::all());
 
             if (elem(2) >= 0 && elem(3) >= 0)  // This is a quad
             {
@@ -1363,6 +1361,8 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
             }
         }
     }
+    jquad  = row_quads[nb_rows];
+    jtriag = row_triags[nb_rows];
 
     if (include_north_pole) {
         idx_t ilat = 0;
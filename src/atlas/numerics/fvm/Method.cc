@@ -93,8 +93,8 @@ void Method::setup() {
 
         // Compute sign
         {
-            const mesh::Connectivity& node_edge_connectivity           = nodes_.edge_connectivity();
-            const mesh::MultiBlockConnectivity& edge_node_connectivity = edges_.node_connectivity();
+            const mesh::Connectivity& node_edge_connectivity = nodes_.edge_connectivity();
+            const auto edge_node_connectivity                = edges_.node_connectivity().span();
             if (!nodes_.has_field("node2edge_sign")) {
                 nodes_.add(Field("node2edge_sign", array::make_datatype<double>(),
                                  array::make_shape(nnodes, node_edge_connectivity.maxcols())));
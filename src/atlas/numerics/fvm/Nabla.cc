@@ -8,9 +8,12 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <type_traits>
+
 #include "eckit/config/Parametrisation.h"
 
 #include "atlas/array/ArrayView.h"
+#include "atlas/array/ContiguousArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/Field.h"
 #include "atlas/mesh/HybridElements.h"
@@ -34,8 +37,22 @@ namespace fvm {
 
 namespace {
 static NablaBuilder<Nabla> __fvm_nabla("fvm");
+
+// Fields of shape (nodes, [levels,] [components]) with contiguous values are accessed through a ContiguousArrayView
+// of shape (nodes, levels[, components]), so that the strides of the level loops are known at compile time
+bool contiguous(const Field& field) {
+    return field.array().contiguous() && field.stride(field.rank() - 1) == 1;
 }
 
+template <typename Value, int Rank, idx_t InnerExtent = array::dynamic_extent>
+array::ContiguousArrayView<Value, Rank, InnerExtent> contiguous_view(const Field& field, idx_t nlev) {
+    using NonConstValue = typename std::remove_const<Value>::type;
+    const idx_t shape[] = {field.shape(0), nlev, field.shape(field.rank() - 1)};
+    return array::ContiguousArrayView<Value, Rank, InnerExtent>(
+        const_cast<NonConstValue*>(field.array().host_data<NonConstValue>()), shape);
+}
+}  // namespace
+
 Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): atlas::numerics::NablaImpl(method, p) {
     fvm_ = dynamic_cast<const fvm::Method*>(&method);
     if (!fvm_) {
@@ -121,50 +138,61 @@ void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) con
     const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
     const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
 
-    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
-    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+    const mesh::Connectivity& node2edge = nodes.edge_connectivity();
+    const auto edge2node                = edges.node_connectivity().span();
 
     array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    auto avgS = array::make_view<double, 3>(avgS_arr);
+    auto avgS = array::make_contiguous_view<double, 3, 2>(avgS_arr);
 
     const double scale = deg2rad * deg2rad * radius;
 
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
+    auto compute = [&](const auto& scalar, auto& grad) {
+        atlas_omp_parallel {
+            atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
+                idx_t ip1 = edge2node(jedge, 0);
+                idx_t ip2 = edge2node(jedge, 1);
 
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double avg             = (scalar(ip1, jlev) + scalar(ip2, jlev)) * 0.5;
-                avgS(jedge, jlev, LON) = dual_normals(jedge, LON) * deg2rad * avg;
-                avgS(jedge, jlev, LAT) = dual_normals(jedge, LAT) * deg2rad * avg;
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    double avg             = (scalar(ip1, jlev) + scalar(ip2, jlev)) * 0.5;
+                    avgS(jedge, jlev, LON) = dual_normals(jedge, LON) * deg2rad * avg;
+                    avgS(jedge, jlev, LAT) = dual_normals(jedge, LAT) * deg2rad * avg;
+                }
             }
-        }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LON) = 0.;
-                grad(jnode, jlev, LAT) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                const idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    const double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        grad(jnode, jlev, LON) += add * avgS(iedge, jlev, LON);
-                        grad(jnode, jlev, LAT) += add * avgS(iedge, jlev, LAT);
+            atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    grad(jnode, jlev, LON) = 0.;
+                    grad(jnode, jlev, LAT) = 0.;
+                }
+                for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+                    const idx_t iedge = node2edge(jnode, jedge);
+                    if (iedge < nedges) {
+                        const double add = node2edge_sign(jnode, jedge);
+                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                            grad(jnode, jlev, LON) += add * avgS(iedge, jlev, LON);
+                            grad(jnode, jlev, LAT) += add * avgS(iedge, jlev, LAT);
+                        }
                     }
                 }
-            }
 
-            const double y        = lonlat_deg(jnode, LAT) * deg2rad;
-            const double metric_y = 1. / (dual_volumes(jnode) * scale);
-            const double metric_x = metric_y / std::cos(y);
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LON) *= metric_x;
-                grad(jnode, jlev, LAT) *= metric_y;
+                const double y        = lonlat_deg(jnode, LAT) * deg2rad;
+                const double metric_y = 1. / (dual_volumes(jnode) * scale);
+                const double metric_x = metric_y / std::cos(y);
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    grad(jnode, jlev, LON) *= metric_x;
+                    grad(jnode, jlev, LAT) *= metric_y;
+                }
             }
         }
+    };
+
+    if (contiguous(scalar_field) && contiguous(grad_field) && grad_field.shape(grad_field.rank() - 1) == 2) {
+        const auto scalar_c = contiguous_view<const double, 2>(scalar_field, nlev);
+        auto grad_c         = contiguous_view<double, 3, 2>(grad_field, nlev);
+        compute(scalar_c, grad_c);
+    }
+    else {
+        compute(scalar, grad);
     }
 }
 
@@ -201,11 +229,11 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
     const auto edge_flags     = array::make_view<int, 1>(edges.flags());
     auto is_pole_edge         = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
-    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
-    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+    const mesh::Connectivity& node2edge = nodes.edge_connectivity();
+    const auto edge2node                = edges.node_connectivity().span();
 
     array::ArrayT<double> avgS_arr(nedges, nlev, 4ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
+    auto avgS = array::make_contiguous_view<double, 3, 4>(avgS_arr);
 
     const double scale = deg2rad * deg2rad * radius;
 
@@ -217,63 +245,74 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
         LATdLAT = 3
     };
 
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1  = edge2node(jedge, 0);
-            idx_t ip2  = edge2node(jedge, 1);
-            double pbc = 1. - 2. * is_pole_edge(jedge);
-
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double avg[2]              = {(vector(ip1, jlev, LON) + pbc * vector(ip2, jlev, LON)) * 0.5,
-                                 (vector(ip1, jlev, LAT) + pbc * vector(ip2, jlev, LAT)) * 0.5};
-                avgS(jedge, jlev, LONdLON) = dual_normals(jedge, LON) * deg2rad * avg[LON];
-                // above = 0 at pole because of dual_normals
-                avgS(jedge, jlev, LONdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LON];
-                avgS(jedge, jlev, LATdLON) = dual_normals(jedge, LON) * deg2rad * avg[LAT];
-                // above = 0 at pole because of dual_normals
-                avgS(jedge, jlev, LATdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LAT];
+    auto compute = [&](const auto& vector, auto& grad) {
+        atlas_omp_parallel {
+            atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
+                idx_t ip1  = edge2node(jedge, 0);
+                idx_t ip2  = edge2node(jedge, 1);
+                double pbc = 1. - 2. * is_pole_edge(jedge);
+
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    double avg[2]              = {(vector(ip1, jlev, LON) + pbc * vector(ip2, jlev, LON)) * 0.5,
+                                     (vector(ip1, jlev, LAT) + pbc * vector(ip2, jlev, LAT)) * 0.5};
+                    avgS(jedge, jlev, LONdLON) = dual_normals(jedge, LON) * deg2rad * avg[LON];
+                    // above = 0 at pole because of dual_normals
+                    avgS(jedge, jlev, LONdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LON];
+                    avgS(jedge, jlev, LATdLON) = dual_normals(jedge, LON) * deg2rad * avg[LAT];
+                    // above = 0 at pole because of dual_normals
+                    avgS(jedge, jlev, LATdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LAT];
+                }
             }
-        }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LONdLON) = 0.;
-                grad(jnode, jlev, LONdLAT) = 0.;
-                grad(jnode, jlev, LATdLON) = 0.;
-                grad(jnode, jlev, LATdLAT) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                const idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        grad(jnode, jlev, LONdLON) += add * avgS(iedge, jlev, LONdLON);
-                        grad(jnode, jlev, LONdLAT) += add * avgS(iedge, jlev, LONdLAT);
-                        grad(jnode, jlev, LATdLON) += add * avgS(iedge, jlev, LATdLON);
-                        grad(jnode, jlev, LATdLAT) += add * avgS(iedge, jlev, LATdLAT);
+            atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    grad(jnode, jlev, LONdLON) = 0.;
+                    grad(jnode, jlev, LONdLAT) = 0.;
+                    grad(jnode, jlev, LATdLON) = 0.;
+                    grad(jnode, jlev, LATdLAT) = 0.;
+                }
+                for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+                    const idx_t iedge = node2edge(jnode, jedge);
+                    if (iedge < nedges) {
+                        double add = node2edge_sign(jnode, jedge);
+                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                            grad(jnode, jlev, LONdLON) += add * avgS(iedge, jlev, LONdLON);
+                            grad(jnode, jlev, LONdLAT) += add * avgS(iedge, jlev, LONdLAT);
+                            grad(jnode, jlev, LATdLON) += add * avgS(iedge, jlev, LATdLON);
+                            grad(jnode, jlev, LATdLAT) += add * avgS(iedge, jlev, LATdLAT);
+                        }
                     }
                 }
+                const double y        = lonlat_deg(jnode, LAT) * deg2rad;
+                const double metric_y = 1. / (dual_volumes(jnode) * scale);
+                const double metric_x = metric_y / std::cos(y);
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    grad(jnode, jlev, LONdLON) *= metric_x;
+                    grad(jnode, jlev, LATdLON) *= metric_x;
+                    grad(jnode, jlev, LONdLAT) *= metric_y;
+                    grad(jnode, jlev, LATdLAT) *= metric_y;
+                }
             }
-            const double y        = lonlat_deg(jnode, LAT) * deg2rad;
+        }
+        // Fix wrong node2edge_sign for vector quantities
+        for (size_t jedge = 0; jedge < pole_edges_.size(); ++jedge) {
+            const idx_t iedge     = pole_edges_[jedge];
+            const idx_t jnode     = edge2node(iedge, 1);
             const double metric_y = 1. / (dual_volumes(jnode) * scale);
-            const double metric_x = metric_y / std::cos(y);
             for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LONdLON) *= metric_x;
-                grad(jnode, jlev, LATdLON) *= metric_x;
-                grad(jnode, jlev, LONdLAT) *= metric_y;
-                grad(jnode, jlev, LATdLAT) *= metric_y;
+                grad(jnode, jlev, LONdLAT) -= 2. * avgS(iedge, jlev, LONdLAT) * metric_y;
+                grad(jnode, jlev, LATdLAT) -= 2. * avgS(iedge, jlev, LATdLAT) * metric_y;
             }
         }
+    };
+
+    if (contiguous(vector_field) && contiguous(grad_field) && grad_field.shape(grad_field.rank() - 1) == 4) {
+        const auto vector_c = contiguous_view<const double, 3>(vector_field, nlev);
+        auto grad_c         = contiguous_view<double, 3, 4>(grad_field, nlev);
+        compute(vector_c, grad_c);
     }
-    // Fix wrong node2edge_sign for vector quantities
-    for (size_t jedge = 0; jedge < pole_edges_.size(); ++jedge) {
-        const idx_t iedge     = pole_edges_[jedge];
-        const idx_t jnode     = edge2node(iedge, 1);
-        const double metric_y = 1. / (dual_volumes(jnode) * scale);
-        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-            grad(jnode, jlev, LONdLAT) -= 2. * avgS(iedge, jlev, LONdLAT) * metric_y;
-            grad(jnode, jlev, LATdLAT) -= 2. * avgS(iedge, jlev, LATdLAT) * metric_y;
-        }
+    else {
+        compute(vector, grad);
     }
 }
 
@@ -308,11 +347,11 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
     const auto edge_flags     = array::make_view<int, 1>(edges.flags());
     auto is_pole_edge         = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
-    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
-    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+    const mesh::Connectivity& node2edge = nodes.edge_connectivity();
+    const auto edge2node                = edges.node_connectivity().span();
 
     array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
+    auto avgS = array::make_contiguous_view<double, 3, 2>(avgS_arr);
 
     const double scale = deg2rad * deg2rad * radius;
 
@@ -321,60 +360,71 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
         LONdLON = 0,
         LATdLAT = 1
     };
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            double pbc = 1 - is_pole_edge(jedge);
-
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
-            double y1 = lonlat_deg(ip1, LAT) * deg2rad;
-            double y2 = lonlat_deg(ip2, LAT) * deg2rad;
-
-            double cosy1, cosy2;
-            if (metric_approach_ == 0) {
-                cosy1 = std::cos(y1) * pbc;
-                cosy2 = std::cos(y2) * pbc;
-            }
-            else {
-                cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
-            }
+    auto compute = [&](const auto& vector, auto& div) {
+        atlas_omp_parallel {
+            atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
+                double pbc = 1 - is_pole_edge(jedge);
+
+                idx_t ip1 = edge2node(jedge, 0);
+                idx_t ip2 = edge2node(jedge, 1);
+                double y1 = lonlat_deg(ip1, LAT) * deg2rad;
+                double y2 = lonlat_deg(ip2, LAT) * deg2rad;
+
+                double cosy1, cosy2;
+                if (metric_approach_ == 0) {
+                    cosy1 = std::cos(y1) * pbc;
+                    cosy2 = std::cos(y2) * pbc;
+                }
+                else {
+                    cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
+                }
 
-            double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
-            double avg[2];
+                double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
+                double avg[2];
 
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double u1 = vector(ip1, jlev, LON);
-                double u2 = vector(ip2, jlev, LON);
-                double v1 = vector(ip1, jlev, LAT) * cosy1;
-                double v2 = vector(ip2, jlev, LAT) * cosy2;
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    double u1 = vector(ip1, jlev, LON);
+                    double u2 = vector(ip2, jlev, LON);
+                    double v1 = vector(ip1, jlev, LAT) * cosy1;
+                    double v2 = vector(ip2, jlev, LAT) * cosy2;
 
-                avg[LON] = (u1 + u2) * 0.5;
-                avg[LAT] = (v1 + v2) * 0.5;
+                    avg[LON] = (u1 + u2) * 0.5;
+                    avg[LAT] = (v1 + v2) * 0.5;
 
-                avgS(jedge, jlev, LONdLON) = avg[LON] * S[LON];
-                avgS(jedge, jlev, LATdLAT) = avg[LAT] * S[LAT];
+                    avgS(jedge, jlev, LONdLON) = avg[LON] * S[LON];
+                    avgS(jedge, jlev, LATdLAT) = avg[LAT] * S[LAT];
+                }
             }
-        }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                div(jnode, jlev) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        div(jnode, jlev) += add * (avgS(iedge, jlev, LONdLON) + avgS(iedge, jlev, LATdLAT));
+            atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    div(jnode, jlev) = 0.;
+                }
+                for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+                    idx_t iedge = node2edge(jnode, jedge);
+                    if (iedge < nedges) {
+                        double add = node2edge_sign(jnode, jedge);
+                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                            div(jnode, jlev) += add * (avgS(iedge, jlev, LONdLON) + avgS(iedge, jlev, LATdLAT));
+                        }
                     }
                 }
-            }
-            const double y = lonlat_deg(jnode, LAT) * deg2rad;
-            double metric  = 1. / (dual_volumes(jnode) * scale * std::cos(y));
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                div(jnode, jlev) *= metric;
+                const double y = lonlat_deg(jnode, LAT) * deg2rad;
+                double metric  = 1. / (dual_volumes(jnode) * scale * std::cos(y));
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    div(jnode, jlev) *= metric;
+                }
             }
         }
+    };
+
+    if (contiguous(vector_field) && contiguous(div_field)) {
+        const auto vector_c = contiguous_view<const double, 3>(vector_field, nlev);
+        auto div_c          = contiguous_view<double, 2>(div_field, nlev);
+        compute(vector_c, div_c);
+    }
+    else {
+        compute(vector, div);
     }
 }
 
@@ -408,11 +458,11 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
     auto is_pole_edge         = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
 
-    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
-    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+    const mesh::Connectivity& node2edge = nodes.edge_connectivity();
+    const auto edge2node                = edges.node_connectivity().span();
 
     array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
+    auto avgS = array::make_contiguous_view<double, 3, 2>(avgS_arr);
 
     const double scale = deg2rad * deg2rad * radius;
 
@@ -423,60 +473,71 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
     };
 
 
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
-            double y1 = lonlat_deg(ip1, LAT) * deg2rad;
-            double y2 = lonlat_deg(ip2, LAT) * deg2rad;
-
-            double pbc = 1 - is_pole_edge(jedge);
-            double cosy1;
-            double cosy2;
-            if (metric_approach_ == 0) {
-                cosy1 = std::cos(y1) * pbc;
-                cosy2 = std::cos(y2) * pbc;
-            }
-            else {
-                cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
-            }
+    auto compute = [&](const auto& vector, auto& curl) {
+        atlas_omp_parallel {
+            atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
+                idx_t ip1 = edge2node(jedge, 0);
+                idx_t ip2 = edge2node(jedge, 1);
+                double y1 = lonlat_deg(ip1, LAT) * deg2rad;
+                double y2 = lonlat_deg(ip2, LAT) * deg2rad;
+
+                double pbc = 1 - is_pole_edge(jedge);
+                double cosy1;
+                double cosy2;
+                if (metric_approach_ == 0) {
+                    cosy1 = std::cos(y1) * pbc;
+                    cosy2 = std::cos(y2) * pbc;
+                }
+                else {
+                    cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
+                }
 
-            double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
-            double avg[2];
+                double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
+                double avg[2];
 
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double u1 = vector(ip1, jlev, LON) * cosy1;
-                double u2 = vector(ip2, jlev, LON) * cosy2;
-                double v1 = vector(ip1, jlev, LAT);
-                double v2 = vector(ip2, jlev, LAT);
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    double u1 = vector(ip1, jlev, LON) * cosy1;
+                    double u2 = vector(ip2, jlev, LON) * cosy2;
+                    double v1 = vector(ip1, jlev, LAT);
+                    double v2 = vector(ip2, jlev, LAT);
 
-                avg[LON] = (u1 + u2) * 0.5;
-                avg[LAT] = (v1 + v2) * 0.5;
+                    avg[LON] = (u1 + u2) * 0.5;
+                    avg[LAT] = (v1 + v2) * 0.5;
 
-                avgS(jedge, jlev, LONdLAT) = avg[LON] * S[LAT];
-                avgS(jedge, jlev, LATdLON) = avg[LAT] * S[LON];
+                    avgS(jedge, jlev, LONdLAT) = avg[LON] * S[LAT];
+                    avgS(jedge, jlev, LATdLON) = avg[LAT] * S[LON];
+                }
             }
-        }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                curl(jnode, jlev) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        curl(jnode, jlev) += add * (avgS(iedge, jlev, LATdLON) - avgS(iedge, jlev, LONdLAT));
+            atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    curl(jnode, jlev) = 0.;
+                }
+                for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+                    idx_t iedge = node2edge(jnode, jedge);
+                    if (iedge < nedges) {
+                        double add = node2edge_sign(jnode, jedge);
+                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                            curl(jnode, jlev) += add * (avgS(iedge, jlev, LATdLON) - avgS(iedge, jlev, LONdLAT));
+                        }
                     }
                 }
-            }
-            double y      = lonlat_deg(jnode, LAT) * deg2rad;
-            double metric = 1. / (dual_volumes(jnode) * scale * std::cos(y));
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                curl(jnode, jlev) *= metric;
+                double y      = lonlat_deg(jnode, LAT) * deg2rad;
+                double metric = 1. / (dual_volumes(jnode) * scale * std::cos(y));
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    curl(jnode, jlev) *= metric;
+                }
             }
         }
+    };
+
+    if (contiguous(vector_field) && contiguous(curl_field)) {
+        const auto vector_c = contiguous_view<const double, 3>(vector_field, nlev);
+        auto curl_c         = contiguous_view<double, 2>(curl_field, nlev);
+        compute(vector_c, curl_c);
+    }
+    else {
+        compute(vector, curl);
     }
 }
 
@@ -11,6 +11,7 @@
 #include <cstring>
 
 #include "atlas/parallel/Checksum.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 
 namespace atlas {
 namespace parallel {
@@ -25,22 +26,28 @@ Checksum::Checksum(const std::string& name): name_(name) {
 
 void Checksum::setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                      const int parsize) {
-    parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>(new GatherScatter());
-    gather_->setup(part, remote_idx, base, glb_idx, parsize);
-    is_setup_ = true;
+    // Exclude ghost points: owned by another partition, or a copy of a point of this partition
+    detail::IsGhostPoint is_ghost(part, remote_idx, base, parsize);
+    std::vector<int> mask(parsize);
+    for (int n = 0; n < parsize; ++n) {
+        mask[n] = is_ghost(n) ? 1 : 0;
+    }
+    setup(part, remote_idx, base, glb_idx, mask.data(), parsize);
 }
 
-void Checksum::setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
+void Checksum::setup(const int /*part*/[], const idx_t /*remote_idx*/[], const int /*base*/, const gidx_t glb_idx[],
                      const int mask[], const int parsize) {
     parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>(new GatherScatter());
-    gather_->setup(part, remote_idx, base, glb_idx, mask, parsize);
+    gather_  = util::ObjectHandle<GatherScatter>();
+    glb_idx_.assign(glb_idx, glb_idx + parsize);
+    mask_.assign(mask, mask + parsize);
     is_setup_ = true;
 }
 
 void Checksum::setup(const util::ObjectHandle<GatherScatter>& gather) {
-    gather_   = gather;
+    gather_ = gather;
+    glb_idx_.clear();
+    mask_.clear();
     parsize_  = gather->parsize_;
     is_setup_ = true;
 }
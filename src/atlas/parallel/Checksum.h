@@ -17,6 +17,8 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/Checksum.h"
 #include "atlas/util/Object.h"
 #include "atlas/util/ObjectHandle.h"
@@ -24,6 +26,14 @@
 namespace atlas {
 namespace parallel {
 
+/// @brief Global checksum of distributed fields
+///
+/// When set up with partition, remote index and global index lists, the checksum is computed
+/// without gathering: each owned point is hashed together with its global index, the hashes are
+/// summed modulo 2^64, and the partial sums are combined with one allReduce. The result is
+/// therefore independent of the domain decomposition and of the number of threads.
+///
+/// When set up with a GatherScatter object, the field is gathered to compute the checksum.
 class Checksum : public util::Object {
 public:
     Checksum();
@@ -55,7 +65,7 @@ public:  // methods
     void setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[], const int mask[],
                const int parsize);
 
-    /// @brief Setup
+    /// @brief Setup, computing checksums by gathering with given GatherScatter
     void setup(const util::ObjectHandle<GatherScatter>&);
 
     template <typename DATA_TYPE>
@@ -72,24 +82,40 @@ public:  // methods
     void var_info(const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<int>& varstrides,
                   std::vector<int>& varextents) const;
 
+private:  // methods
+    template <typename DATA_TYPE>
+    std::string execute_gather(const DATA_TYPE lfield[], int var_size) const;
+
+    template <typename DATA_TYPE>
+    std::string execute_distributed(const DATA_TYPE lfield[], int var_size) const;
+
 private:  // data
     std::string name_;
     util::ObjectHandle<GatherScatter> gather_;
+    std::vector<gidx_t> glb_idx_;  // global index of each point, for distributed checksums
+    std::vector<int> mask_;        // points not to include (0=include,1=exclude)
     bool is_setup_;
     size_t parsize_;
 };
 
 template <typename DATA_TYPE>
 std::string Checksum::execute(const DATA_TYPE data[], const int var_strides[], const int var_extents[],
-                              const int var_rank) const {
-    idx_t root = 0;
-
+                              const int /*var_rank*/) const {
     if (!is_setup_) {
         throw_Exception("Checksum was not setup", Here());
     }
-    std::vector<util::checksum_t> local_checksums(parsize_);
     int var_size = var_extents[0] * var_strides[0];
+    if (gather_) {
+        return execute_gather(data, var_size);
+    }
+    return execute_distributed(data, var_size);
+}
 
+template <typename DATA_TYPE>
+std::string Checksum::execute_gather(const DATA_TYPE data[], int var_size) const {
+    idx_t root = 0;
+
+    std::vector<util::checksum_t> local_checksums(parsize_);
     for (size_t pp = 0; pp < parsize_; ++pp) {
         local_checksums[pp] = util::checksum(data + pp * var_size, var_size);
     }
@@ -106,6 +132,26 @@ std::string Checksum::execute(const DATA_TYPE data[], const int var_strides[], c
     return eckit::Translator<util::checksum_t, std::string>()(glb_checksum);
 }
 
+template <typename DATA_TYPE>
+std::string Checksum::execute_distributed(const DATA_TYPE data[], int var_size) const {
+    using checksum_t = util::checksum_t;
+
+    // Sum modulo 2^64 of per-point hashes: commutative, so independent of point order and distribution
+    checksum_t local_checksum = 0;
+    const idx_t npts          = static_cast<idx_t>(parsize_);
+    atlas_omp_pragma( omp parallel for reduction(+:local_checksum) )
+    for (idx_t pp = 0; pp < npts; ++pp) {
+        if (!mask_[pp]) {
+            local_checksum += util::hash(data + size_t(pp) * var_size, var_size, checksum_t(glb_idx_[pp]));
+        }
+    }
+
+    checksum_t glb_checksum;
+    ATLAS_TRACE_MPI(ALLREDUCE) { mpi::comm().allReduce(local_checksum, glb_checksum, eckit::mpi::sum()); }
+
+    return eckit::Translator<checksum_t, std::string>()(glb_checksum);
+}
+
 template <typename DATA_TYPE>
 std::string Checksum::execute(DATA_TYPE lfield[], const int nb_vars) const {
     int strides[] = {1};
@@ -19,6 +19,7 @@
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -28,30 +29,9 @@
 namespace atlas {
 namespace parallel {
 
-namespace {
-struct IsGhostPoint {
-    IsGhostPoint(const int part[], const idx_t ridx[], const idx_t base, const int N) {
-        part_   = part;
-        ridx_   = ridx;
-        base_   = base;
-        mypart_ = mpi::rank();
-    }
-
-    bool operator()(idx_t idx) {
-        if (part_[idx] != mypart_) {
-            return true;
-        }
-        if (ridx_[idx] != base_ + idx) {
-            return true;
-        }
-        return false;
-    }
-    int mypart_;
-    const int* part_;
-    const idx_t* ridx_;
-    idx_t base_;
-};
+using detail::IsGhostPoint;
 
+namespace {
 struct Node {
     int p;
     idx_t i;
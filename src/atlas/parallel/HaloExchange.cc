@@ -19,36 +19,14 @@
 
 #include "atlas/array/Array.h"
 #include "atlas/parallel/HaloExchange.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/util/vector.h"
 
 namespace atlas {
 namespace parallel {
 
-namespace {
-struct IsGhostPoint {
-    IsGhostPoint(const int part[], const idx_t ridx[], const idx_t base, const int /*N*/) {
-        part_   = part;
-        ridx_   = ridx;
-        base_   = base;
-        mypart_ = mpi::rank();
-    }
-
-    bool operator()(idx_t idx) {
-        if (part_[idx] != mypart_) {
-            return true;
-        }
-        if (ridx_[idx] != base_ + idx) {
-            return true;
-        }
-        return false;
-    }
-    int mypart_;
-    const int* part_;
-    const idx_t* ridx_;
-    idx_t base_;
-};
-}  // namespace
+using detail::IsGhostPoint;
 
 HaloExchange::HaloExchange(): name_(), is_setup_(false) {
     myproc = mpi::rank();
@@ -87,14 +65,11 @@ void HaloExchange::setup(const int part[], const idx_t remote_idx[], const int b
     atlas::vector<idx_t> ghost_points(parsize_);
     idx_t nghost = 0;
 
-    atlas_omp_parallel_for(int jj = halo_begin; jj < parsize_; ++jj) {
+    // Ghost points in ascending local order, so that each partition's segment of recvmap_ is ordered
+    for (idx_t jj = halo_begin; jj < parsize_; ++jj) {
         if (is_ghost(jj)) {
-            int p = part[jj];
-            atlas_omp_critical {
-                ++recvcounts_[p];
-                ghost_points[nghost] = jj;
-                nghost++;
-            }
+            ++recvcounts_[part[jj]];
+            ghost_points[nghost++] = jj;
         }
     }
 
@@ -155,6 +130,25 @@ void HaloExchange::setup(const int part[], const idx_t remote_idx[], const int b
         sendmap_[jj] = recv_requests[jj];
     }
 
+    /*
+    Detect whether the ghost points received from each proc are stored contiguously, in
+    which case the halo can be received directly into field storage without unpacking
+    */
+    recvbegin_.assign(nproc, 0);
+    recv_contiguous_ = true;
+    for (int jproc = 0; jproc < nproc; ++jproc) {
+        if (recvcounts_[jproc] > 0) {
+            const int* map    = recvmap_.data() + recvdispls_[jproc];
+            recvbegin_[jproc] = map[0];
+            for (int jj = 1; jj < recvcounts_[jproc]; ++jj) {
+                if (map[jj] != map[0] + jj) {
+                    recv_contiguous_ = false;
+                    break;
+                }
+            }
+        }
+    }
+
     is_setup_        = true;
     backdoor.parsize = parsize_;
 }
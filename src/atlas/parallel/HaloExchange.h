@@ -14,14 +14,17 @@
 
 #pragma once
 
+#include <functional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "atlas/parallel/HaloAdjointExchangeImpl.h"
 #include "atlas/parallel/HaloExchangeImpl.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/ArrayViewDefs.h"
@@ -60,6 +63,21 @@ public:  // methods
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
     void execute_adjoint(array::Array& field, bool on_device = false) const;
 
+    /// @brief Halo exchange transporting values as WIRE_TYPE, e.g. double fields sent as float.
+    /// Values are converted back to DATA_TYPE on receive; only supported for host data.
+    template <typename WIRE_TYPE, typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute_as(array::Array& field, bool on_device = false) const;
+
+    /// @brief Halo exchange of several host fields of the same datatype, with one aggregated message
+    /// per partition instead of one per field. Fields must have rank 1 to 4 with parallel first dimension.
+    template <typename DATA_TYPE>
+    void execute(const std::vector<array::Array*>& fields) const;
+
+    /// @brief True if the ghost points received from each partition are stored contiguously.
+    /// Host fields that are contiguous and parallel in their first dimension are then received
+    /// directly into field storage, without intermediate buffer or unpacking.
+    bool recv_contiguous() const { return recv_contiguous_; }
+
 private:  // methods
     idx_t index(idx_t i, idx_t j, idx_t k, idx_t ni, idx_t nj, idx_t /*nk*/) const { return (i + ni * (j + nj * k)); }
 
@@ -130,6 +148,8 @@ private:  // data
     std::vector<int> recvdispls_;
     array::SVector<int> sendmap_;
     array::SVector<int> recvmap_;
+    std::vector<int> recvbegin_;
+    bool recv_contiguous_{false};
     int parsize_;
 
     int nproc;
@@ -162,15 +182,26 @@ void HaloExchange::execute(array::Array& field, bool on_device) const {
     std::vector<int> inner_displs(nproc_loc), halo_displs(nproc_loc);
     std::vector<eckit::mpi::Request> inner_req(nproc_loc), halo_req(nproc_loc);
 
+    // Receive directly into the field when halos are contiguous per partition
+    const bool zero_copy = recv_contiguous_ && !on_device && parallelDim == 0 && field.contiguous();
+
     int inner_size          = sendcnt_ * var_size;
     int halo_size           = recvcnt_ * var_size;
     DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>(inner_size, on_device);
-    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>(halo_size, on_device);
+    DATA_TYPE* halo_buffer  = zero_copy ? nullptr : allocate_buffer<DATA_TYPE>(halo_size, on_device);
 
     counts_displs_setup<DATA_TYPE>(var_size, inner_counts_init, halo_counts_init, inner_counts, halo_counts,
                                    inner_displs, halo_displs);
 
-    ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+    if (zero_copy) {
+        for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+            halo_displs[jproc] = recvbegin_[jproc] * var_size;
+        }
+        ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, field_hv.data());
+    }
+    else {
+        ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+    }
 
     /// Pack
     pack_send_buffer<parallelDim>(field_hv, field_dv, inner_buffer, inner_size, on_device);
@@ -179,12 +210,190 @@ void HaloExchange::execute(array::Array& field, bool on_device) const {
                                           inner_buffer);
 
     /// Unpack
-    unpack_recv_buffer<parallelDim>(halo_buffer, halo_size, field_hv, field_dv, on_device);
+    if (!zero_copy) {
+        unpack_recv_buffer<parallelDim>(halo_buffer, halo_size, field_hv, field_dv, on_device);
+    }
 
     wait_for_send(inner_counts_init, inner_req);
 
     deallocate_buffer<DATA_TYPE>(inner_buffer, on_device);
-    deallocate_buffer<DATA_TYPE>(halo_buffer, on_device);
+    if (!zero_copy) {
+        deallocate_buffer<DATA_TYPE>(halo_buffer, on_device);
+    }
+}
+
+template <typename WIRE_TYPE, typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute_as(array::Array& field, bool on_device) const {
+    if (std::is_same<WIRE_TYPE, DATA_TYPE>::value) {
+        execute<DATA_TYPE, RANK, ParallelDim>(field, on_device);
+        return;
+    }
+    ATLAS_TRACE("HaloExchange", {"halo-exchange"});
+    if (!is_setup_) {
+        throw_Exception("HaloExchange was not setup", Here());
+    }
+    if (on_device) {
+        throw_NotImplemented("HaloExchange with a different wire type is not supported for device data", Here());
+    }
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK>(field);
+
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>(field_hv);
+    idx_t var_size            = array::get_var_size<parallelDim>(field_hv);
+
+    int tag(1);
+    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
+    std::vector<int> inner_counts(nproc_loc), halo_counts(nproc_loc);
+    std::vector<int> inner_counts_init(nproc_loc), halo_counts_init(nproc_loc);
+    std::vector<int> inner_displs(nproc_loc), halo_displs(nproc_loc);
+    std::vector<eckit::mpi::Request> inner_req(nproc_loc), halo_req(nproc_loc);
+
+    int inner_size          = sendcnt_ * var_size;
+    int halo_size           = recvcnt_ * var_size;
+    WIRE_TYPE* inner_buffer = allocate_buffer<WIRE_TYPE>(inner_size, false);
+    WIRE_TYPE* halo_buffer  = allocate_buffer<WIRE_TYPE>(halo_size, false);
+
+    counts_displs_setup<WIRE_TYPE>(var_size, inner_counts_init, halo_counts_init, inner_counts, halo_counts,
+                                   inner_displs, halo_displs);
+
+    ireceive<WIRE_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+
+    /// Pack, converting to the wire type
+    ATLAS_TRACE_SCOPE("pack_send_buffer") {
+        halo_packer<parallelDim, RANK>::pack(sendcnt_, sendmap_, field_hv, inner_buffer, inner_size);
+    }
+
+    isend_and_wait_for_receive<WIRE_TYPE>(tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
+                                          inner_buffer);
+
+    /// Unpack, converting back to the field type
+    ATLAS_TRACE_SCOPE("unpack_recv_buffer") {
+        halo_packer<parallelDim, RANK>::unpack(recvcnt_, recvmap_, halo_buffer, halo_size, field_hv);
+    }
+
+    wait_for_send(inner_counts_init, inner_req);
+
+    deallocate_buffer<WIRE_TYPE>(inner_buffer, false);
+    deallocate_buffer<WIRE_TYPE>(halo_buffer, false);
+}
+
+namespace detail {
+// Packing and unpacking of one field for a range of the send or receive map
+template <typename DATA_TYPE>
+struct HaloRangePacker {
+    idx_t var_size;
+    std::function<void(const int* map, int begin, int end, DATA_TYPE* buffer)> pack;
+    std::function<void(const int* map, int begin, int end, const DATA_TYPE* buffer)> unpack;
+
+    template <int RANK>
+    static HaloRangePacker create(array::Array& field) {
+        auto view = array::make_host_view<DATA_TYPE, RANK>(field);
+        HaloRangePacker packer;
+        packer.var_size = array::get_var_size<0>(view);
+        if (halo_contiguous_packer::applicable<0>(view)) {
+            auto contiguous_view = halo_contiguous_packer::view(view);
+            packer.pack          = [contiguous_view](const int* map, int begin, int end, DATA_TYPE* buffer) {
+                halo_contiguous_packer::pack(map, begin, end, contiguous_view, buffer);
+            };
+            packer.unpack = [contiguous_view](const int* map, int begin, int end, const DATA_TYPE* buffer) mutable {
+                halo_contiguous_packer::unpack(map, begin, end, buffer, contiguous_view);
+            };
+            return packer;
+        }
+        packer.pack = [view](const int* map, int begin, int end, DATA_TYPE* buffer) {
+            idx_t ibuf = 0;
+            for (int n = begin; n < end; ++n) {
+                halo_packer_impl<0, RANK, 0>::apply(ibuf, map[n], view, buffer);
+            }
+        };
+        packer.unpack = [view](const int* map, int begin, int end, const DATA_TYPE* buffer) mutable {
+            idx_t ibuf = 0;
+            for (int n = begin; n < end; ++n) {
+                halo_unpacker_impl<0, RANK, 0>::apply(ibuf, map[n], buffer, view);
+            }
+        };
+        return packer;
+    }
+
+    static HaloRangePacker create(array::Array& field) {
+        switch (field.rank()) {
+            case 1:
+                return create<1>(field);
+            case 2:
+                return create<2>(field);
+            case 3:
+                return create<3>(field);
+            case 4:
+                return create<4>(field);
+            default:
+                throw_Exception("Rank not supported", Here());
+        }
+    }
+};
+}  // namespace detail
+
+template <typename DATA_TYPE>
+void HaloExchange::execute(const std::vector<array::Array*>& fields) const {
+    ATLAS_TRACE("HaloExchange", {"halo-exchange"});
+    if (!is_setup_) {
+        throw_Exception("HaloExchange was not setup", Here());
+    }
+
+    std::vector<detail::HaloRangePacker<DATA_TYPE>> packers;
+    packers.reserve(fields.size());
+    idx_t var_size = 0;
+    for (auto* field : fields) {
+        packers.emplace_back(detail::HaloRangePacker<DATA_TYPE>::create(*field));
+        var_size += packers.back().var_size;
+    }
+
+    // Message to each partition holds the fields one after the other, each with all points for that partition
+    int tag(1);
+    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
+    std::vector<int> inner_counts(nproc_loc), halo_counts(nproc_loc);
+    std::vector<int> inner_counts_init(nproc_loc), halo_counts_init(nproc_loc);
+    std::vector<int> inner_displs(nproc_loc), halo_displs(nproc_loc);
+    std::vector<eckit::mpi::Request> inner_req(nproc_loc), halo_req(nproc_loc);
+
+    int inner_size          = sendcnt_ * var_size;
+    int halo_size           = recvcnt_ * var_size;
+    DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>(inner_size, false);
+    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>(halo_size, false);
+
+    counts_displs_setup<DATA_TYPE>(var_size, inner_counts_init, halo_counts_init, inner_counts, halo_counts,
+                                   inner_displs, halo_displs);
+
+    ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+
+    /// Pack
+    ATLAS_TRACE_SCOPE("pack_send_buffer") {
+        atlas_omp_parallel_for(int jproc = 0; jproc < nproc; ++jproc) {
+            DATA_TYPE* buffer = inner_buffer + inner_displs[jproc];
+            for (auto& packer : packers) {
+                packer.pack(sendmap_.data(), senddispls_[jproc], senddispls_[jproc] + sendcounts_[jproc], buffer);
+                buffer += sendcounts_[jproc] * packer.var_size;
+            }
+        }
+    }
+
+    isend_and_wait_for_receive<DATA_TYPE>(tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
+                                          inner_buffer);
+
+    /// Unpack
+    ATLAS_TRACE_SCOPE("unpack_recv_buffer") {
+        atlas_omp_parallel_for(int jproc = 0; jproc < nproc; ++jproc) {
+            const DATA_TYPE* buffer = halo_buffer + halo_displs[jproc];
+            for (auto& packer : packers) {
+                packer.unpack(recvmap_.data(), recvdispls_[jproc], recvdispls_[jproc] + recvcounts_[jproc], buffer);
+                buffer += recvcounts_[jproc] * packer.var_size;
+            }
+        }
+    }
+
+    wait_for_send(inner_counts_init, inner_req);
+
+    deallocate_buffer<DATA_TYPE>(inner_buffer, false);
+    deallocate_buffer<DATA_TYPE>(halo_buffer, false);
 }
 
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
@@ -317,29 +526,6 @@ void HaloExchange::isend_and_wait_for_receive(int tag, std::vector<int>& recv_co
     }
 }
 
-template <int ParallelDim, int RANK>
-struct halo_packer {
-    template <typename DATA_TYPE>
-    static void pack(const int sendcnt, array::SVector<int> const& sendmap,
-                     const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer, int /*send_buffer_size*/) {
-        idx_t ibuf = 0;
-        for (int node_cnt = 0; node_cnt < sendcnt; ++node_cnt) {
-            const idx_t node_idx = sendmap[node_cnt];
-            halo_packer_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, field, send_buffer);
-        }
-    }
-
-    template <typename DATA_TYPE>
-    static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const DATA_TYPE* recv_buffer,
-                       int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
-        idx_t ibuf = 0;
-        for (int node_cnt = 0; node_cnt < recvcnt; ++node_cnt) {
-            const idx_t node_idx = recvmap[node_cnt];
-            halo_unpacker_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, recv_buffer, field);
-        }
-    }
-};
-
 template <int ParallelDim, int RANK>
 struct halo_adjoint_packer {
     template <typename DATA_TYPE>
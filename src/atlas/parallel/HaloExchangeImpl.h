@@ -11,6 +11,7 @@
 #pragma once
 
 #include "atlas/array/ArrayView.h"
+#include "atlas/array/ContiguousArrayView.h"
 #include "atlas/array/SVector.h"
 
 namespace atlas {
@@ -18,9 +19,9 @@ namespace parallel {
 
 template <int ParallelDim, int Cnt, int CurrentDim>
 struct halo_packer_impl {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
     ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx,
-                                        const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer,
+                                        const array::ArrayView<DATA_TYPE, RANK>& field, BUFFER_TYPE* send_buffer,
                                         Idx... idxs) {
         for (idx_t i = 0; i < field.template shape<CurrentDim>(); ++i) {
             halo_packer_impl<ParallelDim, Cnt - 1, CurrentDim + 1>::apply(buf_idx, node_idx, field, send_buffer,
@@ -31,19 +32,19 @@ struct halo_packer_impl {
 
 template <int ParallelDim>
 struct halo_packer_impl<ParallelDim, 0, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
     ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx,
-                                        const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer,
+                                        const array::ArrayView<DATA_TYPE, RANK>& field, BUFFER_TYPE* send_buffer,
                                         Idx... idxs) {
-        send_buffer[buf_idx++] = field(idxs...);
+        send_buffer[buf_idx++] = static_cast<BUFFER_TYPE>(field(idxs...));
     }
 };
 
 template <int ParallelDim, int Cnt>
 struct halo_packer_impl<ParallelDim, Cnt, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
     ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx,
-                                        const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer,
+                                        const array::ArrayView<DATA_TYPE, RANK>& field, BUFFER_TYPE* send_buffer,
                                         Idx... idxs) {
         halo_packer_impl<ParallelDim, Cnt - 1, ParallelDim + 1>::apply(buf_idx, node_idx, field, send_buffer, idxs...,
                                                                        node_idx);
@@ -52,18 +53,18 @@ struct halo_packer_impl<ParallelDim, Cnt, ParallelDim> {
 
 template <int ParallelDim, int CurrentDim>
 struct halo_packer_impl<ParallelDim, 0, CurrentDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
     ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx,
-                                        const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer,
+                                        const array::ArrayView<DATA_TYPE, RANK>& field, BUFFER_TYPE* send_buffer,
                                         Idx... idxs) {
-        send_buffer[buf_idx++] = field(idxs...);
+        send_buffer[buf_idx++] = static_cast<BUFFER_TYPE>(field(idxs...));
     }
 };
 
 template <int ParallelDim, int Cnt, int CurrentDim>
 struct halo_unpacker_impl {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
-    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const DATA_TYPE* recv_buffer,
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
+    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const BUFFER_TYPE* recv_buffer,
                                         array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs) {
         for (idx_t i = 0; i < field.template shape<CurrentDim>(); ++i) {
             halo_unpacker_impl<ParallelDim, Cnt - 1, CurrentDim + 1>::apply(buf_idx, node_idx, recv_buffer, field,
@@ -74,17 +75,17 @@ struct halo_unpacker_impl {
 
 template <int ParallelDim>
 struct halo_unpacker_impl<ParallelDim, 0, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
-    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const DATA_TYPE* recv_buffer,
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
+    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const BUFFER_TYPE* recv_buffer,
                                         array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs) {
-        field(idxs...) = recv_buffer[buf_idx++];
+        field(idxs...) = static_cast<DATA_TYPE>(recv_buffer[buf_idx++]);
     }
 };
 
 template <int ParallelDim, int Cnt>
 struct halo_unpacker_impl<ParallelDim, Cnt, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
-    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const DATA_TYPE* recv_buffer,
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
+    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const BUFFER_TYPE* recv_buffer,
                                         array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs) {
         halo_unpacker_impl<ParallelDim, Cnt - 1, ParallelDim + 1>::apply(buf_idx, node_idx, recv_buffer, field, idxs...,
                                                                          node_idx);
@@ -93,10 +94,82 @@ struct halo_unpacker_impl<ParallelDim, Cnt, ParallelDim> {
 
 template <int ParallelDim, int CurrentDim>
 struct halo_unpacker_impl<ParallelDim, 0, CurrentDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
-    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const DATA_TYPE* recv_buffer,
+    template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE, typename... Idx>
+    ATLAS_HOST_DEVICE static void apply(idx_t& buf_idx, const idx_t node_idx, const BUFFER_TYPE* recv_buffer,
                                         array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs) {
-        field(idxs...) = recv_buffer[buf_idx++];
+        field(idxs...) = static_cast<DATA_TYPE>(recv_buffer[buf_idx++]);
+    }
+};
+
+// Fields with the parallel dimension slowest and contiguous values per point are packed through a
+// ContiguousArrayView of shape (points, values per point), so that the copy of a point is unit-stride
+struct halo_contiguous_packer {
+    template <int ParallelDim, typename DATA_TYPE, int RANK>
+    static bool applicable(const array::ArrayView<DATA_TYPE, RANK>& field) {
+        return ParallelDim == 0 && RANK > 1 && field.contiguous() && field.stride(RANK - 1) == 1;
+    }
+
+    template <typename DATA_TYPE, int RANK>
+    static array::ContiguousArrayView<DATA_TYPE, 2> view(const array::ArrayView<DATA_TYPE, RANK>& field) {
+        const idx_t shape[] = {field.shape(0), field.stride(0)};
+        return array::ContiguousArrayView<DATA_TYPE, 2>(const_cast<DATA_TYPE*>(field.data()), shape);
+    }
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void pack(const int* map, int begin, int end, const array::ContiguousArrayView<DATA_TYPE, 2>& field,
+                     BUFFER_TYPE* buffer) {
+        const idx_t var_size = field.shape(1);
+        for (int n = begin; n < end; ++n, buffer += var_size) {
+            const idx_t node_idx = map[n];
+            for (idx_t j = 0; j < var_size; ++j) {
+                buffer[j] = static_cast<BUFFER_TYPE>(field(node_idx, j));
+            }
+        }
+    }
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void unpack(const int* map, int begin, int end, const BUFFER_TYPE* buffer,
+                       array::ContiguousArrayView<DATA_TYPE, 2>& field) {
+        const idx_t var_size = field.shape(1);
+        for (int n = begin; n < end; ++n, buffer += var_size) {
+            const idx_t node_idx = map[n];
+            for (idx_t j = 0; j < var_size; ++j) {
+                field(node_idx, j) = static_cast<DATA_TYPE>(buffer[j]);
+            }
+        }
+    }
+};
+
+template <int ParallelDim, int RANK>
+struct halo_packer {
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void pack(const int sendcnt, array::SVector<int> const& sendmap,
+                     const array::ArrayView<DATA_TYPE, RANK>& field, BUFFER_TYPE* send_buffer,
+                     int /*send_buffer_size*/) {
+        if (halo_contiguous_packer::applicable<ParallelDim>(field)) {
+            halo_contiguous_packer::pack(sendmap.data(), 0, sendcnt, halo_contiguous_packer::view(field), send_buffer);
+            return;
+        }
+        idx_t ibuf = 0;
+        for (int node_cnt = 0; node_cnt < sendcnt; ++node_cnt) {
+            const idx_t node_idx = sendmap[node_cnt];
+            halo_packer_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, field, send_buffer);
+        }
+    }
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const BUFFER_TYPE* recv_buffer,
+                       int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
+        if (halo_contiguous_packer::applicable<ParallelDim>(field)) {
+            auto view = halo_contiguous_packer::view(field);
+            halo_contiguous_packer::unpack(recvmap.data(), 0, recvcnt, recv_buffer, view);
+            return;
+        }
+        idx_t ibuf = 0;
+        for (int node_cnt = 0; node_cnt < recvcnt; ++node_cnt) {
+            const idx_t node_idx = recvmap[node_cnt];
+            halo_unpacker_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, recv_buffer, field);
+        }
     }
 };
 
@@ -0,0 +1,47 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/library/config.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+namespace atlas {
+namespace parallel {
+namespace detail {
+
+// A point is a ghost point if it is owned by another partition, or if it is a copy of another point of this
+// partition (e.g. a periodic point)
+struct IsGhostPoint {
+    IsGhostPoint(const int part[], const idx_t ridx[], const idx_t base, const int /*N*/) {
+        part_   = part;
+        ridx_   = ridx;
+        base_   = base;
+        mypart_ = mpi::rank();
+    }
+
+    bool operator()(idx_t idx) const {
+        if (part_[idx] != mypart_) {
+            return true;
+        }
+        if (ridx_[idx] != base_ + idx) {
+            return true;
+        }
+        return false;
+    }
+    int mypart_;
+    const int* part_;
+    const idx_t* ridx_;
+    idx_t base_;
+};
+
+}  // namespace detail
+}  // namespace parallel
+}  // namespace atlas
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "eckit/mpi/Comm.h"
 
 #include "atlas/parallel/mpi/Statistics.h"
@@ -23,6 +25,10 @@ inline const Comm& comm() {
     return eckit::mpi::comm();
 }
 
+inline const Comm& comm(const std::string& name) {
+    return eckit::mpi::comm(name.c_str());
+}
+
 inline idx_t rank() {
     return static_cast<idx_t>(comm().rank());
 }
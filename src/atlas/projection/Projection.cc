@@ -49,10 +49,22 @@ void atlas::Projection::lonlat2xy(Point2& point) const {
     get()->lonlat2xy(point);
 }
 
+void atlas::Projection::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    get()->xy2lonlat(xy, lonlat, n);
+}
+
+void atlas::Projection::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    get()->lonlat2xy(lonlat, xy, n);
+}
+
 atlas::Projection::Jacobian atlas::Projection::jacobian(const PointLonLat& p) const {
     return get()->jacobian(p);
 }
 
+void atlas::Projection::jacobian(const double lonlat[], Jacobian jac[], idx_t n) const {
+    get()->jacobian(lonlat, jac, n);
+}
+
 PointLonLat atlas::Projection::lonlat(const PointXY& xy) const {
     return get()->lonlat(xy);
 }
@@ -65,8 +65,20 @@ public:
     void lonlat2xy(double crd[]) const;
     void lonlat2xy(Point2&) const;
 
+    /// @brief Batch conversion of n points, stored as consecutive (x,y) or (lon,lat) pairs
+    ///
+    /// Input and output may be the same array. Prefer these over point-wise conversion
+    /// when converting many points, as they avoid a virtual call per point.
+    /// @{
+    void xy2lonlat(const double xy[], double lonlat[], idx_t n) const;
+    void lonlat2xy(const double lonlat[], double xy[], idx_t n) const;
+    /// @}
+
     Jacobian jacobian(const PointLonLat&) const;
 
+    /// @brief Batch computation of Jacobians at n points, stored as consecutive (lon,lat) pairs
+    void jacobian(const double lonlat[], Jacobian jac[], idx_t n) const;
+
     PointLonLat lonlat(const PointXY&) const;
     PointXY xy(const PointLonLat&) const;
 
@@ -335,6 +335,24 @@ void CubedSphereEquiAnglProjection::xy2lonlat(double crd[]) const {
 
 // -------------------------------------------------------------------------------------------------
 
+void CubedSphereEquiAnglProjection::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        CubedSphereEquiAnglProjection::lonlat2xy(xy + 2 * i);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void CubedSphereEquiAnglProjection::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        CubedSphereEquiAnglProjection::xy2lonlat(lonlat + 2 * i);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
 Jacobian CubedSphereEquiAnglProjection::jacobian(const PointLonLat& lonlat) const {
     const auto& tiles = getCubedSphereTiles();
     const idx_t t     = tiles.indexFromLonLat(lonlat.data());
@@ -127,6 +127,24 @@ void CubedSphereEquiDistProjection::xy2lonlat(double crd[]) const {
 }
 
 
+// -------------------------------------------------------------------------------------------------
+
+void CubedSphereEquiDistProjection::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        CubedSphereEquiDistProjection::lonlat2xy(xy + 2 * i);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void CubedSphereEquiDistProjection::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        CubedSphereEquiDistProjection::xy2lonlat(lonlat + 2 * i);
+    }
+}
+
 // -------------------------------------------------------------------------------------------------
 
 Jacobian CubedSphereEquiDistProjection::jacobian(const PointLonLat&) const {
@@ -49,6 +49,10 @@ public:
     void xy2lonlat(double crd[]) const override;
     void lonlat2xy(double crd[]) const override;
 
+    // batch projection and inverse projection
+    void xy2lonlat(const double xy[], double lonlat[], idx_t n) const override;
+    void lonlat2xy(const double lonlat[], double xy[], idx_t n) const override;
+
     Jacobian jacobian(const PointLonLat&) const override;
 
     bool strictlyRegional() const override { return false; }
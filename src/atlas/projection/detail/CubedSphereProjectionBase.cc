@@ -32,13 +32,8 @@ namespace {
 
 static constexpr double deg2rad = util::Constants::degreesToRadians();
 
-static void schmidtTransform(double stretchFac, double targetLon, double targetLat, double lonlat[]) {
-    double c2p1 = 1.0 + stretchFac * stretchFac;
-    double c2m1 = 1.0 - stretchFac * stretchFac;
-
-    double sin_p = std::sin(targetLat * deg2rad);
-    double cos_p = std::cos(targetLat * deg2rad);
-
+// Terms depending only on stretch factor and target latitude are precomputed in the constructor
+static void schmidtTransform(double c2p1, double c2m1, double sin_p, double cos_p, double targetLon, double lonlat[]) {
     double sin_lat;
     double cos_lat;
     double lat_t;
@@ -122,6 +117,10 @@ CubedSphereProjectionBase::CubedSphereProjectionBase(const eckit::Parametrisatio
             params.get("TargetLat", targetLat_);
         }
     }
+    schmidt_c2p1_  = 1.0 + stretchFac_ * stretchFac_;
+    schmidt_c2m1_  = 1.0 - stretchFac_ * stretchFac_;
+    schmidt_sin_p_ = std::sin(targetLat_ * deg2rad);
+    schmidt_cos_p_ = std::cos(targetLat_ * deg2rad);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -172,7 +171,7 @@ void CubedSphereProjectionBase::xy2lonlat_post(double xyz[], const idx_t t, doub
 
     // Schmidt transform
     if (doSchmidt_) {
-        schmidtTransform(stretchFac_, targetLon_, targetLat_, crd);
+        schmidtTransform(schmidt_c2p1_, schmidt_c2m1_, schmidt_sin_p_, schmidt_cos_p_, targetLon_, crd);
     }
 
     // longitude does not make sense at the poles - set to 0.
@@ -108,6 +108,11 @@ private:
     double stretchFac_;
     double targetLon_;
     double targetLat_;
+    // Precomputed terms of Schmidt transform
+    double schmidt_c2p1_;
+    double schmidt_c2m1_;
+    double schmidt_sin_p_;
+    double schmidt_cos_p_;
 
     std::array<std::array<double, 6>, 2> tiles_offsets_ab2xy_;
     std::array<std::array<double, 6>, 2> tiles_offsets_xy2ab_;
@@ -86,6 +86,21 @@ void LambertAzimuthalEqualAreaProjection::xy2lonlat(double crd[]) const {
 }
 
 
+void LambertAzimuthalEqualAreaProjection::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        LambertAzimuthalEqualAreaProjection::lonlat2xy(xy + 2 * i);
+    }
+}
+
+void LambertAzimuthalEqualAreaProjection::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        LambertAzimuthalEqualAreaProjection::xy2lonlat(lonlat + 2 * i);
+    }
+}
+
+
 ProjectionImpl::Jacobian LambertAzimuthalEqualAreaProjection::jacobian(const PointLonLat&) const {
     throw_NotImplemented("LambertAzimuthalEqualAreaProjection::jacobian", Here());
 }
@@ -99,6 +99,20 @@ void LambertConformalConicProjection::xy2lonlat(double crd[]) const {
                    : util::Constants::radiansToDegrees() * 2. * std::atan(std::pow(radius_ * F_ / rho, inv_n_)) - 90.;
 }
 
+void LambertConformalConicProjection::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        LambertConformalConicProjection::lonlat2xy(xy + 2 * i);
+    }
+}
+
+void LambertConformalConicProjection::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        LambertConformalConicProjection::xy2lonlat(lonlat + 2 * i);
+    }
+}
+
 ProjectionImpl::Jacobian LambertConformalConicProjection::jacobian(const PointLonLat& lonlat) const {
     ProjectionImpl::Jacobian jac;
 
@@ -131,6 +145,12 @@ ProjectionImpl::Jacobian LambertConformalConicProjection::jacobian(const PointLo
     return jac;
 }
 
+void LambertConformalConicProjection::jacobian(const double lonlat[], Jacobian jac[], idx_t n) const {
+    for (idx_t i = 0; i < n; ++i) {
+        jac[i] = LambertConformalConicProjection::jacobian(PointLonLat{lonlat[2 * i], lonlat[2 * i + 1]});
+    }
+}
+
 LambertConformalConicProjection::Spec LambertConformalConicProjection::spec() const {
     Spec spec;
     spec.set("type", static_type());
@@ -41,6 +41,16 @@ public:
     void xy2lonlat(double crd[]) const override { rotation_.rotate(crd); }
     void lonlat2xy(double crd[]) const override { rotation_.unrotate(crd); }
 
+    // batch projection and inverse projection
+    void xy2lonlat(const double xy[], double lonlat[], idx_t n) const override {
+        copy_coordinates(xy, lonlat, n);
+        rotation_.rotate(lonlat, n);
+    }
+    void lonlat2xy(const double lonlat[], double xy[], idx_t n) const override {
+        copy_coordinates(lonlat, xy, n);
+        rotation_.unrotate(xy, n);
+    }
+
     Jacobian jacobian(const PointLonLat&) const override;
 
     bool strictlyRegional() const override { return false; }
@@ -80,7 +80,7 @@ MercatorProjectionT<Rotation>::MercatorProjectionT(const eckit::Parametrisation&
 }
 
 template <typename Rotation>
-void MercatorProjectionT<Rotation>::lonlat2xy(double crd[]) const {
+void MercatorProjectionT<Rotation>::project(double crd[]) const {
     auto t = [&](double& lat) -> double {
         double sinlat = std::sin(D2R(lat));
         double t      = (1. + sinlat) / (1. - sinlat);
@@ -92,10 +92,6 @@ void MercatorProjectionT<Rotation>::lonlat2xy(double crd[]) const {
         return t;
     };
 
-    // first unrotate
-    rotation_.unrotate(crd);
-
-    // then project
     crd[XX] = k_radius_ * (D2R(normalise_mercator_(crd[LON]) - lon0_));
     crd[YY] = k_radius_ * 0.5 * std::log(t(crd[LAT]));
     crd[XX] += false_easting_;
@@ -103,7 +99,7 @@ void MercatorProjectionT<Rotation>::lonlat2xy(double crd[]) const {
 }
 
 template <typename Rotation>
-void MercatorProjectionT<Rotation>::xy2lonlat(double crd[]) const {
+void MercatorProjectionT<Rotation>::unproject(double crd[]) const {
     auto compute_lat = [&](double y) -> double {
         //  deepcode ignore FloatingPointEquals: We want exact comparison
         if (eccentricity_ == 0.) {
@@ -141,9 +137,23 @@ void MercatorProjectionT<Rotation>::xy2lonlat(double crd[]) const {
     const double x = crd[XX] - false_easting_;
     const double y = crd[YY] - false_northing_;
 
-    // first projection
     crd[LON] = lon0_ + R2D(x * inv_k_radius_);
     crd[LAT] = compute_lat(y);
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::lonlat2xy(double crd[]) const {
+    // first unrotate
+    rotation_.unrotate(crd);
+
+    // then project
+    project(crd);
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::xy2lonlat(double crd[]) const {
+    // first projection
+    unproject(crd);
 
     // then rotate
     rotation_.rotate(crd);
@@ -152,6 +162,39 @@ void MercatorProjectionT<Rotation>::xy2lonlat(double crd[]) const {
     normalise_(crd);
 }
 
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+
+    // first unrotate
+    rotation_.unrotate(xy, n);
+
+    // then project
+    for (idx_t i = 0; i < n; ++i) {
+        project(xy + 2 * i);
+    }
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+
+    // first projection
+    for (idx_t i = 0; i < n; ++i) {
+        unproject(lonlat + 2 * i);
+    }
+
+    // then rotate
+    rotation_.rotate(lonlat, n);
+
+    // then normalise
+    if (normalise_) {
+        for (idx_t i = 0; i < n; ++i) {
+            normalise_(lonlat + 2 * i);
+        }
+    }
+}
+
 template <typename Rotation>
 ProjectionImpl::Jacobian MercatorProjectionT<Rotation>::jacobian(const PointLonLat&) const {
     throw_NotImplemented("MercatorProjectionT::jacobian", Here());
@@ -32,6 +32,10 @@ public:
     void xy2lonlat(double crd[]) const override;
     void lonlat2xy(double crd[]) const override;
 
+    // batch projection and inverse projection
+    void xy2lonlat(const double xy[], double lonlat[], idx_t n) const override;
+    void lonlat2xy(const double lonlat[], double xy[], idx_t n) const override;
+
     Jacobian jacobian(const PointLonLat&) const override;
 
     bool strictlyRegional() const override { return true; }  // Mercator projection cannot be used for global grids
@@ -66,6 +70,10 @@ protected:
     void setup(const eckit::Parametrisation& p);
 
 private:
+    // projection and inverse projection of unrotated coordinates
+    void project(double crd[]) const;
+    void unproject(double crd[]) const;
+
     Rotation rotation_;
 };
 
@@ -227,6 +227,26 @@ const ProjectionImpl* ProjectionImpl::create(const std::string& type, const ecki
 }
 
 
+void ProjectionImpl::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        xy2lonlat(lonlat + 2 * i);
+    }
+}
+
+void ProjectionImpl::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        lonlat2xy(xy + 2 * i);
+    }
+}
+
+void ProjectionImpl::jacobian(const double lonlat[], Jacobian jac[], idx_t n) const {
+    for (idx_t i = 0; i < n; ++i) {
+        jac[i] = jacobian(PointLonLat{lonlat[2 * i], lonlat[2 * i + 1]});
+    }
+}
+
 PointXYZ ProjectionImpl::xyz(const PointLonLat& lonlat) const {
     atlas::PointXYZ xyz;
     atlas::util::Earth::convertSphericalToCartesian(lonlat, xyz);
@@ -10,11 +10,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <string>
 
+#include "atlas/library/config.h"
 #include "atlas/projection/Jacobian.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Factory.h"
@@ -59,6 +61,17 @@ public:
 
     virtual Jacobian jacobian(const PointLonLat&) const = 0;
 
+    /// @brief Batch conversion of n points, stored as consecutive (x,y) or (lon,lat) pairs
+    ///
+    /// @details Input and output arrays may be the same. The default implementations
+    ///          apply the point-wise conversion; projections override these to avoid
+    ///          a virtual call per point and to hoist invariants out of the loop.
+    /// @{
+    virtual void xy2lonlat(const double xy[], double lonlat[], idx_t n) const;
+    virtual void lonlat2xy(const double lonlat[], double xy[], idx_t n) const;
+    virtual void jacobian(const double lonlat[], Jacobian jac[], idx_t n) const;
+    /// @}
+
     void xy2lonlat(Point2&) const;
     void lonlat2xy(Point2&) const;
 
@@ -139,6 +152,14 @@ public:
         virtual ProjectionImpl::Derivate* make(const ProjectionImpl& p, PointXY A, PointXY B, double h,
                                                double refLongitude = 0.) = 0;
     };
+
+protected:
+    // Copy n coordinate pairs for batch conversion, unless converting in place
+    static void copy_coordinates(const double in[], double out[], idx_t n) {
+        if (out != in) {
+            std::copy(in, in + 2 * n, out);
+        }
+    }
 };
 
 inline void ProjectionImpl::xy2lonlat(Point2& point) const {
@@ -194,6 +215,10 @@ public:
     }
     void unrotate(double*) const { /* do nothing */
     }
+    void rotate(double*, idx_t) const { /* do nothing */
+    }
+    void unrotate(double*, idx_t) const { /* do nothing */
+    }
 
     bool rotated() const { return false; }
 
@@ -5,6 +5,7 @@
 * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <sstream>
@@ -214,6 +215,41 @@ VariableResolutionProjectionT<Rotation>::VariableResolutionProjectionT(const eck
         new_ratio_[0] = new_ratio(nx_stretched, var_ratio_);
         new_ratio_[1] = new_ratio(ny_stretched, var_ratio_);
     }
+
+    /**
+     *  tabulate cumulative stretch for every number of stretched intervals,
+     *  accumulated in the same order as in general_stretch
+     */
+    for (bool L_long : {false, true}) {
+        const int n_stretched = L_long ? nx_stretched : ny_stretched;
+        const double ratio    = new_ratio_[L_long ? 1 : 0];
+        auto& table           = deltacheck_[L_long ? 1 : 0];
+        table.reserve(n_stretched / 2 + 1);
+        table.push_back(0.);
+        double delta = delta_inner;
+        for (int i = 0; i < n_stretched / 2; i += 1) {
+            delta = delta * ratio;
+            table.push_back(table.back() + (delta - delta_inner));
+        }
+    }
+}
+
+
+template <typename Rotation>
+double VariableResolutionProjectionT<Rotation>::deltacheck(int n_high_st, bool L_long) const {
+    const auto& table = deltacheck_[L_long ? 1 : 0];
+    if (n_high_st < static_cast<int>(table.size())) {
+        return table[n_high_st];
+    }
+    ///< beyond the tabulated range, accumulate
+    double new_ratio  = new_ratio_[L_long ? 1 : 0];
+    double delta      = delta_inner;
+    double deltacheck = 0;
+    for (int i = 0; i < n_high_st; i += 1) {
+        delta = delta * new_ratio;
+        deltacheck += delta - delta_inner;
+    }
+    return deltacheck;
 }
 
 
@@ -286,7 +322,6 @@ double VariableResolutionProjectionT<Rotation>::general_stretch(const double crd
      */
 
     double distance_to_inner = 0.;  ///< distance from point to reg. grid
-    double delta_add         = 0.;  ///< additional part in stretch different from internal high resolution
     int n_high               = 0;   ///< number of points, from point to reg. grid
     int n_high_st            = 0;   ///< number of stretched points, from point to reg grid
     int n_high_rim           = 0;   ///< number of rim points, from point to reg grid
@@ -325,21 +360,12 @@ double VariableResolutionProjectionT<Rotation>::general_stretch(const double crd
         p_rem_low = 0.;
     }
 
-    ///< computation of the new stretched delta integer part
-    double delta = delta_inner;
-    ///< initialization if is not using the cycle (first interval)
-    double delta_last = delta;
-    double deltacheck = 0;
     /*
      * using difference in delta for stretch
      * The point stretched is not in the regular grid and took out the points for the rim
      */
-    for (int i = 0; i < n_high_st; i += 1) {
-        delta_last = delta * new_ratio;
-        delta_add  = delta_last - delta_inner;
-        delta      = delta_last;
-        deltacheck += delta_add;
-    }
+    const double deltacheck = this->deltacheck(n_high_st, L_long);
+
     ///< recomputation of point for every interval
     if (point > inner_start) {
         /*
@@ -450,53 +476,43 @@ double VariableResolutionProjectionT<Rotation>::general_stretch_inv(const double
      * simply using delta_high
      */
 
-    double distance_to_inner;  ///< distance from point to reg. grid
-    double delta_add;          ///< additional part in stretch different from internal high resolution
-    double new_ratio = new_ratio_[L_long ? 1 : 0];
-
-    if (point_st < inner_start) {
-        distance_to_inner = inner_start - point_st;
-    }
-    else if (point_st > inner_end) {
-        distance_to_inner = point_st - inner_end;
-    }
-
-    /*
-     * number of high resolution points intervals, that are not
-     * in the internal regular grid on one side,
-     * this work just for the part of the stretch not the rim
-     */
-
-    ///< computation of the new stretched delta integer part
-    double delta = delta_inner;
-    ///< initialization if is not using the cycle (first interval)
-    double delta_last = delta;
-    double deltacheck = 0;
     /*
      * using difference in delta for stretch
-     * The point stretched is not in the regular grid and took out the points for the rim
+     * The point stretched is not in the regular grid and took out the points for the rim.
+     * Stretched points move monotonically away from the regular grid with the number of
+     * intervals, so the first stretched point matching point_st is found by bisection.
      */
+    const bool after = point_st > inner_start;
+
+    auto reg = [&](int i) { return after ? inner_end + (delta_inner * i) : inner_start - (delta_inner * i); };
+    auto var = [&](int i) { return after ? reg(i) + deltacheck(i, L_long) : reg(i) - deltacheck(i, L_long); };
+
+    ///< stretched intervals tested, i in [1, i_end) with i < n_stretched / 2
+    const int i_end = std::max(1, (n_stretched + 1) / 2);
 
     double point_var = 0.;
-    for (int i = 1; i < n_stretched / 2.; i += 1) {
-        delta_last = delta * new_ratio;
-        delta_add  = delta_last - delta_inner;
-        delta      = delta_last;
-        deltacheck += delta_add;
-        if (point_st > inner_start) {
-            point_reg = inner_end + (delta_inner * i);
-            point_var = point_reg + deltacheck;
-            if ((point_st <= point_var + epstest) && (point_st >= point_var - epstest)) {
-                return normalised(point_reg);
+    if (i_end > 1) {
+        ///< first interval that is not before point_st
+        int lo = 1;
+        int hi = i_end;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (after ? (point_st > var(mid) + epstest) : (point_st < var(mid) - epstest)) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
             }
         }
-        else {
-            point_reg = inner_start - (delta_inner * i);
-            point_var = point_reg - deltacheck;
+        if (lo < i_end) {
+            point_var = var(lo);
             if ((point_st <= point_var + epstest) && (point_st >= point_var - epstest)) {
+                point_reg = reg(lo);
                 return normalised(point_reg);
             }
         }
+        point_reg = reg(i_end - 1);
+        point_var = var(i_end - 1);
     }
 
     ///< SECTION 3_inv rim area
@@ -517,11 +533,8 @@ double VariableResolutionProjectionT<Rotation>::general_stretch_inv(const double
 }
 
 
-///< xy unstretched, only unrotation
 template <typename Rotation>
-void VariableResolutionProjectionT<Rotation>::lonlat2xy(double crd[]) const {
-    ///< unrotate
-    rotation_.unrotate(crd);
+void VariableResolutionProjectionT<Rotation>::unstretch(double crd[]) const {
     //< normalization
     crd[0] = (crd[0] < 0) ? crd[0] + 360.0 : crd[0];
     ///< PUT the unstretch
@@ -529,6 +542,20 @@ void VariableResolutionProjectionT<Rotation>::lonlat2xy(double crd[]) const {
     crd[1] = general_stretch_inv(crd[1], false, ny_stretched);
 }
 
+template <typename Rotation>
+void VariableResolutionProjectionT<Rotation>::stretch(double crd[]) const {
+    crd[0] = general_stretch(crd[0], true, nx_stretched);
+    crd[1] = general_stretch(crd[1], false, ny_stretched);
+}
+
+///< xy unstretched, only unrotation
+template <typename Rotation>
+void VariableResolutionProjectionT<Rotation>::lonlat2xy(double crd[]) const {
+    ///< unrotate
+    rotation_.unrotate(crd);
+    unstretch(crd);
+}
+
 
 ///< From unstretched to stretched
 template <typename Rotation>
@@ -540,12 +567,29 @@ void VariableResolutionProjectionT<Rotation>::xy2lonlat(double crd[]) const {
     * stretch_LAM_gen(crd[]);
     */
 
-    crd[0] = general_stretch(crd[0], true, nx_stretched);
-    crd[1] = general_stretch(crd[1], false, ny_stretched);
+    stretch(crd);
 
     rotation_.rotate(crd);
 }
 
+template <typename Rotation>
+void VariableResolutionProjectionT<Rotation>::lonlat2xy(const double lonlat[], double xy[], idx_t n) const {
+    copy_coordinates(lonlat, xy, n);
+    rotation_.unrotate(xy, n);
+    for (idx_t i = 0; i < n; ++i) {
+        unstretch(xy + 2 * i);
+    }
+}
+
+template <typename Rotation>
+void VariableResolutionProjectionT<Rotation>::xy2lonlat(const double xy[], double lonlat[], idx_t n) const {
+    copy_coordinates(xy, lonlat, n);
+    for (idx_t i = 0; i < n; ++i) {
+        stretch(lonlat + 2 * i);
+    }
+    rotation_.rotate(lonlat, n);
+}
+
 template <typename Rotation>
 ProjectionImpl::Jacobian VariableResolutionProjectionT<Rotation>::jacobian(const PointLonLat&) const {
     throw_NotImplemented("VariableResolution::jacobian", Here());
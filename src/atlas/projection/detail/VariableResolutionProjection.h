@@ -8,6 +8,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "atlas/domain.h"
 #include "atlas/projection/detail/ProjectionImpl.h"
@@ -37,6 +38,10 @@ public:
     void xy2lonlat(double crd[]) const override;
     void lonlat2xy(double crd[]) const override;
 
+    // batch projection and inverse projection
+    void xy2lonlat(const double xy[], double lonlat[], idx_t n) const override;
+    void lonlat2xy(const double lonlat[], double xy[], idx_t n) const override;
+
     ///< specification for stretching
     Spec spec() const override;
 
@@ -83,9 +88,19 @@ protected:
     double phi_start;       ///< start grid y
     std::array<double, 2> new_ratio_;
 
+    ///< cumulative stretch added after each stretched interval, index as new_ratio_
+    std::array<std::vector<double>, 2> deltacheck_;
+
     void setup(const eckit::Parametrisation& p);
 
 private:
+    ///< cumulative stretch added after n_high_st stretched intervals
+    double deltacheck(int n_high_st, bool L_long) const;
+
+    ///< stretch and unstretch of unrotated coordinates
+    void stretch(double crd[]) const;
+    void unstretch(double crd[]) const;
+
     Rotation rotation_;
 };
 
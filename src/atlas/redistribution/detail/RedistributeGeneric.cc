@@ -5,10 +5,12 @@
  * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
  */
 
+#include <cstring>
 #include <numeric>
 #include <vector>
 
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/CellColumns.h"
 #include "atlas/functionspace/EdgeColumns.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -17,6 +19,7 @@
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/redistribution/detail/RedistributeGeneric.h"
 #include "atlas/redistribution/detail/RedistributionImplFactory.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/Unique.h"
 
 
@@ -219,11 +222,11 @@ std::pair<std::vector<idx_t>, std::vector<int>> getUidIntersection(const std::ve
 template <int Rank, int Dim = 0>
 struct ForEach {
     template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
-                      Idxs... idxs) {
+    static void apply(const idx_t* idxBegin, const idx_t* idxEnd, array::ArrayView<Value, Rank>& fieldView,
+                      const Functor& f, Idxs... idxs) {
         // Iterate over dimension Dim of array.
         for (idx_t idx = 0; idx < fieldView.shape(Dim); ++idx) {
-            ForEach<Rank, Dim + 1>::apply(idxList, fieldView, f, idxs..., idx);
+            ForEach<Rank, Dim + 1>::apply(idxBegin, idxEnd, fieldView, f, idxs..., idx);
         }
     }
 };
@@ -232,11 +235,11 @@ struct ForEach {
 template <int Rank>
 struct ForEach<Rank, 0> {
     template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
-                      Idxs... idxs) {
-        // Iterate over dimension 0 of array in order defined by idxList.
-        for (idx_t idx : idxList) {
-            ForEach<Rank, 1>::apply(idxList, fieldView, f, idxs..., idx);
+    static void apply(const idx_t* idxBegin, const idx_t* idxEnd, array::ArrayView<Value, Rank>& fieldView,
+                      const Functor& f, Idxs... idxs) {
+        // Iterate over dimension 0 of array in order defined by index list.
+        for (const idx_t* idx = idxBegin; idx != idxEnd; ++idx) {
+            ForEach<Rank, 1>::apply(idxBegin, idxEnd, fieldView, f, idxs..., *idx);
         }
     }
 };
@@ -245,13 +248,129 @@ struct ForEach<Rank, 0> {
 template <int Rank>
 struct ForEach<Rank, Rank> {
     template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
-                      Idxs... idxs) {
+    static void apply(const idx_t* idxBegin, const idx_t* idxEnd, array::ArrayView<Value, Rank>& fieldView,
+                      const Functor& f, Idxs... idxs) {
         // Apply functor.
         f(fieldView(idxs...));
     }
 };
 
+// Copy columns of a field to a byte buffer. Returns end of written buffer.
+struct Pack {
+    template <typename Value, typename WireValue, int Rank>
+    static char* apply(const Field& field, const idx_t* idxBegin, const idx_t* idxEnd, char* buffer) {
+        auto fieldView = array::make_view<Value, Rank>(field);
+        ForEach<Rank>::apply(idxBegin, idxEnd, fieldView, [&](const Value& elem) {
+            const auto wireElem = static_cast<WireValue>(elem);
+            std::memcpy(buffer, &wireElem, sizeof(WireValue));
+            buffer += sizeof(WireValue);
+        });
+        return buffer;
+    }
+};
+
+// Copy byte buffer to columns of a field. Returns end of read buffer.
+struct Unpack {
+    template <typename Value, typename WireValue, int Rank>
+    static char* apply(Field& field, const idx_t* idxBegin, const idx_t* idxEnd, char* buffer) {
+        auto fieldView = array::make_view<Value, Rank>(field);
+        ForEach<Rank>::apply(idxBegin, idxEnd, fieldView, [&](Value& elem) {
+            WireValue wireElem;
+            std::memcpy(&wireElem, buffer, sizeof(WireValue));
+            elem = static_cast<Value>(wireElem);
+            buffer += sizeof(WireValue);
+        });
+        return buffer;
+    }
+};
+
+// Determine rank.
+template <typename Functor, typename Value, typename WireValue, typename FieldType>
+char* dispatch(FieldType& field, const idx_t* idxBegin, const idx_t* idxEnd, char* buffer) {
+    // Available ranks defined in array/LocalView.cc
+    switch (field.rank()) {
+        case 1: {
+            return Functor::template apply<Value, WireValue, 1>(field, idxBegin, idxEnd, buffer);
+        }
+        case 2: {
+            return Functor::template apply<Value, WireValue, 2>(field, idxBegin, idxEnd, buffer);
+        }
+        case 3: {
+            return Functor::template apply<Value, WireValue, 3>(field, idxBegin, idxEnd, buffer);
+        }
+        case 4: {
+            return Functor::template apply<Value, WireValue, 4>(field, idxBegin, idxEnd, buffer);
+        }
+        case 5: {
+            return Functor::template apply<Value, WireValue, 5>(field, idxBegin, idxEnd, buffer);
+        }
+        case 6: {
+            return Functor::template apply<Value, WireValue, 6>(field, idxBegin, idxEnd, buffer);
+        }
+        case 7: {
+            return Functor::template apply<Value, WireValue, 7>(field, idxBegin, idxEnd, buffer);
+        }
+        case 8: {
+            return Functor::template apply<Value, WireValue, 8>(field, idxBegin, idxEnd, buffer);
+        }
+        case 9: {
+            return Functor::template apply<Value, WireValue, 9>(field, idxBegin, idxEnd, buffer);
+        }
+        default: {
+            ATLAS_THROW_EXCEPTION("No implementation for rank " + std::to_string(field.rank()));
+        }
+    }
+}
+
+// Determine datatype. Double values are sent as float when asFloat is set.
+template <typename Functor, typename FieldType>
+char* dispatch(FieldType& field, bool asFloat, const idx_t* idxBegin, const idx_t* idxEnd, char* buffer) {
+    // Available datatypes defined in array/LocalView.cc
+    switch (field.datatype().kind()) {
+        case array::DataType::KIND_REAL64: {
+            if (asFloat) {
+                return dispatch<Functor, double, float>(field, idxBegin, idxEnd, buffer);
+            }
+            return dispatch<Functor, double, double>(field, idxBegin, idxEnd, buffer);
+        }
+        case array::DataType::KIND_REAL32: {
+            return dispatch<Functor, float, float>(field, idxBegin, idxEnd, buffer);
+        }
+        case array::DataType::KIND_INT64: {
+            return dispatch<Functor, long, long>(field, idxBegin, idxEnd, buffer);
+        }
+        case array::DataType::KIND_INT32: {
+            return dispatch<Functor, int, int>(field, idxBegin, idxEnd, buffer);
+        }
+        default: {
+            ATLAS_THROW_EXCEPTION("No implementation for data type " + field.datatype().str());
+        }
+    }
+}
+
+// Double fields with metadata "wire_type" set to "float" are sent in single precision.
+bool floatWire(const Field& field) {
+    return field.datatype().kind() == array::DataType::KIND_REAL64 &&
+           field.metadata().getString("wire_type", "native") == "float";
+}
+
+// Number of bytes per column of a field.
+size_t bytesPerColumn(const Field& field) {
+    size_t bytes = floatWire(field) ? sizeof(float) : static_cast<size_t>(field.datatype().size());
+    for (idx_t i = 1; i < field.rank(); ++i) {
+        bytes *= static_cast<size_t>(field.shape(i));
+    }
+    return bytes;
+}
+
+// Number of columns per PE from partial sums.
+std::vector<int> getCounts(const std::vector<int>& disps) {
+    auto counts = std::vector<int>{};
+    counts.reserve(disps.size() - 1);
+    std::adjacent_difference(disps.begin() + 1, disps.end(), std::back_inserter(counts));
+    return counts;
+}
+
 }  // namespace
 
 void RedistributeGeneric::do_setup() {
@@ -270,144 +389,91 @@ void RedistributeGeneric::do_setup() {
     // Get intersection of local UIDs and Global UIDs.
     std::tie(sourceLocalIdx_, sourceDisps_) = getUidIntersection(sourceUidVec, targetGlobalUids, targetGlobalDisps);
     std::tie(targetLocalIdx_, targetDisps_) = getUidIntersection(targetUidVec, sourceGlobalUids, sourceGlobalDisps);
+
+    // Keep only PEs that actually exchange data.
+    exchange_.setup(getCounts(sourceDisps_), getCounts(targetDisps_));
 }
 
 void RedistributeGeneric::execute(const Field& sourceField, Field& targetField) const {
-    //Check functionspaces match.
-    ATLAS_ASSERT(sourceField.functionspace().type() == source().type());
-    ATLAS_ASSERT(targetField.functionspace().type() == target().type());
-
-    // Check Field datatypes match.
-    ATLAS_ASSERT(sourceField.datatype() == targetField.datatype());
-
-    // Check Field ranks match.
-    ATLAS_ASSERT(sourceField.rank() == targetField.rank());
-
-    // Check number of levels and variables match.
-    for (idx_t i = 1; i < sourceField.rank(); ++i) {
-        ATLAS_ASSERT(sourceField.shape(i) == targetField.shape(i));
-    }
-
-    // Perform redistribution.
-    do_execute(sourceField, targetField);
+    auto sourceFieldSet = FieldSet{};
+    sourceFieldSet.add(sourceField);
+    auto targetFieldSet = FieldSet{};
+    targetFieldSet.add(targetField);
+    execute(sourceFieldSet, targetFieldSet);
 }
 
 void RedistributeGeneric::execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
     // Check field set sizes match.
     ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-    // Redistribute fields.
     for (idx_t i = 0; i < sourceFieldSet.size(); ++i) {
-        execute(sourceFieldSet[i], targetFieldSet[i]);
-    }
-}
+        const auto& sourceField = sourceFieldSet[i];
+        const auto& targetField = targetFieldSet[i];
 
-// Determine datatype.
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Available datatypes defined in array/LocalView.cc
-    switch (sourceField.datatype().kind()) {
-        case array::DataType::KIND_REAL64: {
-            return do_execute<double>(sourceField, targetField);
-        }
-        case array::DataType::KIND_REAL32: {
-            return do_execute<float>(sourceField, targetField);
-        }
-        case array::DataType::KIND_INT64: {
-            return do_execute<long>(sourceField, targetField);
-        }
-        case array::DataType::KIND_INT32: {
-            return do_execute<int>(sourceField, targetField);
-        }
-        default: {
-            ATLAS_THROW_EXCEPTION("No implementation for data type " + sourceField.datatype().str());
-        }
-    }
-}
+        //Check functionspaces match.
+        ATLAS_ASSERT(sourceField.functionspace().type() == source().type());
+        ATLAS_ASSERT(targetField.functionspace().type() == target().type());
 
-// Determine rank.
-template <typename Value>
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Available ranks defined in array/LocalView.cc
-    switch (sourceField.rank()) {
-        case 1: {
-            return do_execute<Value, 1>(sourceField, targetField);
-        }
-        case 2: {
-            return do_execute<Value, 2>(sourceField, targetField);
-        }
-        case 3: {
-            return do_execute<Value, 3>(sourceField, targetField);
-        }
-        case 4: {
-            return do_execute<Value, 4>(sourceField, targetField);
-        }
-        case 5: {
-            return do_execute<Value, 5>(sourceField, targetField);
-        }
-        case 6: {
-            return do_execute<Value, 6>(sourceField, targetField);
-        }
-        case 7: {
-            return do_execute<Value, 7>(sourceField, targetField);
-        }
-        case 8: {
-            return do_execute<Value, 8>(sourceField, targetField);
-        }
-        case 9: {
-            return do_execute<Value, 9>(sourceField, targetField);
-        }
-        default: {
-            ATLAS_THROW_EXCEPTION("No implementation for rank " + std::to_string(sourceField.rank()));
+        // Check Field datatypes match.
+        ATLAS_ASSERT(sourceField.datatype() == targetField.datatype());
+
+        // Check Field ranks match.
+        ATLAS_ASSERT(sourceField.rank() == targetField.rank());
+
+        // Check number of levels and variables match.
+        for (idx_t j = 1; j < sourceField.rank(); ++j) {
+            ATLAS_ASSERT(sourceField.shape(j) == targetField.shape(j));
         }
     }
+
+    // Perform redistribution.
+    do_execute(sourceFieldSet, targetFieldSet);
 }
 
 // Perform redistribution.
-template <typename Value, int Rank>
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Get array views.
-    auto sourceView = array::make_view<Value, Rank>(sourceField);
-    auto targetView = array::make_view<Value, Rank>(targetField);
-
-    // Get number of elems per column.
-    int elemsPerCol = 1;
-    for (int i = 1; i < Rank; ++i) {
-        elemsPerCol *= sourceView.shape(i);
+void RedistributeGeneric::do_execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    ATLAS_TRACE("RedistributeGeneric::execute");
+
+    // Get number of bytes per column, summed over all fields.
+    size_t columnBytes = 0;
+    for (const auto& field : sourceFieldSet) {
+        columnBytes += bytesPerColumn(field);
     }
 
-    // Set send displacement and counts vectors.
-    auto sendDisps = std::vector<int>{};
-    sendDisps.reserve(mpi::comm().size() + 1);
-    auto sendCounts = std::vector<int>{};
-    sendCounts.reserve(mpi::comm().size());
-    std::transform(sourceDisps_.begin(), sourceDisps_.end(), std::back_inserter(sendDisps),
-                   [&](const int& disp) { return disp * elemsPerCol; });
-    std::adjacent_difference(sendDisps.begin() + 1, sendDisps.end(), std::back_inserter(sendCounts));
-
-    // Set recv displacement and counts vectors.
-    auto recvDisps = std::vector<int>{};
-    recvDisps.reserve(mpi::comm().size() + 1);
-    auto recvCounts = std::vector<int>{};
-    recvCounts.reserve(mpi::comm().size());
-    std::transform(targetDisps_.begin(), targetDisps_.end(), std::back_inserter(recvDisps),
-                   [&](const int& disp) { return disp * elemsPerCol; });
-    std::adjacent_difference(recvDisps.begin() + 1, recvDisps.end(), std::back_inserter(recvCounts));
-
-    // Allocate send and recv buffers.
-    auto sendBuffer   = std::vector<Value>(static_cast<size_t>(sendDisps.back()));
-    auto recvBuffer   = std::vector<Value>(static_cast<size_t>(recvDisps.back()));
-    auto sendBufferIt = sendBuffer.begin();
-    auto recvBufferIt = recvBuffer.cbegin();
-
-    // Copy sourceField to sendBuffer.
-    ForEach<Rank>::apply(sourceLocalIdx_, sourceView, [&](const Value& elem) { *sendBufferIt++ = elem; });
+    // Allocate send and recv buffers. Buffers only grow.
+    if (sendBuffer_.size() < exchange_.sendSize() * columnBytes) {
+        sendBuffer_.resize(exchange_.sendSize() * columnBytes);
+    }
+    if (recvBuffer_.size() < exchange_.recvSize() * columnBytes) {
+        recvBuffer_.resize(exchange_.recvSize() * columnBytes);
+    }
 
-    // Perform MPI communication.
-    mpi::comm().allToAllv(sendBuffer.data(), sendCounts.data(), sendDisps.data(), recvBuffer.data(), recvCounts.data(),
-                          recvDisps.data());
+    // Copy source fields to sendBuffer, one contiguous block per neighbour.
+    ATLAS_TRACE_SCOPE("pack") {
+        for (const auto& send : exchange_.sends()) {
+            char* buffer          = sendBuffer_.data() + send.offset * columnBytes;
+            const idx_t* idxBegin = sourceLocalIdx_.data() + send.offset;
+            const idx_t* idxEnd   = idxBegin + send.count;
+            for (const auto& field : sourceFieldSet) {
+                buffer = dispatch<Pack>(field, floatWire(field), idxBegin, idxEnd, buffer);
+            }
+        }
+    }
 
-    // Copy recvBuffer to targetField.
-    ForEach<Rank>::apply(targetLocalIdx_, targetView, [&](Value& elem) { elem = *recvBufferIt++; });
+    // Perform MPI communication.
+    exchange_.execute(sendBuffer_.data(), recvBuffer_.data(), columnBytes);
+
+    // Copy recvBuffer to target fields.
+    ATLAS_TRACE_SCOPE("unpack") {
+        for (const auto& recv : exchange_.recvs()) {
+            char* buffer          = recvBuffer_.data() + recv.offset * columnBytes;
+            const idx_t* idxBegin = targetLocalIdx_.data() + recv.offset;
+            const idx_t* idxEnd   = idxBegin + recv.count;
+            for (idx_t i = 0; i < targetFieldSet.size(); ++i) {
+                buffer = dispatch<Unpack>(targetFieldSet[i], floatWire(sourceFieldSet[i]), idxBegin, idxEnd, buffer);
+            }
+        }
+    }
 }
 
 namespace {
@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "atlas/redistribution/detail/RedistributionImpl.h"
+#include "atlas/redistribution/detail/SparseExchange.h"
 
 namespace atlas {
 namespace redistribution {
@@ -26,14 +29,8 @@ public:
     void execute(const FieldSet& source, FieldSet& target) const override;
 
 private:
-    // Determine datatype.
-    void do_execute(const Field& source, Field& target) const;
-    // Determine rank.
-    template <typename Value>
-    void do_execute(const Field& source, Field& target) const;
-    // Perform redistribution.
-    template <typename Value, int Rank>
-    void do_execute(const Field& source, Field& target) const;
+    // Pack, exchange and unpack all fields in a single message per neighbour.
+    void do_execute(const FieldSet& source, FieldSet& target) const;
 
     // Local indices to send to each PE
     std::vector<idx_t> sourceLocalIdx_{};
@@ -46,6 +43,13 @@ private:
 
     // Partial sum of number of columns to receive from each PE.
     std::vector<int> targetDisps_{};
+
+    // Point-to-point exchange with PEs that share columns.
+    SparseExchange exchange_{};
+
+    // Send and receive buffers, kept between executions.
+    mutable std::vector<char> sendBuffer_{};
+    mutable std::vector<char> recvBuffer_{};
 };
 
 }  // namespace detail
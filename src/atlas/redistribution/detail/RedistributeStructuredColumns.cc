@@ -8,6 +8,7 @@
 #include "RedistributeStructuredColumns.h"
 
 #include <algorithm>
+#include <cstring>
 #include <numeric>
 
 #include "atlas/array/MakeView.h"
@@ -16,6 +17,7 @@
 #include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
 
 namespace atlas {
 namespace redistribution {
@@ -37,17 +39,6 @@ std::vector<outType> transformVector(const std::vector<inType>& inVector, const
     return outVector;
 }
 
-// Visit each index in a StructuredIndexRangeVector.
-template <typename functorType>
-void forEachIndex(const StructuredIndexRangeVector& ranges, const functorType& functor) {
-    // Loop over all ranges.
-    std::for_each(ranges.cbegin(), ranges.cend(), [&](const StructuredIndexRange& range) {
-        range.forEach(functor);
-        return;
-    });
-    return;
-}
-
 }  // namespace
 
 //========================================================================
@@ -90,21 +81,14 @@ void RedistributeStructuredColumns::do_setup() {
     recvIntersections_ = getIntersections(targetRange, sourceRanges);
 
 
-    // Get counts and displacements for MPI communication.
-    auto getCountsDisplacements = [](const StructuredIndexRangeVector& intersections, const idx_t levels) {
-        const auto counts = transformVector<int>(intersections, [&](const StructuredIndexRange& intersection) {
-            return static_cast<int>(intersection.getElemCount() * levels);
+    // Get number of columns to send and receive for each PE.
+    auto getCounts = [](const StructuredIndexRangeVector& intersections) {
+        return transformVector<int>(intersections, [&](const StructuredIndexRange& intersection) {
+            return static_cast<int>(intersection.getElemCount());
         });
-
-        auto displacements = std::vector<int>{0};
-        std::partial_sum(counts.cbegin(), counts.cend() - 1, std::back_inserter(displacements));
-
-        return std::make_pair(counts, displacements);
     };
 
-    std::tie(sendCounts_, sendDisplacements_) = getCountsDisplacements(sendIntersections_, source_.levels());
-
-    std::tie(recvCounts_, recvDisplacements_) = getCountsDisplacements(recvIntersections_, target_.levels());
+    exchange_.setup(getCounts(sendIntersections_), getCounts(recvIntersections_));
 
 
     // Trim off invalid intersections.
@@ -124,39 +108,11 @@ void RedistributeStructuredColumns::do_setup() {
 }
 
 void RedistributeStructuredColumns::execute(const Field& sourceField, Field& targetField) const {
-    // Assert that fields are defined on StructuredColumns.
-    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()));
-    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()));
-
-    // Check that grids match.
-    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()).grid().name() == source_.grid().name());
-    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()).grid().name() == target_.grid().name());
-
-    // Check levels match.
-    ATLAS_ASSERT(sourceField.levels() == source_.levels());
-    ATLAS_ASSERT(targetField.levels() == target_.levels());
-
-    // Determine data type of field and execute.
-    switch (sourceField.datatype().kind()) {
-        case array::DataType::KIND_REAL64:
-            do_execute<double>(sourceField, targetField);
-            break;
-
-        case array::DataType::KIND_REAL32:
-            do_execute<float>(sourceField, targetField);
-            break;
-
-        case array::DataType::KIND_INT32:
-            do_execute<int>(sourceField, targetField);
-            break;
-
-        case array::DataType::KIND_INT64:
-            do_execute<long>(sourceField, targetField);
-            break;
-
-        default:
-            throw_NotImplemented("No implementation for data type " + sourceField.datatype().str(), Here());
-    }
+    auto sourceFieldSet = FieldSet{};
+    sourceFieldSet.add(sourceField);
+    auto targetFieldSet = FieldSet{};
+    targetFieldSet.add(targetField);
+    execute(sourceFieldSet, targetFieldSet);
 
     return;
 }
@@ -165,12 +121,31 @@ void RedistributeStructuredColumns::execute(const FieldSet& sourceFieldSet, Fiel
     // Check that both FieldSets are the same size.
     ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-    auto targetFieldSetIt = targetFieldSet.begin();
+    auto targetFieldSetIt = targetFieldSet.cbegin();
     std::for_each(sourceFieldSet.cbegin(), sourceFieldSet.cend(), [&](const Field& sourceField) {
-        execute(sourceField, *targetFieldSetIt++);
+        const Field& targetField = *targetFieldSetIt++;
+
+        // Assert that fields are defined on StructuredColumns.
+        ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()));
+        ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()));
+
+        // Check that grids match.
+        ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()).grid().name() ==
+                     source_.grid().name());
+        ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()).grid().name() ==
+                     target_.grid().name());
+
+        // Check levels match.
+        ATLAS_ASSERT(sourceField.levels() == source_.levels());
+        ATLAS_ASSERT(targetField.levels() == target_.levels());
+
+        // Check datatypes match.
+        ATLAS_ASSERT(sourceField.datatype() == targetField.datatype());
         return;
     });
 
+    do_execute(sourceFieldSet, targetFieldSet);
+
     return;
 }
 
@@ -178,60 +153,128 @@ void RedistributeStructuredColumns::execute(const FieldSet& sourceFieldSet, Fiel
 // Class private methods implementation.
 //========================================================================
 
-template <typename fieldType>
-void RedistributeStructuredColumns::do_execute(const Field& sourceField, Field& targetField) const {
-    // Make Atlas view objects.
-    const auto sourceView = array::make_view<fieldType, 2>(sourceField);
-    auto targetView       = array::make_view<fieldType, 2>(targetField);
+void RedistributeStructuredColumns::do_execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    ATLAS_TRACE("RedistributeStructuredColumns::execute");
+
+    // Get number of bytes per column, summed over all fields.
+    size_t columnBytes = 0;
+    std::for_each(sourceFieldSet.cbegin(), sourceFieldSet.cend(), [&](const Field& sourceField) {
+        columnBytes += static_cast<size_t>(sourceField.datatype().size() * source_.levels());
+        return;
+    });
+
 
+    // Allocate send and receive buffers. Buffers only grow.
+    if (sendBuffer_.size() < exchange_.sendSize() * columnBytes) {
+        sendBuffer_.resize(exchange_.sendSize() * columnBytes);
+    }
+    if (recvBuffer_.size() < exchange_.recvSize() * columnBytes) {
+        recvBuffer_.resize(exchange_.recvSize() * columnBytes);
+    }
+
+
+    // Determine data type of field and pack or unpack.
+    auto pack = [&](const Field& sourceField, const StructuredIndexRange& range, char* buffer) -> char* {
+        switch (sourceField.datatype().kind()) {
+            case array::DataType::KIND_REAL64:
+                return do_pack<double>(sourceField, range, buffer);
+            case array::DataType::KIND_REAL32:
+                return do_pack<float>(sourceField, range, buffer);
+            case array::DataType::KIND_INT32:
+                return do_pack<int>(sourceField, range, buffer);
+            case array::DataType::KIND_INT64:
+                return do_pack<long>(sourceField, range, buffer);
+            default:
+                throw_NotImplemented("No implementation for data type " + sourceField.datatype().str(), Here());
+        }
+    };
+
+    auto unpack = [&](Field& targetField, const StructuredIndexRange& range, char* buffer) -> char* {
+        switch (targetField.datatype().kind()) {
+            case array::DataType::KIND_REAL64:
+                return do_unpack<double>(targetField, range, buffer);
+            case array::DataType::KIND_REAL32:
+                return do_unpack<float>(targetField, range, buffer);
+            case array::DataType::KIND_INT32:
+                return do_unpack<int>(targetField, range, buffer);
+            case array::DataType::KIND_INT64:
+                return do_unpack<long>(targetField, range, buffer);
+            default:
+                throw_NotImplemented("No implementation for data type " + targetField.datatype().str(), Here());
+        }
+    };
 
-    // Get buffer sizes.
-    const auto nSend = sendCounts_.back() + sendDisplacements_.back();
-    const auto nRecv = recvCounts_.back() + recvDisplacements_.back();
 
+    // Write data to buffer, one contiguous block per neighbour.
+    const auto& sends = exchange_.sends();
+    for (size_t n = 0; n < sends.size(); ++n) {
+        char* buffer = sendBuffer_.data() + sends[n].offset * columnBytes;
+        std::for_each(sourceFieldSet.cbegin(), sourceFieldSet.cend(), [&](const Field& sourceField) {
+            buffer = pack(sourceField, sendIntersections_[n], buffer);
+            return;
+        });
+    }
 
-    // Allocate send and receive buffers.
-    auto sendBuffer = std::vector<fieldType>(static_cast<size_t>(nSend));
-    auto recvBuffer = std::vector<fieldType>(static_cast<size_t>(nRecv));
+    // Communicate.
+    exchange_.execute(sendBuffer_.data(), recvBuffer_.data(), columnBytes);
 
+    // Read data from buffer.
+    const auto& recvs = exchange_.recvs();
+    for (size_t n = 0; n < recvs.size(); ++n) {
+        char* buffer = recvBuffer_.data() + recvs[n].offset * columnBytes;
+        std::for_each(targetFieldSet.begin(), targetFieldSet.end(), [&](Field& targetField) {
+            buffer = unpack(targetField, recvIntersections_[n], buffer);
+            return;
+        });
+    }
+
+    return;
+}
+
+template <typename fieldType>
+char* RedistributeStructuredColumns::do_pack(const Field& sourceField, const StructuredIndexRange& range,
+                                             char* buffer) const {
+    // Make Atlas view object.
+    const auto sourceView = array::make_view<fieldType, 2>(sourceField);
 
     // Set send functor.
-    auto sendBufferIt = sendBuffer.begin();
-    auto sendFunctor  = [&](const idx_t i, const idx_t j) {
+    auto sendFunctor = [&](const idx_t i, const idx_t j) {
         // Loop over levels
         const auto iNode = source_.index(i, j);
         const auto kEnd  = source_.levels();
         for (idx_t k = 0; k < kEnd; ++k) {
-            *sendBufferIt++ = sourceView(iNode, k);
+            std::memcpy(buffer, &sourceView(iNode, k), sizeof(fieldType));
+            buffer += sizeof(fieldType);
         }
         return;
     };
 
+    range.forEach(sendFunctor);
+
+    return buffer;
+}
+
+template <typename fieldType>
+char* RedistributeStructuredColumns::do_unpack(Field& targetField, const StructuredIndexRange& range,
+                                               char* buffer) const {
+    // Make Atlas view object.
+    auto targetView = array::make_view<fieldType, 2>(targetField);
 
     // Set receive functor.
-    auto recvBufferIt = recvBuffer.cbegin();
-    auto recvFunctor  = [&](const idx_t i, const idx_t j) {
+    auto recvFunctor = [&](const idx_t i, const idx_t j) {
         // Loop over levels
         const auto iNode = target_.index(i, j);
         const auto kEnd  = target_.levels();
         for (idx_t k = 0; k < kEnd; ++k) {
-            targetView(iNode, k) = *recvBufferIt++;
+            std::memcpy(&targetView(iNode, k), buffer, sizeof(fieldType));
+            buffer += sizeof(fieldType);
         }
         return;
     };
 
+    range.forEach(recvFunctor);
 
-    // Write data to buffer.
-    forEachIndex(sendIntersections_, sendFunctor);
-
-    // Communicate.
-    mpi::comm().allToAllv(sendBuffer.data(), sendCounts_.data(), sendDisplacements_.data(), recvBuffer.data(),
-                          recvCounts_.data(), recvDisplacements_.data());
-
-    // Read data from buffer.
-    forEachIndex(recvIntersections_, recvFunctor);
-
-    return;
+    return buffer;
 }
 
 //========================================================================
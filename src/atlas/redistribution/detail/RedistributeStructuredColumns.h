@@ -11,6 +11,7 @@
 
 #include "atlas/redistribution/detail/RedistributionImpl.h"
 #include "atlas/redistribution/detail/RedistributionImplFactory.h"
+#include "atlas/redistribution/detail/SparseExchange.h"
 
 
 namespace atlas {
@@ -56,8 +57,8 @@ public:
 
     /// \brief    Redistributes source field to target field.
     ///
-    /// \details  Transfers source field to target field via an
-    ///           MPI_Alltoallv. Function space of source field must match
+    /// \details  Transfers source field to target field via point-to-point
+    ///           messages between PEs that share data. Function space of source field must match
     ///           sourceFunctionSpace supplied to the constructor. Same
     ///           applies to target field.
     ///
@@ -67,31 +68,39 @@ public:
 
     /// \brief    Redistributes source field set to target fields set.
     ///
-    /// \details  Transfers source field set to target field set via
-    ///           multiple invocations of execute(sourceField, targetField).
+    /// \details  Transfers source field set to target field set. All fields
+    ///           are packed together, with one message per pair of PEs.
     ///
     /// \param[in]  source  input field set.
     /// \param[out] target  output field set.
     void execute(const FieldSet& source, FieldSet& target) const override;
 
 private:
-    // Generic execute call to handle different field types.
+    // Pack all fields, exchange and unpack.
+    void do_execute(const FieldSet& source, FieldSet& target) const;
+
+    // Copy field values of an index range to buffer. Returns end of written buffer.
+    template <typename fieldType>
+    char* do_pack(const Field& source, const StructuredIndexRange& range, char* buffer) const;
+
+    // Copy buffer to field values of an index range. Returns end of read buffer.
     template <typename fieldType>
-    void do_execute(const Field& source, Field& target) const;
+    char* do_unpack(Field& target, const StructuredIndexRange& range, char* buffer) const;
 
     // FunctionSpaces recast to StructuredColumns.
     functionspace::StructuredColumns source_;
     functionspace::StructuredColumns target_;
 
-    // Vectors of index range intersection objects.
+    // Vectors of non-empty index range intersection objects, one per neighbour PE.
     StructuredIndexRangeVector sendIntersections_{};
     StructuredIndexRangeVector recvIntersections_{};
 
-    // Counts and displacements for MPI communications.
-    std::vector<int> sendCounts_{};
-    std::vector<int> sendDisplacements_{};
-    std::vector<int> recvCounts_{};
-    std::vector<int> recvDisplacements_{};
+    // Point-to-point exchange with PEs that share data.
+    SparseExchange exchange_{};
+
+    // Send and receive buffers, kept between executions.
+    mutable std::vector<char> sendBuffer_{};
+    mutable std::vector<char> recvBuffer_{};
 };
 
 /// \brief    Helper class for function space intersections.
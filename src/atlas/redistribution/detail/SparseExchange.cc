@@ -0,0 +1,104 @@
+/*
+ * (C) Crown Copyright 2021 Met Office
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "atlas/redistribution/detail/SparseExchange.h"
+
+#include <cstring>
+#include <limits>
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace redistribution {
+namespace detail {
+
+namespace {
+
+// Tag distinguishing redistribution messages from halo exchanges.
+constexpr int tag = 2;
+
+std::vector<SparseExchange::Neighbour> makeNeighbours(const std::vector<int>& counts, size_t& size) {
+    auto neighbours = std::vector<SparseExchange::Neighbour>{};
+    size            = 0;
+    for (size_t rank = 0; rank < counts.size(); ++rank) {
+        if (counts[rank] > 0) {
+            neighbours.push_back({static_cast<int>(rank), size, static_cast<size_t>(counts[rank])});
+            size += static_cast<size_t>(counts[rank]);
+        }
+    }
+    return neighbours;
+}
+
+}  // namespace
+
+void SparseExchange::setup(const std::vector<int>& sendCounts, const std::vector<int>& recvCounts) {
+    ATLAS_ASSERT(sendCounts.size() == mpi::comm().size());
+    ATLAS_ASSERT(recvCounts.size() == mpi::comm().size());
+    sends_ = makeNeighbours(sendCounts, sendSize_);
+    recvs_ = makeNeighbours(recvCounts, recvSize_);
+}
+
+void SparseExchange::execute(const char* sendBuffer, char* recvBuffer, size_t bytesPerColumn) const {
+    const int myRank = static_cast<int>(mpi::comm().rank());
+
+    auto validMessageSize = [](size_t size) { return size < size_t(std::numeric_limits<int>::max()); };
+
+    auto recvRequests = std::vector<eckit::mpi::Request>{};
+    recvRequests.reserve(recvs_.size());
+    auto sendRequests = std::vector<eckit::mpi::Request>{};
+    sendRequests.reserve(sends_.size());
+
+    ATLAS_TRACE_MPI(IRECEIVE) {
+        for (const auto& recv : recvs_) {
+            if (recv.rank != myRank) {
+                ATLAS_ASSERT(validMessageSize(recv.count * bytesPerColumn));
+                recvRequests.push_back(mpi::comm().iReceive(recvBuffer + recv.offset * bytesPerColumn,
+                                                            recv.count * bytesPerColumn, recv.rank, tag));
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI(ISEND) {
+        for (const auto& send : sends_) {
+            if (send.rank != myRank) {
+                ATLAS_ASSERT(validMessageSize(send.count * bytesPerColumn));
+                sendRequests.push_back(mpi::comm().iSend(sendBuffer + send.offset * bytesPerColumn,
+                                                         send.count * bytesPerColumn, send.rank, tag));
+            }
+        }
+    }
+
+    // Data that stays on this PE does not go through MPI.
+    for (const auto& send : sends_) {
+        if (send.rank == myRank) {
+            for (const auto& recv : recvs_) {
+                if (recv.rank == myRank) {
+                    ATLAS_ASSERT(recv.count == send.count);
+                    std::memcpy(recvBuffer + recv.offset * bytesPerColumn, sendBuffer + send.offset * bytesPerColumn,
+                                send.count * bytesPerColumn);
+                }
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI(WAIT, "mpi-wait receive") {
+        for (auto& request : recvRequests) {
+            mpi::comm().wait(request);
+        }
+    }
+    ATLAS_TRACE_MPI(WAIT, "mpi-wait send") {
+        for (auto& request : sendRequests) {
+            mpi::comm().wait(request);
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace redistribution
+}  // namespace atlas
@@ -0,0 +1,72 @@
+/*
+ * (C) Crown Copyright 2021 Met Office
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace atlas {
+namespace redistribution {
+namespace detail {
+
+/// \brief    Point-to-point exchange plan between PEs that share data.
+///
+/// \details  Set up once from the number of columns to send to and receive
+///           from every PE. Only PEs with a non-zero count are kept, so that
+///           an exchange costs one message per neighbour rather than an
+///           MPI_Alltoallv over all PEs. Messages are packed byte buffers in
+///           which the columns of every neighbour are contiguous, so that an
+///           arbitrary number of fields can be sent in a single message.
+class SparseExchange {
+public:
+    /// \brief  Neighbour PE with offset and count (in columns) into the packed buffer.
+    struct Neighbour {
+        int rank;
+        size_t offset;
+        size_t count;
+    };
+
+    SparseExchange() = default;
+
+    /// \brief    Set up exchange plan.
+    ///
+    /// \param[in]  sendCounts  number of columns to send to each PE.
+    /// \param[in]  recvCounts  number of columns to receive from each PE.
+    void setup(const std::vector<int>& sendCounts, const std::vector<int>& recvCounts);
+
+    /// \brief  PEs to send to, in order of increasing rank.
+    const std::vector<Neighbour>& sends() const { return sends_; }
+
+    /// \brief  PEs to receive from, in order of increasing rank.
+    const std::vector<Neighbour>& recvs() const { return recvs_; }
+
+    /// \brief  Total number of columns to send.
+    size_t sendSize() const { return sendSize_; }
+
+    /// \brief  Total number of columns to receive.
+    size_t recvSize() const { return recvSize_; }
+
+    /// \brief    Exchange packed buffers.
+    ///
+    /// \details  Data destined to this PE is copied without MPI.
+    ///
+    /// \param[in]  sendBuffer      buffer of at least sendSize() * bytesPerColumn bytes.
+    /// \param[out] recvBuffer      buffer of at least recvSize() * bytesPerColumn bytes.
+    /// \param[in]  bytesPerColumn  number of bytes per column, summed over all packed fields.
+    void execute(const char* sendBuffer, char* recvBuffer, size_t bytesPerColumn) const;
+
+private:
+    std::vector<Neighbour> sends_{};
+    std::vector<Neighbour> recvs_{};
+    size_t sendSize_{0};
+    size_t recvSize_{0};
+};
+
+}  // namespace detail
+}  // namespace redistribution
+}  // namespace atlas
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <cstring>
 
 #include "atlas/util/Checksum.h"
 
@@ -29,6 +30,26 @@ static uint16_t fletcher16(const uint8_t* data, int size) {
     return s2;
 }
 
+// Finaliser of the splitmix64 generator, a fast 64-bit mixing function with good avalanche behaviour
+inline uint64_t mix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+template <typename T>
+checksum_t hash_values(const T values[], size_t size, checksum_t key) {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "unsupported type");
+    uint64_t h = mix64(key);
+    for (size_t i = 0; i < size; ++i) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &values[i], sizeof(T));
+        h = mix64(h ^ bits);
+    }
+    return h;
+}
+
 }  // namespace
 
 static checksum_t checksum(const char* data, size_t size) {
@@ -59,5 +80,21 @@ checksum_t checksum(const checksum_t values[], size_t size) {
     return checksum(reinterpret_cast<const char*>(&values[0]), size * sizeof(checksum_t) / sizeof(char));
 }
 
+checksum_t hash(const int values[], size_t size, checksum_t key) {
+    return hash_values(values, size, key);
+}
+
+checksum_t hash(const long values[], size_t size, checksum_t key) {
+    return hash_values(values, size, key);
+}
+
+checksum_t hash(const float values[], size_t size, checksum_t key) {
+    return hash_values(values, size, key);
+}
+
+checksum_t hash(const double values[], size_t size, checksum_t key) {
+    return hash_values(values, size, key);
+}
+
 }  // namespace util
 }  // namespace atlas
@@ -23,5 +23,14 @@ checksum_t checksum(const float values[], size_t size);
 checksum_t checksum(const double values[], size_t size);
 checksum_t checksum(const checksum_t values[], size_t size);
 
+/// @brief 64-bit hash of given values, seeded with a key such as a global index
+///
+/// Hashes of distinct keys can be combined with a commutative operation (e.g. a sum modulo 2^64)
+/// into a checksum that does not depend on the order or distribution of the keys.
+checksum_t hash(const int values[], size_t size, checksum_t key);
+checksum_t hash(const long values[], size_t size, checksum_t key);
+checksum_t hash(const float values[], size_t size, checksum_t key);
+checksum_t hash(const double values[], size_t size, checksum_t key);
+
 }  // namespace util
 }  // namespace atlas
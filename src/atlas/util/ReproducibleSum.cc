@@ -0,0 +1,171 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/ReproducibleSum.h"
+
+#include <cmath>
+#include <limits>
+
+namespace atlas {
+namespace util {
+
+namespace {
+
+// Bit 0 of the fixed-point representation has value 2^MIN_EXPONENT, the smallest subnormal double
+constexpr int MIN_EXPONENT = -1074;
+
+constexpr std::uint64_t LIMB_MASK = (std::uint64_t(1) << ReproducibleSum::LIMB_BITS) - 1;
+
+// Each addition contributes less than 2^LIMB_BITS to a limb; normalise well before a limb could overflow
+constexpr ReproducibleSum::limb_t MAX_PENDING = ReproducibleSum::limb_t(1) << 29;
+
+// Floor division by 2^LIMB_BITS, well defined for negative values
+inline ReproducibleSum::limb_t carry_of(ReproducibleSum::limb_t limb) {
+    return limb >= 0 ? (limb >> ReproducibleSum::LIMB_BITS)
+                     : -((-limb + ReproducibleSum::limb_t(LIMB_MASK)) >> ReproducibleSum::LIMB_BITS);
+}
+
+}  // namespace
+
+void ReproducibleSum::reset() {
+    limbs_.fill(0);
+    nonfinite_ = 0.;
+    pending_   = 0;
+}
+
+void ReproducibleSum::add(double x) {
+    if (x == 0.) {
+        return;
+    }
+    if (!std::isfinite(x)) {
+        nonfinite_ += x;
+        return;
+    }
+
+    // |x| = m * 2^e, with m an integer of at most 53 bits
+    int exponent;
+    const double fraction = std::frexp(std::abs(x), &exponent);
+    std::uint64_t m       = static_cast<std::uint64_t>(std::ldexp(fraction, 53));
+    int e                 = exponent - 53;
+    if (e < MIN_EXPONENT) {
+        // subnormal: the dropped bits are zero
+        m >>= (MIN_EXPONENT - e);
+        e = MIN_EXPONENT;
+    }
+
+    const int bit   = e - MIN_EXPONENT;
+    const int limb  = bit / LIMB_BITS;
+    const int shift = bit % LIMB_BITS;
+
+    const std::uint64_t part0 = (m & (LIMB_MASK >> shift)) << shift;
+    const std::uint64_t rest  = m >> (LIMB_BITS - shift);
+    const std::uint64_t part1 = rest & LIMB_MASK;
+    const std::uint64_t part2 = rest >> LIMB_BITS;
+
+    if (x > 0.) {
+        limbs_[limb] += limb_t(part0);
+        limbs_[limb + 1] += limb_t(part1);
+        limbs_[limb + 2] += limb_t(part2);
+    }
+    else {
+        limbs_[limb] -= limb_t(part0);
+        limbs_[limb + 1] -= limb_t(part1);
+        limbs_[limb + 2] -= limb_t(part2);
+    }
+
+    if (++pending_ == MAX_PENDING) {
+        normalise();
+    }
+}
+
+ReproducibleSum& ReproducibleSum::operator+=(const ReproducibleSum& other) {
+    ReproducibleSum rhs(other);
+    rhs.normalise();
+    normalise();
+    for (int i = 0; i < NB_LIMBS; ++i) {
+        limbs_[i] += rhs.limbs_[i];
+    }
+    nonfinite_ += rhs.nonfinite_;
+    pending_ = 2;
+    return *this;
+}
+
+void ReproducibleSum::normalise() {
+    for (int i = 0; i < NB_LIMBS - 1; ++i) {
+        const limb_t carry = carry_of(limbs_[i]);
+        limbs_[i] -= carry * (limb_t(1) << LIMB_BITS);
+        limbs_[i + 1] += carry;
+    }
+    pending_ = 0;
+}
+
+double ReproducibleSum::value() const {
+    if (nonfinite_ != 0. || std::isnan(nonfinite_)) {
+        return nonfinite_;
+    }
+
+    // Canonical representation of the magnitude: all limbs in [0, 2^LIMB_BITS)
+    ReproducibleSum s(*this);
+    s.normalise();
+    double sign = 1.;
+    if (s.limbs_[NB_LIMBS - 1] < 0) {
+        sign = -1.;
+        for (auto& limb : s.limbs_) {
+            limb = -limb;
+        }
+        s.normalise();
+    }
+
+    int top = NB_LIMBS - 1;
+    while (top >= 0 && s.limbs_[top] == 0) {
+        --top;
+    }
+    if (top < 0) {
+        return 0.;
+    }
+    if (std::uint64_t(s.limbs_[top]) > LIMB_MASK) {
+        // only reachable far beyond the double range
+        return sign * std::numeric_limits<double>::infinity();
+    }
+
+    // Window of the 64 most significant bits, with its leading bit set, and a sticky bit for all bits below it
+    auto limb = [&s](int i) { return i >= 0 ? std::uint64_t(s.limbs_[i]) : std::uint64_t(0); };
+    int lz    = 0;
+    while ((limb(top) << lz) < (std::uint64_t(1) << (LIMB_BITS - 1))) {
+        ++lz;
+    }
+    std::uint64_t window = (limb(top) << (LIMB_BITS + lz)) | (limb(top - 1) << lz);
+    bool sticky          = false;
+    if (lz > 0) {
+        window |= limb(top - 2) >> (LIMB_BITS - lz);
+        sticky = (limb(top - 2) & (LIMB_MASK >> lz)) != 0;
+    }
+    else {
+        sticky = limb(top - 2) != 0;
+    }
+    for (int i = top - 3; i >= 0 && !sticky; --i) {
+        sticky = s.limbs_[i] != 0;
+    }
+    const int exponent = MIN_EXPONENT + (top - 1) * LIMB_BITS - lz;  // value of bit 0 of the window
+
+    // Round the window to the 53 bits of a double, to nearest with ties to even. Below the normal range the
+    // window holds at most 53 significant bits, so that the rounding and ldexp are both exact there.
+    constexpr int DROPPED        = 64 - 53;
+    constexpr std::uint64_t HALF = std::uint64_t(1) << (DROPPED - 1);
+    std::uint64_t mantissa       = window >> DROPPED;
+    const std::uint64_t rest     = window & ((std::uint64_t(1) << DROPPED) - 1);
+    if (rest > HALF || (rest == HALF && (sticky || (mantissa & 1)))) {
+        ++mantissa;  // may become 2^53, which is still exact
+    }
+    return sign * std::ldexp(double(mantissa), exponent + DROPPED);
+}
+
+}  // namespace util
+}  // namespace atlas
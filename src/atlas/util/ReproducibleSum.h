@@ -0,0 +1,87 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace atlas {
+namespace util {
+
+// -------------------------------------------------------------------------------------
+
+/// @brief Exact accumulator for floating point sums, with a result independent of summation order
+///
+/// Every added value is accumulated exactly in a fixed-point representation that spans the entire
+/// double precision range (a "superaccumulator"). The accumulated value therefore does not depend on
+/// the order in which values are added, nor on how the values are split over threads or MPI tasks
+/// before partial accumulators are combined.
+///
+/// The accumulator is stored as an array of 64-bit integer limbs, each holding 32 bits of the
+/// fixed-point number, which leaves headroom for carries. Partial accumulators of different tasks can
+/// hence be combined by summing their limbs element-wise, e.g. with an MPI allReduce on data().
+/// Non-finite values (inf, nan) are accumulated separately with regular arithmetic, which for these
+/// values is also order independent.
+///
+/// The returned value() is the exact sum, correctly rounded to double precision (to nearest, ties to
+/// even). It only depends on the exact sum, so it is reproducible.
+class ReproducibleSum {
+public:
+    using limb_t = std::int64_t;
+
+    static constexpr int LIMB_BITS = 32;
+    static constexpr int NB_LIMBS  = 68;  // covers exponents [-1074,1024) plus headroom for carries
+
+    /// Number of values in the serialised representation, see data()
+    static constexpr size_t size() { return NB_LIMBS; }
+
+public:
+    ReproducibleSum() { reset(); }
+
+    void reset();
+
+    /// Add a value exactly
+    void add(double x);
+
+    ReproducibleSum& operator+=(double x) {
+        add(x);
+        return *this;
+    }
+
+    /// Combine with another (partial) accumulator
+    ReproducibleSum& operator+=(const ReproducibleSum& other);
+
+    /// Return the exact sum, correctly rounded to double precision
+    double value() const;
+
+    /// Propagate carries so that every limb except the most significant is in [0, 2^LIMB_BITS).
+    /// This is required before the limbs are reduced with those of other accumulators.
+    void normalise();
+
+    /// Access to the limbs, e.g. to sum partial accumulators with MPI, after normalise()
+    const limb_t* data() const { return limbs_.data(); }
+    limb_t* data() { return limbs_.data(); }
+
+    /// Accumulated non-finite values; to be reduced along with data()
+    double nonfinite() const { return nonfinite_; }
+    double& nonfinite() { return nonfinite_; }
+
+private:
+    std::array<limb_t, NB_LIMBS> limbs_;
+    double nonfinite_;
+    limb_t pending_;  // number of additions since last normalise()
+};
+
+// -------------------------------------------------------------------------------------
+
+}  // namespace util
+}  // namespace atlas
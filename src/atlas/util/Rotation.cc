@@ -210,5 +210,62 @@ void Rotation::unrotate(double crd[]) const {
     crd[LON] += angle_;
 }
 
+void Rotation::rotate(double crd[], idx_t n) const {
+    if (!rotated_) {
+        return;
+    }
+
+    if (rotation_angle_only_) {
+        for (idx_t i = 0; i < n; ++i) {
+            crd[2 * i + LON] -= angle_;
+        }
+        return;
+    }
+
+    for (idx_t i = 0; i < n; ++i) {
+        double* p = crd + 2 * i;
+        p[LON] -= angle_;
+
+        const PointLonLat L(wrap_latitude({p[LON], p[LAT]}));
+        PointXYZ P;
+        UnitSphere::convertSphericalToCartesian(L, P);
+
+        const PointXYZ Pt = rotate_geocentric(P, rotate_);
+        PointLonLat Lt;
+        UnitSphere::convertCartesianToSpherical(Pt, Lt);
+
+        p[LON] = Lt.lon();
+        p[LAT] = Lt.lat();
+    }
+}
+
+void Rotation::unrotate(double crd[], idx_t n) const {
+    if (!rotated_) {
+        return;
+    }
+
+    if (rotation_angle_only_) {
+        for (idx_t i = 0; i < n; ++i) {
+            crd[2 * i + LON] += angle_;
+        }
+        return;
+    }
+
+    for (idx_t i = 0; i < n; ++i) {
+        double* p = crd + 2 * i;
+
+        const PointLonLat Lt(p);
+        PointXYZ Pt;
+        UnitSphere::convertSphericalToCartesian(Lt, Pt);
+
+        const PointXYZ P = rotate_geocentric(Pt, unrotate_);
+        PointLonLat L;
+        UnitSphere::convertCartesianToSpherical(P, L);
+
+        p[LON] = L.lon() + angle_;
+        p[LAT] = L.lat();
+    }
+}
+
 }  // namespace util
 }  // namespace atlas
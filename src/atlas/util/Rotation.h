@@ -13,6 +13,7 @@
 #include <array>
 #include <iosfwd>
 
+#include "atlas/library/config.h"
 #include "atlas/util/Point.h"
 
 namespace eckit {
@@ -40,6 +41,10 @@ public:
     void rotate(double crd[]) const;
     void unrotate(double crd[]) const;
 
+    // Rotate n points stored as consecutive (lon,lat) pairs
+    void rotate(double crd[], idx_t n) const;
+    void unrotate(double crd[], idx_t n) const;
+
 private:
     void precompute();
 
@@ -0,0 +1,92 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/SharedObjects.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "eckit/config/Resource.h"
+
+namespace atlas {
+namespace util {
+
+namespace {
+
+std::atomic<bool>& enabled_flag() {
+    static std::atomic<bool> flag{eckit::Resource<bool>("atlasSharedObjects;$ATLAS_SHARED_OBJECTS", false)};
+    return flag;
+}
+
+template <typename Registration>
+struct Registry {
+    std::mutex lock;
+    std::vector<Registration*> caches;
+
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+};
+
+}  // namespace
+
+SharedObjects::Registration::Registration() {
+    auto& registry = Registry<Registration>::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.caches.emplace_back(this);
+}
+
+SharedObjects::Registration::~Registration() {
+    auto& registry = Registry<Registration>::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.caches.erase(std::remove(registry.caches.begin(), registry.caches.end(), this), registry.caches.end());
+}
+
+bool SharedObjects::enabled() {
+    return enabled_flag();
+}
+
+void SharedObjects::enable(bool value) {
+    enabled_flag() = value;
+}
+
+size_t SharedObjects::size() {
+    auto& registry = Registry<Registration>::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    size_t n = 0;
+    for (auto* cache : registry.caches) {
+        n += cache->size();
+    }
+    return n;
+}
+
+size_t SharedObjects::footprint() {
+    auto& registry = Registry<Registration>::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    size_t bytes = 0;
+    for (auto* cache : registry.caches) {
+        bytes += cache->footprint();
+    }
+    return bytes;
+}
+
+void SharedObjects::clear() {
+    auto& registry = Registry<Registration>::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (auto* cache : registry.caches) {
+        cache->clear();
+    }
+}
+
+}  // namespace util
+}  // namespace atlas
@@ -0,0 +1,75 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "atlas/util/detail/Cache.h"
+
+namespace atlas {
+namespace util {
+
+// -------------------------------------------------------------------------------------
+
+/// @brief Process-wide sharing of immutable objects that are expensive to construct
+///
+/// When enabled, equal requests for grids created by name or configuration, for distributions
+/// created from a partitioner configuration, and for StructuredColumns function spaces return the
+/// same shared object instead of constructing a new one. Shared objects stay alive until clear() is
+/// called, even when no longer referenced elsewhere.
+///
+/// Sharing is disabled by default. It is enabled with the environment variable ATLAS_SHARED_OBJECTS=1,
+/// or with SharedObjects::enable(). All MPI tasks must make the same choice.
+class SharedObjects {
+public:
+    static bool enabled();
+    static void enable(bool = true);
+
+    /// @brief Number of shared objects currently held
+    static size_t size();
+
+    /// @brief Memory footprint of the shared objects currently held
+    static size_t footprint();
+
+    /// @brief Release all shared objects; they are destroyed when no longer referenced elsewhere
+    static void clear();
+
+    /// @brief Cache of shared objects, contributing to size(), footprint() and clear()
+    template <typename Value>
+    class Cache;
+
+private:
+    class Registration {
+    public:
+        virtual size_t size()      = 0;
+        virtual size_t footprint() = 0;
+        virtual void clear()       = 0;
+
+    protected:
+        Registration();
+        virtual ~Registration();
+    };
+};
+
+template <typename Value>
+class SharedObjects::Cache : public util::Cache<std::string, Value>, private SharedObjects::Registration {
+public:
+    Cache(const std::string& name): util::Cache<std::string, Value>(name) {}
+    size_t size() override { return util::Cache<std::string, Value>::size(); }
+    size_t footprint() override { return util::Cache<std::string, Value>::footprint(); }
+    void clear() override { util::Cache<std::string, Value>::clear(); }
+};
+
+// -------------------------------------------------------------------------------------
+
+}  // namespace util
+}  // namespace atlas
@@ -8,10 +8,13 @@
  * nor does it submit to any jurisdiction.
  */
 
+#pragma once
+
 #include <functional>
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "atlas/runtime/Log.h"
 #include "atlas/util/ObjectHandle.h"
@@ -36,7 +39,7 @@ public:
 
     ObjectHandle<value_type> get_or_create(const key_type& key, const key_type& remove_key,
                                            const creator_type& creator) {
-        std::lock_guard<std::mutex> guard(lock_);
+        std::lock_guard<std::recursive_mutex> guard(lock_);
         auto it = map_.find(key);
         if (it != map_.end()) {
             ObjectHandle<value_type> value = it->second;
@@ -52,13 +55,16 @@ public:
         Log::debug() << "Key \"" << key << "\" not found in cache \"" << name_
                      << "\" , creating new, removable with key \"" << remove_key << "\"" << std::endl;
         ObjectHandle<value_type> value(creator());
-        map_[key] = value;
-        remove_[remove_key].emplace_back(key);
+        if (value) {
+            // A failed creation is not cached, so that it is retried on the next request
+            map_[key] = value;
+            remove_[remove_key].emplace_back(key);
+        }
         return value;
     }
 
     void remove(const key_type& remove_key) {
-        std::lock_guard<std::mutex> guard(lock_);
+        std::lock_guard<std::recursive_mutex> guard(lock_);
         if (remove_.find(remove_key) != remove_.end()) {
             for (auto& key : remove_[remove_key]) {
                 bool erased = map_.erase(key);
@@ -83,9 +89,39 @@ public:
         }
     }
 
+    /// @brief Number of valid cached values
+    size_t size() {
+        std::lock_guard<std::recursive_mutex> guard(lock_);
+        size_t n = 0;
+        for (auto& entry : map_) {
+            n += bool(entry.second);
+        }
+        return n;
+    }
+
+    /// @brief Memory footprint of the cached values, requires value_type::footprint()
+    size_t footprint() {
+        std::lock_guard<std::recursive_mutex> guard(lock_);
+        size_t bytes = 0;
+        for (auto& entry : map_) {
+            if (entry.second) {
+                bytes += entry.second->footprint();
+            }
+        }
+        return bytes;
+    }
+
+    /// @brief Release all cached values; they are destroyed when no longer referenced elsewhere
+    void clear() {
+        std::lock_guard<std::recursive_mutex> guard(lock_);
+        Log::debug() << "Cleared " << map_.size() << " keys from cache \"" << name_ << "\"." << std::endl;
+        map_.clear();
+        remove_.clear();
+    }
+
 private:
     std::string name_;
-    std::mutex lock_;
+    std::recursive_mutex lock_;  // recursive, as creators may create other cached values
     std::map<key_type, ObjectHandle<value_type>> map_;
     std::map<key_type, std::vector<key_type>> remove_;
 };
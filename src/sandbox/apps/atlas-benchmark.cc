@@ -29,6 +29,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -141,6 +142,8 @@ public:
         add_option(new SimpleOption<bool>("details", "Show detailed timers (default=false)"));
         add_option(new SimpleOption<std::string>("reorder", "Reorder mesh (default=none)"));
         add_option(new SimpleOption<bool>("sort_edges", "Sort edges by lowest node local index"));
+        add_option(new SimpleOption<std::string>(
+            "wire_type", "Type in which halo values are transported: native or float (default=native)"));
     }
 
     void setup();
@@ -176,6 +179,8 @@ private:
     std::string gridname;
     std::string reorder{"none"};
     bool sort_edges{false};
+    std::string wire_type{"native"};
+    double halo_bytes{0};
 
     TimerStats iteration_timer;
     TimerStats haloexchange_timer;
@@ -205,6 +210,10 @@ int AtlasBenchmark::execute(const Args& args) {
     args.get("output", output);
     args.get("reorder", reorder);
     args.get("sort_edges", sort_edges);
+    args.get("wire_type", wire_type);
+    if (wire_type != "native" && wire_type != "float") {
+        throw_Exception("wire_type must be native or float", Here());
+    }
     bool help(false);
     args.get("help", help);
 
@@ -221,6 +230,7 @@ int AtlasBenchmark::execute(const Args& args) {
     Log::info() << "  grid: " << gridname << endl;
     Log::info() << "  nlev: " << nlev << endl;
     Log::info() << "  niter: " << niter << endl;
+    Log::info() << "  wire_type: " << wire_type << endl;
     Log::info() << endl;
     Log::info() << "  MPI tasks: " << mpi::comm().size() << endl;
     Log::info() << "  OpenMP threads per MPI task: " << atlas_omp_get_max_threads() << endl;
@@ -263,6 +273,10 @@ int AtlasBenchmark::execute(const Args& args) {
                 << "  min: " << setprecision(5) << fixed << haloexchange_timer.min << "  max: " << setprecision(5)
                 << fixed << haloexchange_timer.max << "  avg: " << setprecision(5) << fixed << haloexchange_timer.avg
                 << " ( " << setprecision(2) << haloexchange_timer.avg / iteration_timer.avg * 100. << "% )" << endl;
+    Log::info() << "Communication volume:\n"
+                << "  received per halo-exchange (all tasks): " << setprecision(2) << fixed << halo_bytes / 1.e6
+                << " MB  bandwidth: " << setprecision(2) << fixed << halo_bytes / 1.e6 / haloexchange_timer.avg
+                << " MB/s" << endl;
 
     util::Config report_config;
     report_config.set("indent", 4);
@@ -402,6 +416,11 @@ void AtlasBenchmark::setup() {
     for (idx_t jnode = 0; jnode < nnodes; ++jnode) {
         is_ghost.push_back(Topology::check(flags(jnode), Topology::GHOST));
     }
+
+    // Volume received in one halo exchange of the gradient field, summed over tasks
+    const double nb_ghost = static_cast<double>(std::count(is_ghost.begin(), is_ghost.end(), true));
+    halo_bytes = nb_ghost * nlev * 3 * (wire_type == "float" ? sizeof(float) : sizeof(double));
+    mpi::comm().allReduceInPlace(halo_bytes, eckit::mpi::sum());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -483,7 +502,12 @@ void AtlasBenchmark::iteration() {
 
     // halo-exchange
     Trace halo(Here(), "halo-exchange");
-    nodes_fs.halo_exchange().execute<double, 3>(grad_field.array());
+    if (wire_type == "float") {
+        nodes_fs.halo_exchange().execute_as<float, double, 3>(grad_field.array());
+    }
+    else {
+        nodes_fs.halo_exchange().execute<double, 3>(grad_field.array());
+    }
     halo.stop();
 
     t.stop();
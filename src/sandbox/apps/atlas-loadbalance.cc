@@ -8,9 +8,13 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/grid.h"
 #include "atlas/mesh/Mesh.h"
@@ -47,9 +51,14 @@ public:
             "meshgenerator", "Mesh generator [structured,regular,delaunay,cubedsphere] (default depends on GRID)"));
         add_option(new SimpleOption<std::string>(
             "partitioner",
-            "Grid partitioner [equal_regions,checkerboard,equal_bands,regular_bands] (default depends on GRID)"));
+            "Grid partitioner [equal_regions,checkerboard,equal_bands,regular_bands,hilbert] (default depends on GRID)"));
         add_option(new Separator("Advanced"));
         add_option(new SimpleOption<long>("halo", "Halo size"));
+        add_option(new Separator("Cost"));
+        add_option(new SimpleOption<std::string>(
+            "cost", "Synthetic per-point cost model [uniform,tropics] (default uniform). When not uniform, "
+                    "the load balance is reported before and after weighted repartitioning"));
+        add_option(new SimpleOption<double>("cost-factor", "Cost of a tropical point relative to others (default 4)"));
     }
 
     int execute(const Args& args) override {
@@ -98,20 +107,69 @@ public:
         Log::info() << "- halo:          " << halo << std::endl;
 
 
-        auto mesh = meshgenerator.generate(grid, partitioner);
-        functionspace::NodeColumns nodes(mesh, option::halo(halo));
+        std::string cost_model = args.getString("cost", "uniform");
+        if (cost_model == "uniform") {
+            auto mesh = meshgenerator.generate(grid, partitioner);
+            functionspace::NodeColumns nodes(mesh, option::halo(halo));
 
-        {
             std::stringstream s;
             mesh::actions::write_load_balance_report(mesh, s);
 
             if (mpi::comm().rank() == 0) {
                 std::cout << s.str() << std::endl;
             }
+            return success();
+        }
+
+        std::vector<double> weights;
+        try {
+            weights = make_weights(grid, cost_model, args.getDouble("cost-factor", 4.));
         }
+        catch (eckit::Exception& e) {
+            Log::error() << e.what() << std::endl;
+            return failed();
+        }
+
+        auto report = [&](const std::string& title, const Mesh& mesh) {
+            functionspace::NodeColumns nodes(mesh, option::halo(halo));
+            Field cost  = nodes.createField<double>(option::name("cost"));
+            auto glb    = array::make_view<gidx_t, 1>(nodes.global_index());
+            auto cost_v = array::make_view<double, 1>(cost);
+            for (idx_t n = 0; n < nodes.size(); ++n) {
+                cost_v(n) = weights[glb(n) - 1];
+            }
+
+            std::stringstream s;
+            mesh::actions::write_load_balance_report(mesh, cost, s);
+
+            if (mpi::comm().rank() == 0) {
+                std::cout << "# " << title << "\n" << s.str() << std::endl;
+            }
+        };
+
+        report("UNWEIGHTED PARTITIONING", meshgenerator.generate(grid, partitioner));
+        report("WEIGHTED PARTITIONING", meshgenerator.generate(grid, partitioner.partition(grid, weights.data())));
+
         return success();
     }
 
+    std::vector<double> make_weights(const Grid& grid, const std::string& cost_model, double cost_factor) {
+        std::vector<double> weights(grid.size(), 1.);
+        if (cost_model == "tropics") {
+            idx_t n = 0;
+            for (const auto& p : grid.lonlat()) {
+                if (std::abs(p.lat()) < 30.) {
+                    weights[n] = cost_factor;
+                }
+                ++n;
+            }
+        }
+        else {
+            throw_Exception("Unknown cost model \"" + cost_model + "\"", Here());
+        }
+        return weights;
+    }
+
     MeshGenerator make_meshgenerator(const Grid& grid, const Args& args) {
         auto config = grid.meshgenerator();  // recommended by the grid itself
         if (args.has("meshgenerator")) {
@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "atlas/array.h"
+#include "atlas/array/ContiguousArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/library/config.h"
 #include "tests/AtlasTestEnvironment.h"
@@ -596,6 +597,52 @@ CASE("test_aligned_Array") {
     }
 }
 
+CASE("test_contiguous_view") {
+    ArrayT<double> array(4, 5, 3);
+    auto view = make_view<double, 3>(array);
+    for (idx_t i = 0; i < 4; ++i) {
+        for (idx_t j = 0; j < 5; ++j) {
+            for (idx_t k = 0; k < 3; ++k) {
+                view(i, j, k) = 100 * i + 10 * j + k;
+            }
+        }
+    }
+
+    auto cview = make_contiguous_view<double, 3>(array);
+    EXPECT_EQ(cview.shape(0), 4);
+    EXPECT_EQ(cview.shape(1), 5);
+    EXPECT_EQ(cview.shape(2), 3);
+    EXPECT_EQ(cview.size(), 4 * 5 * 3);
+    EXPECT_EQ(cview.stride<2>(), 1);
+    EXPECT(cview.data() == view.data());
+
+    auto fixed = make_contiguous_view<double, 3, 3>(array);
+    EXPECT_EQ(fixed.shape<2>(), 3);
+    EXPECT_EQ(fixed.stride<1>(), 3);
+
+    const Array& const_array = array;
+    auto const_view          = make_contiguous_view<double, 3>(const_array);
+    for (idx_t i = 0; i < 4; ++i) {
+        for (idx_t j = 0; j < 5; ++j) {
+            for (idx_t k = 0; k < 3; ++k) {
+                EXPECT_EQ(cview(i, j, k), view(i, j, k));
+                EXPECT_EQ(fixed(i, j, k), view(i, j, k));
+                EXPECT_EQ(const_view(i, j, k), view(i, j, k));
+            }
+        }
+    }
+
+    cview(3, 4, 2) = -1.;
+    EXPECT_EQ(view(3, 4, 2), -1.);
+
+    EXPECT_THROWS_AS((make_contiguous_view<double, 3, 2>(array)), eckit::Exception);
+}
+
+CASE("test_contiguous_view_not_contiguous") {
+    ArrayT<double> aligned{make_shape(10, 5, 3), ArrayAlignment(4)};
+    EXPECT_THROWS_AS((make_contiguous_view<double, 3>(aligned)), eckit::Exception);
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -0,0 +1,183 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/FieldStatistics.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/mesh.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::functionspace;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+double value(gidx_t glb_idx, idx_t level) {
+    return std::sin(0.01 * double(glb_idx)) + 0.1 * double(level);
+}
+
+template <typename FS>
+Field create_field(const FS& fs, const std::string& name, idx_t levels) {
+    Field field  = fs.template createField<double>(option::name(name) | option::levels(levels));
+    auto glb_idx = array::make_view<gidx_t, 1>(fs.global_index());
+    auto view    = array::make_view<double, 2>(field);
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        for (idx_t l = 0; l < levels; ++l) {
+            view(n, l) = value(glb_idx(n), l);
+        }
+    }
+    return field;
+}
+
+// Reference statistics, computed from global indices without communication
+struct Reference {
+    Reference(gidx_t nb_points, idx_t levels) {
+        for (gidx_t p = 1; p <= nb_points; ++p) {
+            for (idx_t l = 0; l < levels; ++l) {
+                const double v = value(p, l);
+                sum += v;
+                if (v < min) {
+                    min         = v;
+                    min_glb_idx = p;
+                    min_level   = l;
+                }
+                if (v > max) {
+                    max         = v;
+                    max_glb_idx = p;
+                    max_level   = l;
+                }
+            }
+        }
+        N    = nb_points * levels;
+        mean = sum / double(N);
+        for (gidx_t p = 1; p <= nb_points; ++p) {
+            for (idx_t l = 0; l < levels; ++l) {
+                variance += (value(p, l) - mean) * (value(p, l) - mean);
+            }
+        }
+        variance /= double(N);
+    }
+    double min{1.e30};
+    double max{-1.e30};
+    double sum{0};
+    double mean{0};
+    double variance{0};
+    gidx_t N{0};
+    gidx_t min_glb_idx{0};
+    gidx_t max_glb_idx{0};
+    idx_t min_level{0};
+    idx_t max_level{0};
+};
+
+//-----------------------------------------------------------------------------
+
+CASE("test_field_statistics_nodecolumns") {
+    Grid grid("O16");
+    Mesh mesh = MeshGenerator("structured").generate(grid);
+    NodeColumns fs(mesh, option::levels(5) | option::halo(1));
+
+    Field field = create_field(fs, "field", 5);
+
+    FieldStatistics statistics(fs);
+    auto result = statistics.compute(field);
+
+    Reference ref(grid.size(), 5);
+    EXPECT_EQ(result.N, ref.N);
+    EXPECT_APPROX_EQ(result.minimum[0], ref.min, 1.e-12);
+    EXPECT_APPROX_EQ(result.maximum[0], ref.max, 1.e-12);
+    EXPECT_APPROX_EQ(result.sum[0], ref.sum, 1.e-9);
+    EXPECT_APPROX_EQ(result.mean[0], ref.mean, 1.e-12);
+    EXPECT_APPROX_EQ(result.variance[0], ref.variance, 1.e-12);
+    EXPECT_APPROX_EQ(result.stddev[0], std::sqrt(ref.variance), 1.e-12);
+
+    EXPECT_EQ(result.minimum_glb_idx[0], ref.min_glb_idx);
+    EXPECT_EQ(result.minimum_level[0], ref.min_level);
+    EXPECT_EQ(result.maximum_glb_idx[0], ref.max_glb_idx);
+    EXPECT_EQ(result.maximum_level[0], ref.max_level);
+
+    // Consistent with the separate NodeColumns statistics
+    double mean, stddev;
+    idx_t N;
+    fs.meanAndStandardDeviation(field, mean, stddev, N);
+    EXPECT_APPROX_EQ(result.mean[0], mean, 1.e-12);
+    EXPECT_APPROX_EQ(result.stddev[0], stddev, 1.e-12);
+}
+
+CASE("test_field_statistics_structuredcolumns_per_level") {
+    Grid grid("O16");
+    StructuredColumns fs(grid, option::levels(3) | option::halo(2));
+
+    FieldSet fieldset;
+    fieldset.add(create_field(fs, "a", 3));
+    fieldset.add(create_field(fs, "b", 3));
+
+    FieldStatistics statistics(fs, FieldStatistics::MINIMUM | FieldStatistics::MEAN | FieldStatistics::STDDEV, true);
+    auto result = statistics.compute(fieldset);
+    EXPECT_EQ(result.size(), 2);
+
+    for (const auto& r : result) {
+        EXPECT_EQ(r.levels, 3);
+        EXPECT_EQ(r.N, grid.size());
+        EXPECT_EQ(r.minimum.size(), 3);
+        EXPECT(r.maximum.empty());
+        EXPECT(r.sum.empty());
+        EXPECT(r.minimum_glb_idx.empty());
+        for (idx_t l = 0; l < 3; ++l) {
+            Reference ref(grid.size(), 1);
+            EXPECT_APPROX_EQ(r.minimum[r.index(l)], ref.min + 0.1 * l, 1.e-12);
+            EXPECT_APPROX_EQ(r.mean[r.index(l)], ref.mean + 0.1 * l, 1.e-12);
+            EXPECT_APPROX_EQ(r.stddev[r.index(l)], std::sqrt(ref.variance), 1.e-12);
+        }
+    }
+}
+
+CASE("test_field_statistics_large_offset") {
+    // Small spread about a large offset: expanding the variance as sum(n_i mean_i^2) - N mean^2 loses
+    // all significant digits here, whereas deviations from the mean retain them
+    Grid grid("O16");
+    StructuredColumns fs(grid, option::halo(1));
+
+    const double offset = 1.e6;
+    Field field         = fs.createField<double>(option::name("offset"));
+    auto glb_idx        = array::make_view<gidx_t, 1>(fs.global_index());
+    auto view           = array::make_view<double, 1>(field);
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        view(n) = offset + value(glb_idx(n), 0);
+    }
+
+    FieldStatistics statistics(fs, FieldStatistics::MEAN | FieldStatistics::VARIANCE);
+    auto result = statistics.compute(field);
+
+    Reference ref(grid.size(), 1);
+    EXPECT_EQ(result.N, ref.N);
+    EXPECT_APPROX_EQ(result.mean[0], offset + ref.mean, 1.e-8);
+    EXPECT_APPROX_EQ(result.variance[0], ref.variance, 1.e-9);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -468,6 +468,95 @@ CASE("test_functionspace_NodeColumns") {
                                      option::name("tmp"));
 }
 
+CASE("test_functionspace_NodeColumns_fieldset_halo_exchange") {
+    Grid grid("O16");
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns nodes_fs(mesh, option::halo(2) | option::levels(3));
+
+    auto glb_idx = array::make_view<gidx_t, 1>(nodes_fs.nodes().global_index());
+    auto ghost   = array::make_view<int, 1>(nodes_fs.nodes().ghost());
+
+    // Fields of mixed rank and datatype, exchanged together as a FieldSet and one by one as reference
+    auto create_fields = [&](const std::string& suffix) {
+        FieldSet fieldset;
+        fieldset.add(nodes_fs.createField<double>(option::name("a" + suffix)));
+        fieldset.add(nodes_fs.createField<double>(option::name("b" + suffix) | option::levels(false)));
+        fieldset.add(nodes_fs.createField<double>(option::name("c" + suffix) | option::variables(2)));
+        fieldset.add(nodes_fs.createField<int>(option::name("d" + suffix)));
+        fieldset.add(nodes_fs.createField<long>(option::name("e" + suffix) | option::levels(false)));
+        fieldset.add(nodes_fs.createField<float>(option::name("f" + suffix)));
+        fieldset.add(nodes_fs.createField<double>(option::name("g" + suffix)));
+        fieldset[6].metadata().set("wire_type", "float");
+
+        auto va = array::make_view<double, 2>(fieldset[0]);
+        auto vb = array::make_view<double, 1>(fieldset[1]);
+        auto vc = array::make_view<double, 3>(fieldset[2]);
+        auto vd = array::make_view<int, 2>(fieldset[3]);
+        auto ve = array::make_view<long, 1>(fieldset[4]);
+        auto vf = array::make_view<float, 2>(fieldset[5]);
+        auto vg = array::make_view<double, 2>(fieldset[6]);
+        for (idx_t n = 0; n < nodes_fs.size(); ++n) {
+            const bool owned = !ghost(n);
+            const int g      = static_cast<int>(glb_idx(n));
+            vb(n)            = owned ? g : -1.;
+            ve(n)            = owned ? g : -1;
+            for (idx_t k = 0; k < nodes_fs.levels(); ++k) {
+                va(n, k)    = owned ? g + k : -1.;
+                vd(n, k)    = owned ? g + k : -1;
+                vf(n, k)    = owned ? g + k : -1.f;
+                vg(n, k)    = owned ? g - k : -1.;
+                vc(n, k, 0) = owned ? g + k : -1.;
+                vc(n, k, 1) = owned ? -g - k : -1.;
+            }
+        }
+        return fieldset;
+    };
+
+    FieldSet fieldset  = create_fields("");
+    FieldSet reference = create_fields("_ref");
+
+    nodes_fs.haloExchange(fieldset);
+    for (idx_t f = 0; f < reference.size(); ++f) {
+        nodes_fs.haloExchange(reference[f]);
+    }
+
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        EXPECT(!fieldset[f].dirty());
+    }
+    auto equal = [](const Field& a, const Field& b) {
+        auto va = array::make_view<double, 2>(a);
+        auto vb = array::make_view<double, 2>(b);
+        for (idx_t n = 0; n < va.shape(0); ++n) {
+            for (idx_t k = 0; k < va.shape(1); ++k) {
+                EXPECT_EQ(va(n, k), vb(n, k));
+            }
+        }
+    };
+    equal(fieldset[0], reference[0]);
+    equal(fieldset[6], reference[6]);
+    auto vb = array::make_view<double, 1>(fieldset[1]);
+    auto vc = array::make_view<double, 3>(fieldset[2]);
+    auto vd = array::make_view<int, 2>(fieldset[3]);
+    auto ve = array::make_view<long, 1>(fieldset[4]);
+    auto vf = array::make_view<float, 2>(fieldset[5]);
+    auto rb = array::make_view<double, 1>(reference[1]);
+    auto rc = array::make_view<double, 3>(reference[2]);
+    auto rd = array::make_view<int, 2>(reference[3]);
+    auto re = array::make_view<long, 1>(reference[4]);
+    auto rf = array::make_view<float, 2>(reference[5]);
+    for (idx_t n = 0; n < nodes_fs.size(); ++n) {
+        EXPECT(vb(n) != -1.);
+        EXPECT_EQ(vb(n), rb(n));
+        EXPECT_EQ(ve(n), re(n));
+        for (idx_t k = 0; k < nodes_fs.levels(); ++k) {
+            EXPECT_EQ(vd(n, k), rd(n, k));
+            EXPECT_EQ(vf(n, k), rf(n, k));
+            EXPECT_EQ(vc(n, k, 0), rc(n, k, 0));
+            EXPECT_EQ(vc(n, k, 1), rc(n, k, 1));
+        }
+    }
+}
+
 CASE("test_SpectralFunctionSpace") {
     idx_t truncation = 159;
     idx_t nb_levels  = 10;
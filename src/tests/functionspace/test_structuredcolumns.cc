@@ -11,9 +11,11 @@
 #include "eckit/log/Bytes.h"
 #include "eckit/types/Types.h"
 
+#include "atlas/array/ArraySpec.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/grid/Partitioner.h"
@@ -21,6 +23,7 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
+#include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/MicroDeg.h"
@@ -427,6 +430,164 @@ CASE("test_functionspace_StructuredColumns halo exchange adjoint test 1") {
 }
 
 
+CASE("test_functionspace_StructuredColumns checksum independent of distribution") {
+    Grid grid("O16");
+    util::Config config;
+    config.set("halo", 1);
+    config.set("levels", 3);
+
+    auto checksum = [&](const grid::Partitioner& partitioner) {
+        functionspace::StructuredColumns fs(grid, partitioner, config);
+        Field field  = fs.createField<double>(option::name("field"));
+        auto value   = array::make_view<double, 2>(field);
+        auto glb_idx = array::make_view<gidx_t, 1>(fs.global_index());
+        for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+            for (idx_t k = 0; k < fs.levels(); ++k) {
+                value(n, k) = 0.5 * double(glb_idx(n)) + k;
+            }
+        }
+        // Halo values must not contribute
+        for (idx_t n = fs.sizeOwned(); n < fs.size(); ++n) {
+            for (idx_t k = 0; k < fs.levels(); ++k) {
+                value(n, k) = -1.;
+            }
+        }
+        std::string before_halo_exchange = fs.checksum(field);
+        fs.haloExchange(field);
+        EXPECT_EQ(fs.checksum(field), before_halo_exchange);
+        return before_halo_exchange;
+    };
+
+    EXPECT_EQ(checksum(grid::Partitioner("equal_regions")), checksum(grid::Partitioner("checkerboard")));
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_functionspace_StructuredColumns halo_by_partition") {
+    Grid grid("O16");
+    util::Config config;
+    config.set("halo", 2);
+    config.set("levels", 3);
+
+    functionspace::StructuredColumns fs_default(grid, grid::Partitioner("equal_regions"), config);
+    functionspace::StructuredColumns fs(grid, grid::Partitioner("equal_regions"),
+                                        config | util::Config("halo_by_partition", true));
+    EXPECT_EQ(fs.sizeOwned(), fs_default.sizeOwned());
+    EXPECT_EQ(fs.size(), fs_default.size());
+
+    // Halo points are grouped by owning partition; owned points are unaffected
+    auto part = array::make_view<int, 1>(fs.partition());
+    for (idx_t n = fs.sizeOwned() + 1; n < fs.size(); ++n) {
+        EXPECT(part(n - 1) <= part(n));
+    }
+    auto glb_idx         = array::make_view<gidx_t, 1>(fs.global_index());
+    auto glb_idx_default = array::make_view<gidx_t, 1>(fs_default.global_index());
+    for (idx_t j = fs.j_begin_halo(); j < fs.j_end_halo(); ++j) {
+        for (idx_t i = fs.i_begin_halo(j); i < fs.i_end_halo(j); ++i) {
+            EXPECT_EQ(glb_idx(fs.index(i, j)), glb_idx_default(fs_default.index(i, j)));
+        }
+    }
+    for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+        EXPECT_EQ(glb_idx(n), glb_idx_default(n));
+    }
+
+    // Halo exchange, received without unpacking
+    EXPECT(fs.halo_exchange().recv_contiguous());
+    Field field = fs.createField<double>(option::name("field"));
+    EXPECT(field.contiguous());
+    auto value = array::make_view<double, 2>(field);
+
+    // Same exchange through the receive buffer: a field with padded rows is not contiguous, and is unpacked
+    std::vector<double> padded(fs.size() * (fs.levels() + 1), -2.);
+    Field field_copy("field_copy", padded.data(),
+                     array::ArraySpec(array::make_shape(fs.size(), fs.levels()),
+                                      array::make_strides(fs.levels() + 1, 1)));
+    EXPECT(!field_copy.contiguous());
+    auto value_copy = array::make_view<double, 2>(field_copy);
+
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        for (idx_t k = 0; k < fs.levels(); ++k) {
+            value(n, k)      = n < fs.sizeOwned() ? double(glb_idx(n)) + k : -1.;
+            value_copy(n, k) = value(n, k);
+        }
+    }
+    fs.haloExchange(field);
+    fs.haloExchange(field_copy);
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        for (idx_t k = 0; k < fs.levels(); ++k) {
+            EXPECT_EQ(value(n, k), double(glb_idx(n)) + k);
+            EXPECT_EQ(value(n, k), value_copy(n, k));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_functionspace_StructuredColumns fieldset halo exchange") {
+    Grid grid("O16");
+    util::Config config;
+    config.set("halo", 2);
+    config.set("levels", 3);
+    functionspace::StructuredColumns fs(grid, grid::Partitioner("equal_regions"), config);
+
+    auto glb_idx = array::make_view<gidx_t, 1>(fs.global_index());
+
+    // Fields of mixed rank and datatype; "clean" has no outstanding halo update
+    FieldSet fieldset;
+    fieldset.add(fs.createField<double>(option::name("a")));
+    fieldset.add(fs.createField<double>(option::name("b") | option::levels(false)));
+    fieldset.add(fs.createField<double>(option::name("c") | option::variables(2)));
+    fieldset.add(fs.createField<int>(option::name("d")));
+    fieldset.add(fs.createField<int>(option::name("e") | option::levels(false)));
+    fieldset.add(fs.createField<float>(option::name("f")));
+    fieldset.add(fs.createField<double>(option::name("clean")));
+
+    auto va     = array::make_view<double, 2>(fieldset["a"]);
+    auto vb     = array::make_view<double, 1>(fieldset["b"]);
+    auto vc     = array::make_view<double, 3>(fieldset["c"]);
+    auto vd     = array::make_view<int, 2>(fieldset["d"]);
+    auto ve     = array::make_view<int, 1>(fieldset["e"]);
+    auto vf     = array::make_view<float, 2>(fieldset["f"]);
+    auto vclean = array::make_view<double, 2>(fieldset["clean"]);
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        const bool owned = n < fs.sizeOwned();
+        const int g      = static_cast<int>(glb_idx(n));
+        vb(n)            = owned ? g : -1.;
+        ve(n)            = owned ? g : -1;
+        for (idx_t k = 0; k < fs.levels(); ++k) {
+            va(n, k)     = owned ? g + k : -1.;
+            vd(n, k)     = owned ? g + k : -1;
+            vf(n, k)     = owned ? g + k : -1.f;
+            vclean(n, k) = owned ? g + k : -1.;
+            vc(n, k, 0)  = owned ? g + k : -1.;
+            vc(n, k, 1)  = owned ? -g - k : -1.;
+        }
+    }
+    fieldset["clean"].set_dirty(false);
+
+    fieldset.haloExchange();
+
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        const bool owned = n < fs.sizeOwned();
+        const int g      = static_cast<int>(glb_idx(n));
+        EXPECT_EQ(vb(n), double(g));
+        EXPECT_EQ(ve(n), g);
+        for (idx_t k = 0; k < fs.levels(); ++k) {
+            EXPECT_EQ(va(n, k), double(g + k));
+            EXPECT_EQ(vd(n, k), g + k);
+            EXPECT_EQ(vf(n, k), float(g + k));
+            EXPECT_EQ(vc(n, k, 0), double(g + k));
+            EXPECT_EQ(vc(n, k, 1), double(-g - k));
+            EXPECT_EQ(vclean(n, k), owned ? double(g + k) : -1.);
+        }
+    }
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        EXPECT(!fieldset[f].dirty());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("create_aligned_field") {
     std::string gridname = eckit::Resource<std::string>("--grid", "S20x3");
     Grid grid(gridname);
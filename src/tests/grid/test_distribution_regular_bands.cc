@@ -198,6 +198,47 @@ CASE("test regular_bands with a very large grid") {
 }
 
 
+CASE("test index_range") {
+    Grid grid("O32");
+    const int nb_partitions = 7;
+
+    auto check_index_range = [&](const grid::Distribution& dist) {
+        std::vector<gidx_t> begin(nb_partitions, grid.size());
+        std::vector<gidx_t> end(nb_partitions, 0);
+        for (gidx_t n = 0; n < grid.size(); ++n) {
+            const int p = dist.partition(n);
+            begin[p]    = std::min(begin[p], n);
+            end[p]      = n + 1;
+        }
+        for (int p = 0; p < nb_partitions; ++p) {
+            EXPECT_EQ(dist.index_range(p).first, begin[p]);
+            EXPECT_EQ(dist.index_range(p).second, end[p]);
+        }
+    };
+
+    SECTION("equal_regions") {
+        check_index_range(grid::Distribution(grid, grid::Partitioner("equal_regions", nb_partitions)));
+    }
+    SECTION("bands") { check_index_range(grid::Distribution(grid, grid::Partitioner("bands", nb_partitions))); }
+    SECTION("regular_bands") {
+        auto regular = RegularGrid("L40x21");
+        grid::Distribution dist(regular, grid::Partitioner("regular_bands", nb_partitions));
+        for (int p = 0; p < nb_partitions; ++p) {
+            auto range = dist.index_range(p);
+            for (gidx_t n = 0; n < regular.size(); ++n) {
+                EXPECT((dist.partition(n) == p) == (n >= range.first && n < range.second));
+            }
+        }
+    }
+    SECTION("custom") {
+        std::vector<int> part(grid.size());
+        for (idx_t n = 0; n < grid.size(); ++n) {
+            part[n] = (n / 100) % nb_partitions;
+        }
+        check_index_range(grid::Distribution(nb_partitions, grid.size(), part.data()));
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
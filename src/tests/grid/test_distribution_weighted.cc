@@ -0,0 +1,146 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/redistribution/Redistribution.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid   = atlas::Grid;
+using Config = atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<double> tropics_weights(const Grid& grid, double factor) {
+    std::vector<double> weights(grid.size(), 1.);
+    idx_t n = 0;
+    for (const auto& p : grid.lonlat()) {
+        if (std::abs(p.lat()) < 30.) {
+            weights[n] = factor;
+        }
+        ++n;
+    }
+    return weights;
+}
+
+std::vector<double> cost_per_partition(const grid::Distribution& dist, const std::vector<double>& weights) {
+    std::vector<double> cost(dist.nb_partitions(), 0.);
+    for (gidx_t n = 0; n < dist.size(); ++n) {
+        cost[dist.partition(n)] += weights[n];
+    }
+    return cost;
+}
+
+double imbalance(const std::vector<double>& cost) {
+    double avg = std::accumulate(cost.begin(), cost.end(), 0.) / double(cost.size());
+    return *std::max_element(cost.begin(), cost.end()) / avg - 1.;
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_weighted_equal_regions_uniform") {
+    Grid grid("O32");
+    grid::Partitioner partitioner("equal_regions", 8);
+
+    std::vector<double> weights(grid.size(), 1.);
+    grid::Distribution dist = partitioner.partition(grid, weights.data());
+
+    EXPECT_EQ(dist.nb_partitions(), 8);
+    EXPECT(dist.max_pts() - dist.min_pts() <= 2);
+}
+
+CASE("test_weighted_equal_regions_tropics") {
+    Grid grid("O32");
+    grid::Partitioner partitioner("equal_regions", 8);
+
+    auto weights = tropics_weights(grid, 10.);
+
+    grid::Distribution unweighted(grid, partitioner);
+    grid::Distribution weighted = partitioner.partition(grid, weights.data());
+
+    double unweighted_imbalance = imbalance(cost_per_partition(unweighted, weights));
+    double weighted_imbalance   = imbalance(cost_per_partition(weighted, weights));
+    Log::info() << "imbalance: unweighted = " << unweighted_imbalance * 100. << "%, weighted = "
+                << weighted_imbalance * 100. << "%" << std::endl;
+
+    EXPECT(weighted_imbalance < 0.01);
+    EXPECT(weighted_imbalance < unweighted_imbalance);
+}
+
+CASE("test_weighted_not_supported") {
+    Grid grid("O32");
+    std::vector<double> weights(grid.size(), 1.);
+    EXPECT_THROWS_AS(grid::Partitioner("checkerboard", 4).partition(grid, weights.data()), eckit::Exception);
+}
+
+CASE("test_weighted_partitioner_mpi_comm") {
+    EXPECT_EQ(grid::Partitioner("equal_regions").mpi_comm(), mpi::comm().name());
+    grid::Partitioner partitioner(Config("type", "equal_regions") | Config("mpi_comm", "world"));
+    EXPECT_EQ(partitioner.mpi_comm(), std::string("world"));
+}
+
+CASE("test_weighted_repartition_and_redistribute") {
+    Grid grid("O32");
+    auto weights = tropics_weights(grid, 10.);
+
+    functionspace::StructuredColumns fs_source(grid, grid::Partitioner("equal_regions"));
+
+    Field cost  = fs_source.createField<double>(option::name("cost"));
+    Field field = fs_source.createField<double>(option::name("field"));
+    {
+        auto glb     = array::make_view<gidx_t, 1>(fs_source.global_index());
+        auto cost_v  = array::make_view<double, 1>(cost);
+        auto field_v = array::make_view<double, 1>(field);
+        for (idx_t n = 0; n < fs_source.size(); ++n) {
+            cost_v(n)  = weights[glb(n) - 1];
+            field_v(n) = double(glb(n));
+        }
+    }
+
+    grid::Distribution dist(grid, grid::Partitioner("equal_regions"), cost);
+    EXPECT(imbalance(cost_per_partition(dist, weights)) < 0.01);
+
+    functionspace::StructuredColumns fs_target(grid, dist);
+    Field field_target = fs_target.createField<double>(option::name("field"));
+
+    Redistribution redistribution(fs_source, fs_target);
+    redistribution.execute(field, field_target);
+
+    auto glb     = array::make_view<gidx_t, 1>(fs_target.global_index());
+    auto ghost   = array::make_view<int, 1>(fs_target.ghost());
+    auto field_v = array::make_view<double, 1>(field_target);
+    for (idx_t n = 0; n < fs_target.size(); ++n) {
+        if (not ghost(n)) {
+            EXPECT_EQ(field_v(n), double(glb(n)));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
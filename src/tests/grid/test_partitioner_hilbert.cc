@@ -0,0 +1,105 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/grid/detail/partitioner/HilbertPartitioner.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid   = atlas::Grid;
+using Config = atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<Grid> grids() {
+    std::vector<PointXY> points;
+    for (const auto& p : Grid("O16").lonlat()) {
+        points.emplace_back(p.lon(), p.lat());
+    }
+    return {Grid("O32"), Grid("CS-LFR-12"), Grid("H8"), UnstructuredGrid(points)};
+}
+
+CASE("test_hilbert_partitioner") {
+    EXPECT(grid::Partitioner::exists("hilbert"));
+    for (auto& grid : grids()) {
+        SECTION(grid.name()) {
+            const int nb_parts = 7;
+            grid::Distribution dist(grid, grid::Partitioner("hilbert", nb_parts));
+            EXPECT_EQ(dist.nb_partitions(), nb_parts);
+            EXPECT_EQ(dist.type(), "hilbert");
+            EXPECT(dist.max_pts() - dist.min_pts() <= 1);
+        }
+    }
+}
+
+CASE("test_hilbert_partitioner_weighted") {
+    for (auto& grid : grids()) {
+        SECTION(grid.name()) {
+            const int nb_parts = 7;
+            std::vector<double> weights(grid.size(), 1.);
+            idx_t n = 0;
+            for (const auto& p : grid.lonlat()) {
+                if (std::abs(p.lat()) < 30.) {
+                    weights[n] = 5.;
+                }
+                ++n;
+            }
+            grid::Distribution dist = grid::Partitioner("hilbert", nb_parts).partition(grid, weights.data());
+
+            std::vector<double> cost(nb_parts, 0.);
+            for (gidx_t j = 0; j < grid.size(); ++j) {
+                cost[dist.partition(j)] += weights[j];
+            }
+            double avg = std::accumulate(cost.begin(), cost.end(), 0.) / nb_parts;
+            double max = *std::max_element(cost.begin(), cost.end());
+            Log::info() << grid.name() << " weighted imbalance: " << (max / avg - 1.) * 100. << "%" << std::endl;
+            EXPECT(max / avg - 1. < 0.02);
+        }
+    }
+}
+
+CASE("test_hilbert_partitions_are_contiguous_along_curve") {
+    // Every partition is a single contiguous chunk of the curve
+    Grid grid("O32");
+    const int nb_parts = 5;
+    grid::Partitioner partitioner("hilbert", nb_parts);
+    grid::Distribution dist(grid, partitioner);
+
+    std::vector<int> chunks;
+    int previous = -1;
+    for (gidx_t gidx : dynamic_cast<const grid::detail::partitioner::HilbertPartitioner&>(*partitioner.get())
+                           .order(grid)) {
+        int p = dist.partition(gidx);
+        if (p != previous) {
+            chunks.push_back(p);
+            previous = p;
+        }
+    }
+    EXPECT_EQ(static_cast<int>(chunks.size()), nb_parts);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
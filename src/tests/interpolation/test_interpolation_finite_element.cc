@@ -80,6 +80,119 @@ CASE("test_interpolation_finite_element") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_interpolation_finite_element_matrix_free") {
+    Grid grid("O64");
+    Mesh mesh(grid);
+    NodeColumns fs(mesh);
+
+    // Some points at the equator, moving eastwards between executes
+    PointCloud pointcloud(
+        {{00., 0.}, {10., 0.}, {20., 0.}, {30., 0.}, {40., 0.}, {50., 0.}, {60., 0.}, {70., 0.}, {80., 0.}, {90., 0.}});
+
+    auto func = [](double x) -> double { return std::sin(x * M_PI / 180.); };
+
+    Interpolation interpolation(option::type("finite-element") | util::Config("matrix_free", true), fs, pointcloud);
+
+    Field field_source = fs.createField<double>(option::name("source"));
+    Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size()));
+
+    auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+    auto source = array::make_view<double, 1>(field_source);
+    for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+        source(j) = func(lonlat(j, LON));
+    }
+
+    auto target        = array::make_view<double, 1>(field_target);
+    auto target_lonlat = array::make_view<double, 2>(pointcloud.lonlat());
+    for (idx_t step = 0; step < 4; ++step) {
+        interpolation.execute(field_source, field_target);
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            static double interpolation_tolerance = 1.e-4;
+            EXPECT(eckit::types::is_approximately_equal(target(j), func(target_lonlat(j, LON)),
+                                                        interpolation_tolerance));
+            target_lonlat(j, LON) += 2.5;
+        }
+    }
+}
+
+CASE("test_interpolation_finite_element_matrix_free_matches_matrix") {
+    Grid grid("O32");
+    Mesh mesh(grid);
+    NodeColumns fs(mesh, option::levels(3));
+
+    // Points away from element edges; the last one jumps to the other side of the globe at the second step,
+    // too far for the walk from its previous element, so that it is located by the kd-tree search
+    std::vector<PointXY> points{{12.345, 4.321}, {101.234, -33.333}, {203.21, 61.23}, {305.67, -71.89}, {1.23, 0.57}};
+    PointCloud pointcloud(points);
+
+    auto config = option::type("finite-element") | util::Config("matrix_free", true);
+    Interpolation interpolation(config, fs, pointcloud);
+
+    Field field_source = fs.createField<double>(option::name("source"));
+    Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size(), 3));
+    field_source.metadata().set("missing_value", -1.e30);
+    field_source.metadata().set("missing_value_type", "equals");
+
+    auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+    auto source = array::make_view<double, 2>(field_source);
+    for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+        for (idx_t k = 0; k < 3; ++k) {
+            source(j, k) = std::sin(lonlat(j, LON) * M_PI / 180.) * std::cos(lonlat(j, LAT) * M_PI / 180.) + 0.1 * k;
+        }
+    }
+
+    auto target_lonlat = array::make_view<double, 2>(pointcloud.lonlat());
+    for (idx_t step = 0; step < 3; ++step) {
+        interpolation.execute(field_source, field_target);
+
+        // Matrix path at the same points
+        PointCloud moved(points);
+        Interpolation reference(option::type("finite-element"), fs, moved);
+        Field field_reference("reference", array::make_datatype<double>(), array::make_shape(moved.size(), 3));
+        reference.execute(field_source, field_reference);
+
+        auto target = array::make_view<double, 2>(field_target);
+        auto check  = array::make_view<double, 2>(field_reference);
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            for (idx_t k = 0; k < 3; ++k) {
+                EXPECT_EQ(target(j, k), check(j, k));
+            }
+        }
+
+        // Missing value metadata is carried over as in the matrix path
+        EXPECT(field_target.metadata().has("missing_value"));
+        EXPECT_EQ(field_target.metadata().getDouble("missing_value"),
+                  field_reference.metadata().getDouble("missing_value"));
+        EXPECT_EQ(field_target.metadata().getString("missing_value_type"),
+                  field_reference.metadata().getString("missing_value_type"));
+
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            points[j]             = PointXY{points[j].x() + 1.37, points[j].y() + 0.29};
+            target_lonlat(j, LON) = points[j].x();
+            target_lonlat(j, LAT) = points[j].y();
+        }
+        if (step == 0) {
+            const idx_t last         = pointcloud.size() - 1;
+            points[last]             = PointXY{points[last].x() + 180., -points[last].y()};
+            target_lonlat(last, LON) = points[last].x();
+            target_lonlat(last, LAT) = points[last].y();
+        }
+    }
+}
+
+CASE("test_interpolation_finite_element_matrix_free_non_linear") {
+    Grid grid("O16");
+    Mesh mesh(grid);
+    NodeColumns fs(mesh);
+    PointCloud pointcloud({{12.345, 4.321}});
+
+    auto config = option::type("finite-element") | util::Config("matrix_free", true) |
+                  util::Config("non_linear", "missing-if-any-missing");
+    EXPECT_THROWS(Interpolation(config, fs, pointcloud));
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -0,0 +1,174 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+
+#include "eckit/types/FloatCompare.h"
+
+#include "atlas/array.h"
+#include "atlas/functionspace.h"
+#include "atlas/functionspace/PointCloud.h"
+#include "atlas/grid.h"
+#include "atlas/interpolation.h"
+#include "atlas/mesh.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/util/Constants.h"
+#include "atlas/util/CoordinateEnums.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace eckit;
+using namespace atlas::functionspace;
+using namespace atlas::util;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+// Eastward and northward components of the solid body rotation about the x-axis,
+// which crosses the poles
+void solid_body_rotation(double lon, double lat, double& u, double& v) {
+    const double lambda = lon * Constants::degreesToRadians();
+    const double phi    = lat * Constants::degreesToRadians();
+    // velocity (0, -z, y)
+    const double y = std::cos(phi) * std::sin(lambda);
+    const double z = std::sin(phi);
+    u              = -z * std::cos(lambda);
+    v              = z * std::sin(phi) * std::sin(lambda) + y * std::cos(phi);
+}
+
+CASE("test_interpolation_spherical_vector") {
+    Grid grid("O32");
+    Mesh mesh(grid);
+    NodeColumns fs(mesh);
+
+    // Points at the equator and close to and at the poles
+    PointCloud pointcloud({{0., 0.},
+                           {45., 0.},
+                           {10., 88.},
+                           {100., 89.5},
+                           {190., 89.9},
+                           {30., 90.},
+                           {280., -89.5},
+                           {300., -90.}});
+
+    auto config = option::type("spherical-vector") | util::Config("scheme", option::type("finite-element")) |
+                  util::Config("adjoint", true);
+    Interpolation interpolation(config, fs, pointcloud);
+
+    Field field_source = fs.createField<double>(option::name("source") | option::variables(2));
+    Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size(), 2));
+    field_source.metadata().set("type", "vector");
+    field_target.metadata().set("type", "vector");
+
+    auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+    auto source = array::make_view<double, 2>(field_source);
+    for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+        solid_body_rotation(lonlat(j, LON), lonlat(j, LAT), source(j, 0), source(j, 1));
+    }
+
+    SECTION("test interpolation outputs") {
+        interpolation.execute(field_source, field_target);
+
+        auto target        = array::make_view<double, 2>(field_target);
+        auto target_lonlat = array::make_view<double, 2>(pointcloud.lonlat());
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            static double interpolation_tolerance = 1.e-2;
+            double u, v;
+            solid_body_rotation(target_lonlat(j, LON), target_lonlat(j, LAT), u, v);
+            Log::info() << target(j, 0) << "  " << u << "    " << target(j, 1) << "  " << v << std::endl;
+            EXPECT(eckit::types::is_approximately_equal(target(j, 0), u, interpolation_tolerance));
+            EXPECT(eckit::types::is_approximately_equal(target(j, 1), v, interpolation_tolerance));
+        }
+    }
+
+    SECTION("test adjoint") {
+        // <W x, y> == <x, W^T y>, with the real inner product of the components
+        interpolation.execute(field_source, field_target);
+        Field field_target_adj("target_adj", array::make_datatype<double>(), array::make_shape(pointcloud.size(), 2));
+        Field field_source_adj = fs.createField<double>(option::name("source_adj") | option::variables(2));
+        field_target_adj.metadata().set("type", "vector");
+        field_source_adj.metadata().set("type", "vector");
+
+        auto target     = array::make_view<double, 2>(field_target);
+        auto target_adj = array::make_view<double, 2>(field_target_adj);
+        auto source_adj = array::make_view<double, 2>(field_source_adj);
+        source_adj.assign(0.);
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            target_adj(j, 0) = 1. + j;
+            target_adj(j, 1) = 2. - j;
+        }
+        interpolation.execute_adjoint(field_source_adj, field_target_adj);
+
+        auto ghost = array::make_view<int, 1>(fs.nodes().ghost());
+        double yWx{0.};
+        double WTyx{0.};
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            yWx += target(j, 0) * target_adj(j, 0) + target(j, 1) * target_adj(j, 1);
+        }
+        for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+            if (not ghost(j)) {
+                WTyx += source(j, 0) * source_adj(j, 0) + source(j, 1) * source_adj(j, 1);
+            }
+        }
+        EXPECT(eckit::types::is_approximately_equal(yWx, WTyx, 1.e-10));
+    }
+}
+
+CASE("test_interpolation_spherical_vector structured halo across the poles") {
+    Grid grid("O32");
+    StructuredColumns fs(grid, option::halo(2));
+
+    // Points within one grid spacing of the poles, whose stencils reach into the halo beyond the pole
+    PointCloud pointcloud({{0., 88.5}, {100., 89.5}, {190., 89.9}, {280., -89.}, {350., -89.9}});
+
+    for (std::string scheme : {"structured-linear2D", "structured-cubic2D"}) {
+        Log::info() << scheme << std::endl;
+        auto config = option::type("spherical-vector") | util::Config("scheme", option::type(scheme));
+        Interpolation interpolation(config, fs, pointcloud);
+
+        Field field_source = fs.createField<double>(option::name("source") | option::variables(2));
+        Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size(), 2));
+        field_source.metadata().set("type", "vector");
+        field_target.metadata().set("type", "vector");
+
+        // Only owned points are set; the halo beyond the poles is filled by the halo exchange
+        auto lonlat = array::make_view<double, 2>(fs.lonlat());
+        auto source = array::make_view<double, 2>(field_source);
+        source.assign(0.);
+        for (idx_t j = 0; j < fs.sizeOwned(); ++j) {
+            solid_body_rotation(lonlat(j, LON), lonlat(j, LAT), source(j, 0), source(j, 1));
+        }
+        field_source.set_dirty();
+
+        interpolation.execute(field_source, field_target);
+
+        auto target        = array::make_view<double, 2>(field_target);
+        auto target_lonlat = array::make_view<double, 2>(pointcloud.lonlat());
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            static double interpolation_tolerance = 1.e-2;
+            double u, v;
+            solid_body_rotation(target_lonlat(j, LON), target_lonlat(j, LAT), u, v);
+            Log::info() << target(j, 0) << "  " << u << "    " << target(j, 1) << "  " << v << std::endl;
+            EXPECT(eckit::types::is_approximately_equal(target(j, 0), u, interpolation_tolerance));
+            EXPECT(eckit::types::is_approximately_equal(target(j, 1), v, interpolation_tolerance));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -0,0 +1,203 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/grid/Vertical.h"
+#include "atlas/interpolation/VerticalInterpolation.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::interpolation::VerticalInterpolation;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Vertical make_vertical(idx_t levels, double z_begin, double z_end) {
+    std::vector<double> z(levels);
+    for (idx_t k = 0; k < levels; ++k) {
+        const double s = double(k) / double(levels - 1);
+        z[k]           = z_begin + (z_end - z_begin) * s * s;  // non-uniform
+    }
+    return Vertical(levels, z);
+}
+
+double cubic(double z) {
+    return 1.e-9 * z * z * z - 2.e-5 * z * z + 0.1 * z + 3.;
+}
+
+}  // namespace
+
+CASE("test_vertical_interpolation common levels") {
+    const idx_t nb_columns = 20;
+    Vertical source        = make_vertical(40, 0., 1000.);
+    Vertical target        = make_vertical(25, 50., 950.);
+
+    Field field_source("source", array::make_datatype<double>(), array::make_shape(nb_columns, source.size()));
+    Field field_target("target", array::make_datatype<double>(), array::make_shape(nb_columns, target.size()));
+    auto src = array::make_view<double, 2>(field_source);
+    auto tgt = array::make_view<double, 2>(field_target);
+    for (idx_t c = 0; c < nb_columns; ++c) {
+        for (idx_t k = 0; k < source.size(); ++k) {
+            src(c, k) = c * source[k] + 1.;
+        }
+    }
+
+    SECTION("linear reproduces linear profiles") {
+        VerticalInterpolation interpolation(source, target, util::Config("scheme", "linear"));
+        interpolation.execute(field_source, field_target);
+        for (idx_t c = 0; c < nb_columns; ++c) {
+            for (idx_t k = 0; k < target.size(); ++k) {
+                EXPECT_APPROX_EQ(tgt(c, k), c * target[k] + 1., 1.e-9);
+            }
+        }
+    }
+
+    SECTION("cubic reproduces cubic profiles away from boundaries") {
+        for (idx_t c = 0; c < nb_columns; ++c) {
+            for (idx_t k = 0; k < source.size(); ++k) {
+                src(c, k) = cubic(source[k]);
+            }
+        }
+        VerticalInterpolation interpolation(source, target, util::Config("scheme", "cubic"));
+        interpolation.execute(field_source, field_target);
+        for (idx_t c = 0; c < nb_columns; ++c) {
+            for (idx_t k = 0; k < target.size(); ++k) {
+                if (target[k] > source[1] && target[k] < source[source.size() - 2]) {
+                    EXPECT_APPROX_EQ(tgt(c, k), cubic(target[k]), 1.e-9);
+                }
+            }
+        }
+    }
+}
+
+CASE("test_vertical_interpolation cubic limiter on a step profile") {
+    const idx_t nb_columns = 3;
+    const idx_t ns         = 20;
+    const idx_t k_step     = 10;
+
+    std::vector<double> zs(ns);
+    for (idx_t k = 0; k < ns; ++k) {
+        zs[k] = k;
+    }
+    std::vector<double> zt(ns - 1);
+    for (idx_t t = 0; t < ns - 1; ++t) {
+        zt[t] = t + 0.3;
+    }
+    Vertical source(ns, zs);
+    Vertical target(zt.size(), zt);
+
+    Field field_source("source", array::make_datatype<double>(), array::make_shape(nb_columns, ns));
+    Field field_target("target", array::make_datatype<double>(), array::make_shape(nb_columns, target.size()));
+    auto src = array::make_view<double, 2>(field_source);
+    auto tgt = array::make_view<double, 2>(field_target);
+    for (idx_t c = 0; c < nb_columns; ++c) {
+        for (idx_t k = 0; k < ns; ++k) {
+            src(c, k) = k < k_step ? 0. : double(c + 1);
+        }
+    }
+
+    // Target level t lies between source levels t and t+1
+    auto within_bracket = [&](idx_t c, idx_t t) {
+        const double f_min = std::min(src(c, t), src(c, t + 1));
+        const double f_max = std::max(src(c, t), src(c, t + 1));
+        return tgt(c, t) >= f_min && tgt(c, t) <= f_max;
+    };
+
+    SECTION("without limiter") {
+        VerticalInterpolation interpolation(source, target, util::Config("scheme", "cubic"));
+        interpolation.execute(field_source, field_target);
+        for (idx_t c = 0; c < nb_columns; ++c) {
+            // undershoot before and overshoot after the step
+            EXPECT(tgt(c, k_step - 2) < 0.);
+            EXPECT(tgt(c, k_step) > double(c + 1));
+            EXPECT(!within_bracket(c, k_step - 2));
+            EXPECT(!within_bracket(c, k_step));
+        }
+    }
+
+    SECTION("with limiter") {
+        VerticalInterpolation interpolation(source, target,
+                                            util::Config("scheme", "cubic") | util::Config("limiter", true));
+        interpolation.execute(field_source, field_target);
+        for (idx_t c = 0; c < nb_columns; ++c) {
+            for (idx_t t = 0; t < target.size(); ++t) {
+                EXPECT(within_bracket(c, t));
+            }
+        }
+    }
+}
+
+CASE("test_vertical_interpolation per column pressure to pressure levels") {
+    const idx_t nb_columns = 7;
+    const idx_t nb_levels  = 30;
+
+    // model level pressures, varying per column, decreasing upwards
+    Field pressure("p", array::make_datatype<double>(), array::make_shape(nb_columns, nb_levels));
+    auto p = array::make_view<double, 2>(pressure);
+    for (idx_t c = 0; c < nb_columns; ++c) {
+        const double surface_pressure = 100000. - 1000. * c;
+        for (idx_t k = 0; k < nb_levels; ++k) {
+            p(c, k) = surface_pressure * (1. - 0.95 * double(k) / double(nb_levels - 1));
+        }
+    }
+    std::vector<double> levels{100000., 85000., 70000., 50000., 30000., 10000., 1000.};
+    Vertical pressure_levels(levels.size(), levels);
+
+    Field field_source("t", array::make_datatype<double>(), array::make_shape(nb_columns, nb_levels, 2));
+    Field field_target("t_pl", array::make_datatype<double>(),
+                       array::make_shape(nb_columns, pressure_levels.size(), 2));
+    auto src = array::make_view<double, 3>(field_source);
+    auto tgt = array::make_view<double, 3>(field_target);
+    for (idx_t c = 0; c < nb_columns; ++c) {
+        for (idx_t k = 0; k < nb_levels; ++k) {
+            src(c, k, 0) = 1.e-3 * p(c, k);
+            src(c, k, 1) = -2.e-3 * p(c, k);
+        }
+    }
+
+    for (std::string scheme : {"linear", "cubic"}) {
+        SECTION(scheme) {
+            VerticalInterpolation interpolation(pressure, pressure_levels,
+                                                util::Config("scheme", scheme) | util::Config("limiter", true));
+            EXPECT_EQ(interpolation.columns(), nb_columns);
+            interpolation.execute(field_source, field_target);
+            for (idx_t c = 0; c < nb_columns; ++c) {
+                const double p_max = p(c, 0);
+                const double p_min = p(c, nb_levels - 1);
+                for (idx_t k = 0; k < pressure_levels.size(); ++k) {
+                    // constant extrapolation outside of the model levels
+                    const double pk = std::min(std::max(pressure_levels[k], p_min), p_max);
+                    EXPECT_APPROX_EQ(tgt(c, k, 0), 1.e-3 * pk, 1.e-6);
+                    EXPECT_APPROX_EQ(tgt(c, k, 1), -2.e-3 * pk, 1.e-6);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
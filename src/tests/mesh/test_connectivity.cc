@@ -515,6 +515,39 @@ CASE("test_multi_block_connectivity_insert") {
     }
 }
 
+CASE("test_connectivity_span") {
+    MultiBlockConnectivity mbc("mbc");
+    idx_t vals[6] = {1, 3, 4, 2, 3, 4};
+    mbc.add(2, 3, vals, false);
+    idx_t vals2[8]{4, 5, 6, 7, 23, 54, 6, 9};
+    mbc.add(2, 4, vals2, false);
+
+    EXPECT(!mbc.uniform());
+    EXPECT_THROWS_AS(mbc.span(), eckit::AssertionFailed);
+
+    const BlockConnectivity& block = mbc.block(1);
+    const auto span                = block.span();
+    EXPECT_EQ(span.rows(), 2);
+    EXPECT_EQ(span.cols(), 4);
+    EXPECT_EQ(span.stride(), 4);
+    for (idx_t r = 0; r < span.rows(); ++r) {
+        for (idx_t c = 0; c < span.cols(); ++c) {
+            EXPECT_EQ(span(r, c), block(r, c));
+            EXPECT_EQ(span.row(r)[c], block(r, c) + FORTRAN_BASE);
+        }
+    }
+
+    IrregularConnectivity conn("conn");
+    conn.add(2, 3, vals, false);
+    EXPECT(conn.uniform());
+    auto mutable_span = conn.span();
+    EXPECT_EQ(mutable_span.rows(), 2);
+    EXPECT_EQ(mutable_span.cols(), 3);
+    mutable_span.set(1, 2, 8);
+    EXPECT_EQ(conn(1, 2), 8);
+    EXPECT_EQ(mutable_span.data()[5], 8 + FORTRAN_BASE);
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -8,14 +8,23 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <vector>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/functionspace/EdgeColumns.h"
+#include "atlas/functionspace/NodeColumns.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/BuildDualMesh.h"
 #include "atlas/mesh/actions/BuildEdges.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/option.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Log.h"
 #include "atlas/util/Unique.h"
 
 #include "tests/AtlasTestEnvironment.h"
@@ -529,6 +538,78 @@ CASE("test_pole_edge_default") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_build_edges_threads_identical") {
+    auto build_edges = [](int threads) {
+        atlas_omp_set_num_threads(threads);
+        auto mesh = StructuredMeshGenerator(Config("triangulate", false)).generate(Grid("O32"));
+        mesh::actions::build_edges(mesh);
+        mesh::actions::build_node_to_edge_connectivity(mesh);
+        return mesh;
+    };
+    auto values = [](const IrregularConnectivity& connectivity) {
+        std::vector<idx_t> v;
+        for (idx_t jrow = 0; jrow < connectivity.rows(); ++jrow) {
+            for (idx_t jcol = 0; jcol < connectivity.cols(jrow); ++jcol) {
+                v.emplace_back(connectivity(jrow, jcol));
+            }
+        }
+        return v;
+    };
+
+    const int max_threads = atlas_omp_get_max_threads();
+    Mesh serial           = build_edges(1);
+    Mesh threaded         = build_edges(std::max(max_threads, 4));
+    atlas_omp_set_num_threads(max_threads);
+
+    EXPECT_EQ(serial.edges().size(), threaded.edges().size());
+    EXPECT(values(serial.edges().node_connectivity()) == values(threaded.edges().node_connectivity()));
+    EXPECT(values(serial.edges().cell_connectivity()) == values(threaded.edges().cell_connectivity()));
+    EXPECT(values(serial.cells().edge_connectivity()) == values(threaded.cells().edge_connectivity()));
+    EXPECT(values(serial.nodes().edge_connectivity()) == values(threaded.nodes().edge_connectivity()));
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_build_median_dual_mesh_threads_identical") {
+    auto build_dual_mesh = [](const Grid& grid, int threads) {
+        atlas_omp_set_num_threads(threads);
+        auto mesh = StructuredMeshGenerator().generate(grid);
+        functionspace::NodeColumns nodes_fs(mesh, option::halo(1));
+        functionspace::EdgeColumns edges_fs(mesh, option::halo(1));
+        mesh::actions::build_median_dual_mesh(mesh);
+        return mesh;
+    };
+
+    const int max_threads = atlas_omp_get_max_threads();
+    // regional: domain boundaries; F16: pole edges; L32x17: nodes on the poles
+    std::vector<Grid> grids{Grid(Config("type", "regional")("nx", 35)("ny", 25)("north", -10)("south", -50)("east", 170)(
+                                "west", 100)),
+                            Grid("F16"), Grid("L32x17")};
+    for (const auto& grid : grids) {
+        Log::info() << "grid: " << grid.name() << std::endl;
+        Mesh serial   = build_dual_mesh(grid, 1);
+        Mesh threaded = build_dual_mesh(grid, std::max(max_threads, 4));
+        atlas_omp_set_num_threads(max_threads);
+
+        const auto serial_volumes   = array::make_view<double, 1>(serial.nodes().field("dual_volumes"));
+        const auto threaded_volumes = array::make_view<double, 1>(threaded.nodes().field("dual_volumes"));
+        EXPECT_EQ(serial_volumes.shape(0), threaded_volumes.shape(0));
+        for (idx_t jnode = 0; jnode < serial_volumes.shape(0); ++jnode) {
+            EXPECT_EQ(serial_volumes(jnode), threaded_volumes(jnode));
+        }
+
+        const auto serial_normals   = array::make_view<double, 2>(serial.edges().field("dual_normals"));
+        const auto threaded_normals = array::make_view<double, 2>(threaded.edges().field("dual_normals"));
+        EXPECT_EQ(serial_normals.shape(0), threaded_normals.shape(0));
+        for (idx_t jedge = 0; jedge < serial_normals.shape(0); ++jedge) {
+            EXPECT_EQ(serial_normals(jedge, 0), threaded_normals(jedge, 0));
+            EXPECT_EQ(serial_normals(jedge, 1), threaded_normals(jedge, 1));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -11,10 +11,14 @@
 
 //-----------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include "atlas/functionspace.h"
 #include "atlas/grid.h"
+#include "atlas/grid/detail/partitioner/HilbertPartitioner.h"
 #include "atlas/mesh.h"
 #include "atlas/meshgenerator.h"
 
@@ -360,6 +364,80 @@ CASE("test_none_reordering") {
     test_reordering(reorder_config);
 }
 
+CASE("test_meshgenerator_reorder_option") {
+    if (grid_name() == "unstructured") {
+        return;
+    }
+    auto config = util::Config("patch_pole", false)("triangulate", true);
+    Mesh mesh_default   = StructuredMeshGenerator(config)(Grid{grid_name()});
+    Mesh mesh_reordered = StructuredMeshGenerator(config | util::Config("reorder", "hilbert"))(Grid{grid_name()});
+
+    EXPECT_EQ(mesh_reordered.nodes().size(), mesh_default.nodes().size());
+    EXPECT_EQ(mesh_reordered.cells().size(), mesh_default.cells().size());
+    EXPECT_EQ(mesh_reordered.metadata().getString("reorder"), std::string("hilbert"));
+
+    // Same set of nodes
+    auto sorted_global_index = [](const Mesh& mesh) {
+        auto glb_idx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+        std::vector<gidx_t> g(glb_idx.size());
+        for (idx_t n = 0; n < glb_idx.size(); ++n) {
+            g[n] = glb_idx(n);
+        }
+        std::sort(g.begin(), g.end());
+        return g;
+    };
+    EXPECT(sorted_global_index(mesh_reordered) == sorted_global_index(mesh_default));
+
+    // Owned nodes first, then ghost nodes grouped by owning partition
+    auto ghost     = array::make_view<int, 1>(mesh_reordered.nodes().ghost());
+    auto part      = array::make_view<int, 1>(mesh_reordered.nodes().partition());
+    auto halo      = array::make_view<int, 1>(mesh_reordered.nodes().halo());
+    auto ghost_key = [&](idx_t n) {
+        return ghost(n) ? std::make_pair(halo(n), part(n)) : std::make_pair(-1, -1);
+    };
+    for (idx_t n = 1; n < mesh_reordered.nodes().size(); ++n) {
+        EXPECT(ghost_key(n - 1) <= ghost_key(n));
+    }
+
+    // Cells remain sorted by halo
+    auto cell_halo = array::make_view<int, 1>(mesh_reordered.cells().halo());
+    for (idx_t e = 1; e < cell_halo.size(); ++e) {
+        EXPECT(cell_halo(e - 1) <= cell_halo(e));
+    }
+}
+
+CASE("test_meshgenerator_hilbert_partitioner_numbering") {
+    if (grid_name() == "unstructured") {
+        return;
+    }
+    Grid grid{grid_name()};
+    grid::Distribution distribution(grid, grid::Partitioner("hilbert", 4));
+    Mesh mesh = StructuredMeshGenerator()(grid, distribution);
+    EXPECT_EQ(mesh.metadata().getString("reorder"), std::string("hilbert"));
+
+    // Owned nodes are numbered in the order of the partitioner's curve
+    auto curve = grid::detail::partitioner::HilbertPartitioner().order(grid);
+    std::vector<gidx_t> position(curve.size());
+    for (size_t i = 0; i < curve.size(); ++i) {
+        position[curve[i]] = i;
+    }
+    auto ghost   = array::make_view<int, 1>(mesh.nodes().ghost());
+    auto glb_idx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+    idx_t previous = -1;
+    for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+        if (not ghost(n)) {
+            if (previous >= 0) {
+                EXPECT(position[glb_idx(previous) - 1] < position[glb_idx(n) - 1]);
+            }
+            previous = n;
+        }
+    }
+
+    // Explicitly disabled
+    Mesh mesh_none = StructuredMeshGenerator(util::Config("reorder", "none"))(grid, distribution);
+    EXPECT(not mesh_none.metadata().has("reorder"));
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
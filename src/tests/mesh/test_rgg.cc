@@ -29,6 +29,7 @@
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -204,6 +205,31 @@ CASE("test_gaussian_latitudes") {
     }
 }
 
+CASE("test_gaussian_quadrature_non_standard_N") {
+    // Gauss-Legendre quadrature with 2N points integrates polynomials up to degree 4N-1 exactly
+    for (size_t N : {3, 37, 1000, 5001}) {
+        Log::info() << "Testing gaussian quadrature " << N << std::endl;
+        std::vector<double> lats(2 * N);
+        std::vector<double> weights(2 * N);
+        grid::spacing::gaussian::gaussian_quadrature_npole_spole(N, lats.data(), weights.data());
+        double wsum  = 0;
+        double x2sum = 0;
+        double x6sum = 0;
+        for (size_t i = 0; i < 2 * N; ++i) {
+            const double x = std::sin(lats[i] * M_PI / 180.);
+            wsum += weights[i];
+            x2sum += weights[i] * x * x;
+            x6sum += weights[i] * x * x * x * x * x * x;
+            if (i > 0) {
+                EXPECT(lats[i] < lats[i - 1]);
+            }
+        }
+        EXPECT(eckit::types::is_approximately_equal(wsum, 1., 1.e-14));
+        EXPECT(eckit::types::is_approximately_equal(x2sum, 1. / 3., 1.e-14));
+        EXPECT(eckit::types::is_approximately_equal(x6sum, 1. / 7., 1.e-14));
+    }
+}
+
 CASE("test_rgg_meshgen_one_part") {
     Mesh m;
     util::Config default_opts;
@@ -445,6 +471,53 @@ CASE("test_meshgen_ghost_at_end") {
     Log::info() << "]" << std::endl;
 }
 
+CASE("test_meshgen_threads_identical") {
+    // Mesh generation with multiple threads must give the same mesh as with a single thread
+    Grid grid("O32");
+    auto generate = [&](int nb_threads, bool ghost_at_end) {
+        const int max_threads = atlas_omp_get_max_threads();
+        atlas_omp_set_num_threads(nb_threads);
+        StructuredMeshGenerator meshgenerator(
+            util::Config("part", 3)("nb_parts", 8)("ghost_at_end", ghost_at_end)("triangulate", true));
+        Mesh mesh = meshgenerator.generate(grid);
+        atlas_omp_set_num_threads(max_threads);
+        return mesh;
+    };
+    for (bool ghost_at_end : {false, true}) {
+        Mesh serial   = generate(1, ghost_at_end);
+        Mesh threaded = generate(std::max(4, atlas_omp_get_max_threads()), ghost_at_end);
+
+        EXPECT_EQ(threaded.nodes().size(), serial.nodes().size());
+        EXPECT_EQ(threaded.cells().elements(0).size(), serial.cells().elements(0).size());
+        EXPECT_EQ(threaded.cells().elements(1).size(), serial.cells().elements(1).size());
+
+        const auto glb_idx_s = array::make_view<gidx_t, 1>(serial.nodes().global_index());
+        const auto glb_idx_t = array::make_view<gidx_t, 1>(threaded.nodes().global_index());
+        const auto ghost_s   = array::make_view<int, 1>(serial.nodes().ghost());
+        const auto ghost_t   = array::make_view<int, 1>(threaded.nodes().ghost());
+        const auto flags_s   = array::make_view<int, 1>(serial.nodes().flags());
+        const auto flags_t   = array::make_view<int, 1>(threaded.nodes().flags());
+        const auto xy_s      = array::make_view<double, 2>(serial.nodes().xy());
+        const auto xy_t      = array::make_view<double, 2>(threaded.nodes().xy());
+        for (idx_t jnode = 0; jnode < serial.nodes().size(); ++jnode) {
+            EXPECT_EQ(glb_idx_t(jnode), glb_idx_s(jnode));
+            EXPECT_EQ(ghost_t(jnode), ghost_s(jnode));
+            EXPECT_EQ(flags_t(jnode), flags_s(jnode));
+            EXPECT_EQ(xy_t(jnode, XX), xy_s(jnode, XX));
+            EXPECT_EQ(xy_t(jnode, YY), xy_s(jnode, YY));
+        }
+
+        const auto& cell_nodes_s = serial.cells().node_connectivity();
+        const auto& cell_nodes_t = threaded.cells().node_connectivity();
+        for (idx_t jcell = 0; jcell < serial.cells().size(); ++jcell) {
+            EXPECT_EQ(cell_nodes_t.cols(jcell), cell_nodes_s.cols(jcell));
+            for (idx_t jcol = 0; jcol < cell_nodes_s.cols(jcell); ++jcol) {
+                EXPECT_EQ(cell_nodes_t(jcell, jcol), cell_nodes_s(jcell, jcol));
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -217,6 +217,55 @@ void test_rank1(Fixture& f) {
     }
 }
 
+// Values that are not exactly representable in single precision
+double wire_value(double gidx, idx_t var) {
+    return (1. + 1.e-12 * gidx) * gidx * (var == 0 ? 10. : 100.);
+}
+
+void test_rank1_wire_float(Fixture& f) {
+    array::ArrayT<POD> arr(f.N, 2);
+    array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>(arr);
+    for (int j = 0; j < f.N; ++j) {
+        arrv(j, 0) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : wire_value(f.gidx[j], 0));
+        arrv(j, 1) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : wire_value(f.gidx[j], 1));
+    }
+
+    f.halo_exchange.execute_as<float, POD, 2>(arr);
+
+    std::vector<POD> gidx_c;
+    switch (mpi::comm().rank()) {
+        case 0: {
+            POD arr_c[] = {9, 1, 2, 3, 4};
+            gidx_c      = vec(arr_c);
+            break;
+        }
+        case 1: {
+            POD arr_c[] = {3, 4, 5, 6, 7, 8};
+            gidx_c      = vec(arr_c);
+            break;
+        }
+        case 2: {
+            POD arr_c[] = {5, 6, 7, 8, 9, 1, 2};
+            gidx_c      = vec(arr_c);
+            break;
+        }
+    }
+
+    // Owned values are untouched, halo values went through single precision
+    for (int j = 0; j < f.N; ++j) {
+        for (idx_t v = 0; v < 2; ++v) {
+            const POD value = wire_value(gidx_c[j], v);
+            if (size_t(f.part[j]) == mpi::comm().rank()) {
+                EXPECT_EQ(arrv(j, v), value);
+            }
+            else {
+                EXPECT(POD(float(value)) != value);
+                EXPECT_EQ(arrv(j, v), POD(float(value)));
+            }
+        }
+    }
+}
+
 void test_rank1_strided_v1(Fixture& f) {
     // create a 2d field from the gidx data, with two components per grid point
     array::ArrayT<POD> arr_t(f.N, 2);
@@ -684,6 +733,8 @@ CASE("test_haloexchange") {
 
     SECTION("test_rank1") { test_rank1(f); }
 
+    SECTION("test_rank1_wire_float") { test_rank1_wire_float(f); }
+
     SECTION("test_rank1_strided_v1") { test_rank1_strided_v1(f); }
 
     SECTION("test_rank1_strided_v2") { test_rank1_strided_v2(f); }
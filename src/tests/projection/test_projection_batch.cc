@@ -0,0 +1,189 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/projection.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Point.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<double> lonlat_box(double west, double east, double south, double north, idx_t n) {
+    std::vector<double> crd;
+    crd.reserve(2 * n * n);
+    for (idx_t j = 0; j < n; ++j) {
+        for (idx_t i = 0; i < n; ++i) {
+            crd.push_back(west + (east - west) * double(i) / double(n - 1));
+            crd.push_back(south + (north - south) * double(j) / double(n - 1));
+        }
+    }
+    return crd;
+}
+
+void expect_batch_equals_pointwise_xy2lonlat(const Projection& projection, const std::vector<double>& xy) {
+    const idx_t n = static_cast<idx_t>(xy.size() / 2);
+
+    std::vector<double> pointwise(xy);
+    for (idx_t i = 0; i < n; ++i) {
+        projection.xy2lonlat(pointwise.data() + 2 * i);
+    }
+
+    std::vector<double> batch(xy.size());
+    projection.xy2lonlat(xy.data(), batch.data(), n);
+
+    std::vector<double> inplace(xy);
+    projection.xy2lonlat(inplace.data(), inplace.data(), n);
+
+    for (size_t i = 0; i < xy.size(); ++i) {
+        EXPECT_APPROX_EQ(batch[i], pointwise[i], 1.e-10);
+        EXPECT_APPROX_EQ(inplace[i], pointwise[i], 1.e-10);
+    }
+}
+
+void expect_batch_equals_pointwise_lonlat2xy(const Projection& projection, const std::vector<double>& lonlat,
+                                             double tolerance) {
+    const idx_t n = static_cast<idx_t>(lonlat.size() / 2);
+
+    std::vector<double> pointwise(lonlat);
+    for (idx_t i = 0; i < n; ++i) {
+        projection.lonlat2xy(pointwise.data() + 2 * i);
+    }
+
+    std::vector<double> batch(lonlat.size());
+    projection.lonlat2xy(lonlat.data(), batch.data(), n);
+
+    for (size_t i = 0; i < lonlat.size(); ++i) {
+        EXPECT_APPROX_EQ(batch[i], pointwise[i], tolerance);
+    }
+}
+
+void expect_batch_equals_pointwise(const Projection& projection, const std::vector<double>& lonlat,
+                                   double xy_tolerance) {
+    Log::info() << projection.type() << std::endl;
+
+    expect_batch_equals_pointwise_lonlat2xy(projection, lonlat, xy_tolerance);
+
+    std::vector<double> xy(lonlat.size());
+    projection.lonlat2xy(lonlat.data(), xy.data(), static_cast<idx_t>(lonlat.size() / 2));
+    expect_batch_equals_pointwise_xy2lonlat(projection, xy);
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_batch_lonlat") {
+    auto lonlat     = lonlat_box(-20., 40., -60., 60., 20);
+    auto south_pole = std::vector<double>{-176., -40.};
+    expect_batch_equals_pointwise(Projection(Config("type", "lonlat")), lonlat, 1.e-10);
+    expect_batch_equals_pointwise(Projection(Config("type", "rotated_lonlat")("south_pole", south_pole)), lonlat,
+                                  1.e-10);
+    expect_batch_equals_pointwise(Projection(Config("type", "rotated_lonlat")("rotation_angle", 30.)), lonlat,
+                                  1.e-10);
+}
+
+CASE("test_batch_mercator") {
+    auto lonlat     = lonlat_box(-20., 40., -60., 60., 20);
+    auto north_pole = std::vector<double>{-176., 40.};
+    expect_batch_equals_pointwise(Projection(Config("type", "mercator")("longitude0", 10.)("latitude1", 14.)),
+                                  lonlat, 1.e-6);
+    expect_batch_equals_pointwise(Projection(Config("type", "rotated_mercator")("north_pole", north_pole)), lonlat,
+                                  1.e-6);
+}
+
+CASE("test_batch_lambert") {
+    auto lonlat = lonlat_box(-100., -40., 20., 70., 20);
+    expect_batch_equals_pointwise(
+        Projection(Config("type", "lambert_conformal_conic")("longitude0", -70.)("latitude0", 45.)), lonlat, 1.e-6);
+    expect_batch_equals_pointwise(
+        Projection(Config("type", "lambert_azimuthal_equal_area")("central_longitude", -67.)("standard_parallel", 50.)),
+        lonlat, 1.e-6);
+}
+
+CASE("test_batch_jacobian") {
+    auto lonlat = lonlat_box(-100., -40., 20., 70., 10);
+    Projection projection(Config("type", "lambert_conformal_conic")("longitude0", -70.)("latitude0", 45.));
+
+    const idx_t n = static_cast<idx_t>(lonlat.size() / 2);
+    std::vector<Projection::Jacobian> jac(n);
+    projection.jacobian(lonlat.data(), jac.data(), n);
+    for (idx_t i = 0; i < n; ++i) {
+        auto expected = projection.jacobian(PointLonLat{lonlat[2 * i], lonlat[2 * i + 1]});
+        for (int r = 0; r < 2; ++r) {
+            for (int c = 0; c < 2; ++c) {
+                EXPECT_APPROX_EQ(jac[i][r][c], expected[r][c], 1.e-10);
+            }
+        }
+    }
+}
+
+CASE("test_batch_cubedsphere") {
+    Grid grid("CS-EA-L-12");
+    std::vector<double> xy;
+    xy.reserve(2 * grid.size());
+    for (const auto& p : grid.xy()) {
+        xy.push_back(p.x());
+        xy.push_back(p.y());
+    }
+    expect_batch_equals_pointwise_xy2lonlat(grid.projection(), xy);
+
+    std::vector<double> lonlat(xy.size());
+    grid.projection().xy2lonlat(xy.data(), lonlat.data(), grid.size());
+    expect_batch_equals_pointwise_lonlat2xy(grid.projection(), lonlat, 1.e-10);
+}
+
+CASE("test_batch_variable_resolution") {
+    Config conf;
+    conf.set("type", "rotated_variable_resolution");
+    conf.set("outer.dx", 1.);
+    conf.set("inner.dx", 0.6511482758621128);
+    conf.set("progression", 1.13);
+    conf.set("inner.xmin", 351.386944827586319);
+    conf.set("inner.ymin", -5.008754172413662);
+    conf.set("inner.xend", 366.363355172413776);
+    conf.set("inner.yend", 8.665359620690706);
+    conf.set("outer.xmin", 348.13120344827576);
+    conf.set("outer.xend", 369.6190965517242);
+    conf.set("outer.ymin", -8.264495551724226);
+    conf.set("outer.yend", 11.92110100000127);
+    conf.set("outer.width", 4.);
+    conf.set("north_pole", std::vector<double>{-176., 40.});
+
+    RegularGrid grid{grid::LinearSpacing{348.13120344827576, 369.6190965517242, 34},
+                     grid::LinearSpacing{-8.264495551724226, 11.92110100000127, 32}, Projection(conf)};
+
+    std::vector<double> xy;
+    xy.reserve(2 * grid.size());
+    for (const auto& p : grid.xy()) {
+        xy.push_back(p.x());
+        xy.push_back(p.y());
+    }
+    expect_batch_equals_pointwise_xy2lonlat(grid.projection(), xy);
+
+    std::vector<double> lonlat(xy.size());
+    grid.projection().xy2lonlat(xy.data(), lonlat.data(), grid.size());
+    expect_batch_equals_pointwise_lonlat2xy(grid.projection(), lonlat, 1.e-10);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
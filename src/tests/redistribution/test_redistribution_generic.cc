@@ -13,6 +13,7 @@
 #include "atlas/grid.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/meshgenerator.h"
+#include "atlas/option.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/redistribution/Redistribution.h"
 #include "atlas/util/Config.h"
@@ -529,6 +530,118 @@ CASE("Cubed sphere dual grid") {
     }
 }
 
+CASE("Mixed field set") {
+    auto grid = atlas::Grid("L24x19");
+
+    auto sourceMesh = MeshGenerator("structured", util::Config("partitioner", "equal_regions")).generate(grid);
+    auto targetMesh = MeshGenerator("structured", util::Config("partitioner", "equal_bands")).generate(grid);
+
+    const auto sourceFunctionSpace = functionspace::NodeColumns(sourceMesh, util::Config("halo", 1));
+    const auto targetFunctionSpace = functionspace::NodeColumns(targetMesh, util::Config("halo", 1));
+
+    // Fields of different datatype and shape are packed into the same messages.
+    auto sourceFieldSet = FieldSet{};
+    sourceFieldSet.add(sourceFunctionSpace.createField<double>(option::name("a") | option::levels(4)));
+    sourceFieldSet.add(sourceFunctionSpace.createField<int>(option::name("b")));
+    sourceFieldSet.add(sourceFunctionSpace.createField<float>(option::name("c") | option::levels(2)));
+    auto targetFieldSet = FieldSet{};
+    targetFieldSet.add(targetFunctionSpace.createField<double>(option::name("a") | option::levels(4)));
+    targetFieldSet.add(targetFunctionSpace.createField<int>(option::name("b")));
+    targetFieldSet.add(targetFunctionSpace.createField<float>(option::name("c") | option::levels(2)));
+
+    const auto redistribution = Redistribution(sourceFunctionSpace, targetFunctionSpace);
+
+    // Execute twice to check that buffers are reused correctly.
+    for (int iteration = 1; iteration <= 2; ++iteration) {
+        const auto sourceGlobalIndex = array::make_view<gidx_t, 1>(sourceFunctionSpace.global_index());
+        auto a                       = array::make_view<double, 2>(sourceFieldSet["a"]);
+        auto b                       = array::make_view<int, 1>(sourceFieldSet["b"]);
+        auto c                       = array::make_view<float, 2>(sourceFieldSet["c"]);
+        for (idx_t i = 0; i < sourceFunctionSpace.size(); ++i) {
+            const auto g = sourceGlobalIndex(i);
+            for (idx_t k = 0; k < a.shape(1); ++k) {
+                a(i, k) = double(iteration * g + k);
+            }
+            b(i) = int(iteration * g);
+            for (idx_t k = 0; k < c.shape(1); ++k) {
+                c(i, k) = float(iteration * g - k);
+            }
+        }
+
+        redistribution.execute(sourceFieldSet, targetFieldSet);
+
+        const auto targetGlobalIndex = array::make_view<gidx_t, 1>(targetFunctionSpace.global_index());
+        const auto targetGhost       = array::make_view<int, 1>(targetFunctionSpace.ghost());
+        const auto ta                = array::make_view<double, 2>(targetFieldSet["a"]);
+        const auto tb                = array::make_view<int, 1>(targetFieldSet["b"]);
+        const auto tc                = array::make_view<float, 2>(targetFieldSet["c"]);
+        for (idx_t i = 0; i < targetFunctionSpace.size(); ++i) {
+            if (targetGhost(i)) {
+                continue;
+            }
+            const auto g = targetGlobalIndex(i);
+            for (idx_t k = 0; k < ta.shape(1); ++k) {
+                EXPECT_EQ(ta(i, k), double(iteration * g + k));
+            }
+            EXPECT_EQ(tb(i), int(iteration * g));
+            for (idx_t k = 0; k < tc.shape(1); ++k) {
+                EXPECT_EQ(tc(i, k), float(iteration * g - k));
+            }
+        }
+    }
+}
+
+CASE("Float wire type") {
+    auto grid = atlas::Grid("L24x19");
+
+    auto sourceMesh = MeshGenerator("structured", util::Config("partitioner", "equal_regions")).generate(grid);
+    auto targetMesh = MeshGenerator("structured", util::Config("partitioner", "equal_bands")).generate(grid);
+
+    const auto sourceFunctionSpace = functionspace::NodeColumns(sourceMesh, util::Config("halo", 1));
+    const auto targetFunctionSpace = functionspace::NodeColumns(targetMesh, util::Config("halo", 1));
+
+    // Field "a" is sent in single precision, field "b" in its native double precision.
+    auto sourceFieldSet = FieldSet{};
+    sourceFieldSet.add(sourceFunctionSpace.createField<double>(option::name("a") | option::levels(3)));
+    sourceFieldSet.add(sourceFunctionSpace.createField<double>(option::name("b") | option::levels(3)));
+    sourceFieldSet["a"].metadata().set("wire_type", "float");
+    auto targetFieldSet = FieldSet{};
+    targetFieldSet.add(targetFunctionSpace.createField<double>(option::name("a") | option::levels(3)));
+    targetFieldSet.add(targetFunctionSpace.createField<double>(option::name("b") | option::levels(3)));
+
+    // Values that are not exactly representable in single precision.
+    const auto value = [](gidx_t g, idx_t k) { return (1. + 1.e-12 * double(g)) * double(g) + 0.1 * double(k); };
+
+    const auto sourceGlobalIndex = array::make_view<gidx_t, 1>(sourceFunctionSpace.global_index());
+    auto a                       = array::make_view<double, 2>(sourceFieldSet["a"]);
+    auto b                       = array::make_view<double, 2>(sourceFieldSet["b"]);
+    for (idx_t i = 0; i < sourceFunctionSpace.size(); ++i) {
+        for (idx_t k = 0; k < a.shape(1); ++k) {
+            a(i, k) = value(sourceGlobalIndex(i), k);
+            b(i, k) = value(sourceGlobalIndex(i), k);
+        }
+    }
+
+    const auto redistribution = Redistribution(sourceFunctionSpace, targetFunctionSpace);
+    redistribution.execute(sourceFieldSet, targetFieldSet);
+
+    const auto targetGlobalIndex = array::make_view<gidx_t, 1>(targetFunctionSpace.global_index());
+    const auto targetGhost       = array::make_view<int, 1>(targetFunctionSpace.ghost());
+    const auto ta                = array::make_view<double, 2>(targetFieldSet["a"]);
+    const auto tb                = array::make_view<double, 2>(targetFieldSet["b"]);
+    for (idx_t i = 0; i < targetFunctionSpace.size(); ++i) {
+        if (targetGhost(i)) {
+            continue;
+        }
+        for (idx_t k = 0; k < ta.shape(1); ++k) {
+            const double v = value(targetGlobalIndex(i), k);
+            EXPECT(double(float(v)) != v);
+            EXPECT_EQ(ta(i, k), double(float(v)));
+            EXPECT_EQ(tb(i, k), v);
+        }
+    }
+}
+
 }  // namespace test
 }  // namespace atlas
 
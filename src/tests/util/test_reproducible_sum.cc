@@ -0,0 +1,146 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "atlas/util/ReproducibleSum.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::ReproducibleSum;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<double> random_values(size_t size) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> value(-1., 1.);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    std::vector<double> values(size);
+    for (auto& v : values) {
+        v = std::ldexp(value(generator), exponent(generator));
+    }
+    return values;
+}
+
+CASE("test_order_independent") {
+    auto values = random_values(100000);
+
+    ReproducibleSum forward;
+    for (double v : values) {
+        forward.add(v);
+    }
+
+    std::mt19937 generator(3);
+    std::shuffle(values.begin(), values.end(), generator);
+
+    // Mimic a split over tasks, combined afterwards
+    std::vector<ReproducibleSum> partial(7);
+    for (size_t i = 0; i < values.size(); ++i) {
+        partial[i % partial.size()].add(values[i]);
+    }
+    ReproducibleSum combined;
+    for (auto& p : partial) {
+        combined += p;
+    }
+
+    EXPECT(forward.value() == combined.value());
+}
+
+CASE("test_exact") {
+    ReproducibleSum sum;
+    sum.add(1.);
+    sum.add(1.e-30);
+    sum.add(-1.);
+    EXPECT(sum.value() == 1.e-30);
+
+    ReproducibleSum large;
+    large.add(std::numeric_limits<double>::max());
+    large.add(std::numeric_limits<double>::max());
+    large.add(-std::numeric_limits<double>::max());
+    large.add(std::numeric_limits<double>::denorm_min());
+    large.add(-std::numeric_limits<double>::denorm_min());
+    EXPECT(large.value() == std::numeric_limits<double>::max());
+
+    ReproducibleSum negative;
+    negative.add(-3.5);
+    negative.add(0.25);
+    EXPECT(negative.value() == -3.25);
+
+    EXPECT(ReproducibleSum().value() == 0.);
+}
+
+CASE("test_rounding") {
+    const double ulp  = std::ldexp(1., -52);
+    const double half = std::ldexp(1., -53);
+
+    auto sum = [](std::initializer_list<double> values) {
+        ReproducibleSum s;
+        for (double x : values) {
+            s.add(x);
+        }
+        return s.value();
+    };
+
+    // Exact tie: round to even
+    EXPECT(sum({1., half}) == 1.);
+    EXPECT(sum({1. + ulp, half}) == 1. + 2. * ulp);
+
+    // A contribution far below the leading limbs still breaks the tie
+    EXPECT(sum({1., half, std::ldexp(1., -200)}) == 1. + ulp);
+    EXPECT(sum({1., half, -std::ldexp(1., -200)}) == 1.);
+    EXPECT(sum({-1., -half, -std::ldexp(1., -200)}) == -1. - ulp);
+
+    EXPECT(sum({std::numeric_limits<double>::denorm_min()}) == std::numeric_limits<double>::denorm_min());
+}
+
+CASE("test_limbs_reduction") {
+    auto values = random_values(1000);
+    ReproducibleSum a;
+    ReproducibleSum b;
+    ReproducibleSum reference;
+    for (size_t i = 0; i < values.size(); ++i) {
+        (i < values.size() / 3 ? a : b).add(values[i]);
+        reference.add(values[i]);
+    }
+
+    // Element-wise sum of normalised limbs, as done by an MPI allReduce
+    a.normalise();
+    b.normalise();
+    for (size_t i = 0; i < ReproducibleSum::size(); ++i) {
+        a.data()[i] += b.data()[i];
+    }
+    EXPECT(a.value() == reference.value());
+}
+
+CASE("test_nonfinite") {
+    ReproducibleSum sum;
+    sum.add(1.);
+    sum.add(std::numeric_limits<double>::infinity());
+    EXPECT(sum.value() == std::numeric_limits<double>::infinity());
+    sum.add(-std::numeric_limits<double>::infinity());
+    EXPECT(std::isnan(sum.value()));
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -0,0 +1,119 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "eckit/log/Bytes.h"
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/util/SharedObjects.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::SharedObjects;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE("test_shared_objects") {
+    SharedObjects::enable();
+    SharedObjects::clear();
+    EXPECT_EQ(SharedObjects::size(), 0);
+
+    Grid grid1("O32");
+    Grid grid2("O32");
+    Grid grid3("O48");
+    EXPECT(grid1.get() == grid2.get());
+    EXPECT(grid1.get() != grid3.get());
+
+    util::Config partitioner("type", "equal_regions");
+    grid::Distribution distribution1(grid1, partitioner);
+    grid::Distribution distribution2(grid2, partitioner);
+    EXPECT(distribution1.get() == distribution2.get());
+
+    functionspace::StructuredColumns fs1(grid1, option::halo(1));
+    functionspace::StructuredColumns fs2(grid2, option::halo(1));
+    functionspace::StructuredColumns fs3(grid1, option::halo(2));
+    functionspace::StructuredColumns fs4(grid1, distribution1, option::halo(1));
+    EXPECT(fs1.get() == fs2.get());
+    EXPECT(fs1.get() != fs3.get());
+    EXPECT_EQ(fs4.size(), fs1.size());
+
+    Log::info() << "shared objects: " << SharedObjects::size() << ", footprint "
+                << eckit::Bytes(SharedObjects::footprint()) << std::endl;
+    EXPECT(SharedObjects::size() >= 6);
+    EXPECT(SharedObjects::footprint() >= grid1.footprint() + grid3.footprint() + fs1.footprint());
+
+    // Released objects stay alive as long as referenced, but are no longer shared
+    SharedObjects::clear();
+    EXPECT_EQ(SharedObjects::size(), 0);
+    EXPECT_EQ(grid1.size(), Grid("O32").size());
+    EXPECT(Grid("O32").get() != grid1.get());
+
+    SharedObjects::clear();
+    SharedObjects::enable(false);
+    EXPECT(Grid("O32").get() != Grid("O32").get());
+    EXPECT_EQ(SharedObjects::size(), 0);
+}
+
+CASE("test_shared_objects_unknown_grid") {
+    SharedObjects::enable();
+    SharedObjects::clear();
+
+    // A failed creation must not leave an entry behind
+    EXPECT_THROWS(Grid("unknown_grid_name"));
+    EXPECT_EQ(SharedObjects::size(), 0);
+    EXPECT_THROWS(Grid("unknown_grid_name"));
+
+    SharedObjects::clear();
+    SharedObjects::enable(false);
+}
+
+CASE("test_shared_objects_communicator") {
+    SharedObjects::enable();
+    SharedObjects::clear();
+
+    Grid grid("O32");
+    util::Config partitioner("type", "equal_regions");
+    grid::Distribution distribution_world(grid, partitioner);
+    functionspace::StructuredColumns fs_world(grid, option::halo(1));
+
+    {
+        // Objects created on another communicator are not shared, even if it has the same size
+        eckit::mpi::comm().split(int(mpi::comm().rank()), "shared_objects_split");
+        eckit::mpi::setCommDefault("shared_objects_split");
+        grid::Distribution distribution_split(grid, partitioner);
+        functionspace::StructuredColumns fs_split(grid, option::halo(1));
+        eckit::mpi::setCommDefault("world");
+
+        EXPECT(distribution_split.get() != distribution_world.get());
+        EXPECT(fs_split.get() != fs_world.get());
+        EXPECT(grid::Distribution(grid, partitioner).get() == distribution_world.get());
+    }
+
+    // Release all objects built on the split communicator before deleting it
+    SharedObjects::clear();
+    eckit::mpi::deleteComm("shared_objects_split");
+    SharedObjects::enable(false);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}